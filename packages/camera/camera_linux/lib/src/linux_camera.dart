@@ -1,5 +1,6 @@
 import 'dart:async';
 import 'dart:math';
+import 'dart:typed_data';
 
 import 'package:camera_linux/src/messages.g.dart';
 import 'package:camera_platform_interface/camera_platform_interface.dart';
@@ -35,6 +36,11 @@ class CameraLinux extends CameraPlatform {
   final Map<int, HostCameraMessageHandler> hostCameraHandlers =
       <int, HostCameraMessageHandler>{};
 
+  /// Size and rate of each camera's image stream, see [setImageStreamOptions].
+  final Map<int, ({int width, int height, double maxFrameRate})>
+      _imageStreamOptions =
+      <int, ({int width, int height, double maxFrameRate})>{};
+
   Stream<CameraEvent> _cameraEvents(int cameraId) =>
       cameraEventStreamController.stream
           .where((CameraEvent event) => event.cameraId == cameraId);
@@ -241,6 +247,84 @@ class CameraLinux extends CameraPlatform {
     throw UnimplementedError('resumeVideoRecording() is not implemented.');
   }
 
+  @override
+  bool supportsImageStreaming() => true;
+
+  /// Streams BGRA frames of the preview, at the size and rate given to
+  /// [setImageStreamOptions].
+  ///
+  /// Frames the listener has not caught up with are dropped by the host rather
+  /// than queued; [getImageStreamDroppedFrameCount] counts them.
+  @override
+  Stream<CameraImageData> onStreamedFrameAvailable(
+    int cameraId, {
+    CameraImageStreamOptions? options,
+  }) {
+    late final StreamController<CameraImageData> controller;
+    controller = StreamController<CameraImageData>(
+      onListen: () => _startImageStream(cameraId, controller),
+      onPause: _onFrameStreamPauseResume,
+      onResume: _onFrameStreamPauseResume,
+      onCancel: () => _stopImageStream(cameraId),
+    );
+    return controller.stream;
+  }
+
+  /// Sets the size and rate of the frames streamed by
+  /// [onStreamedFrameAvailable], applied when the stream is next listened to.
+  ///
+  /// A [width] or [height] of 0 keeps the preview's, or its aspect ratio when
+  /// the other is set; frames are never upscaled. A [maxFrameRate] of 0
+  /// streams every preview frame.
+  void setImageStreamOptions(int cameraId,
+      {int width = 0, int height = 0, double maxFrameRate = 0.0}) {
+    _imageStreamOptions[cameraId] =
+        (width: width, height: height, maxFrameRate: maxFrameRate);
+  }
+
+  /// The number of frames of the current image stream the host dropped
+  /// because the listener had not caught up yet.
+  int getImageStreamDroppedFrameCount(int cameraId) =>
+      hostCameraHandlers[cameraId]?.droppedFrameCount ?? 0;
+
+  Future<void> _startImageStream(
+      int cameraId, StreamController<CameraImageData> controller) async {
+    final HostCameraMessageHandler? handler = hostCameraHandlers[cameraId];
+    handler?.droppedFrameCount = 0;
+    handler?.onImageStreamFrame = (CameraImageData image) {
+      // Returns the frame's credit to the host. While this isolate is busy,
+      // acks lag behind and the host drops frames instead of queueing them.
+      unawaited(_hostApi.receivedImageStreamData(cameraId).onError(
+          (PlatformException e, _) =>
+              controller.addError(CameraException(e.code, e.message))));
+      controller.add(image);
+    };
+    final options = _imageStreamOptions[cameraId] ??
+        (width: 0, height: 0, maxFrameRate: 0.0);
+    try {
+      await _hostApi.startImageStream(
+          cameraId, options.width, options.height, options.maxFrameRate);
+    } on PlatformException catch (e) {
+      controller.addError(CameraException(e.code, e.message));
+    }
+  }
+
+  Future<void> _stopImageStream(int cameraId) async {
+    hostCameraHandlers[cameraId]?.onImageStreamFrame = null;
+    try {
+      await _hostApi.stopImageStream(cameraId);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  void _onFrameStreamPauseResume() {
+    throw CameraException(
+      'InvalidCall',
+      'Pause and resume are not supported for onStreamedFrameAvailable',
+    );
+  }
+
   @override
   Future<void> setFlashMode(int cameraId, FlashMode mode) async {
     // No-op for Linux, as flash mode is not supported.
@@ -380,6 +464,289 @@ class CameraLinux extends CameraPlatform {
       throw CameraException(e.code, e.message);
     }
   }
+
+  /// Sets how many buffers the camera grabs into: more ride out longer
+  /// stalls of the pipeline, at the cost of memory.
+  ///
+  /// [count] is at most 64, 0 for the default of 10. Restarts the stream.
+  Future<void> setGrabBufferCount(int cameraId, int count) async {
+    try {
+      await _hostApi.setGrabBufferCount(cameraId, count);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Sets how many pixel buffer slots frames are uploaded through: more let
+  /// the CPU run further ahead of the GPU, at the cost of memory and latency.
+  ///
+  /// [depth] is at most 8, 0 for the default of 3. Restarts the stream.
+  Future<void> setUploadRingDepth(int cameraId, int depth) async {
+    try {
+      await _hostApi.setUploadRingDepth(cameraId, depth);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Sets how frames queue between the camera and the GPU.
+  ///
+  /// Up to [capacity] frames (0 for 4) wait to be rendered, fewer than the
+  /// camera has grab buffers. When the queue is full,
+  /// [PlatformFrameQueuePolicy.dropOldest] evicts the oldest frame for the
+  /// lowest latency, [PlatformFrameQueuePolicy.dropNewest] discards the new
+  /// one, and [PlatformFrameQueuePolicy.block] holds the camera until one is
+  /// rendered, so no frame is dropped. Restarts the stream.
+  Future<void> setFrameQueuePolicy(int cameraId,
+      {PlatformFrameQueuePolicy policy = PlatformFrameQueuePolicy.dropOldest,
+      int capacity = 0}) async {
+    try {
+      await _hostApi.setFrameQueuePolicy(cameraId, policy, capacity);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Sets the exposures (in microseconds) fused into each preview frame, with
+  /// one gain (in dB) per exposure, or none to keep the current gain.
+  ///
+  /// Takes effect on the running stream; 1 to 8 exposures are supported.
+  Future<void> setExposureBracket(
+      int cameraId, List<double> exposuresUs, List<double> gains) async {
+    try {
+      await _hostApi.setExposureBracket(cameraId, exposuresUs, gains);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Selects the tone-mapping curve applied to the fused preview.
+  ///
+  /// [key] is the middle grey the scene's log-average luminance maps to, or 0
+  /// to derive it from the scene brightness. The exposure eases toward changes
+  /// in brightness with a time constant of [adaptationSeconds].
+  Future<void> setToneMapping(
+      int cameraId, PlatformToneMappingOperator toneMappingOperator,
+      {double key = 0.0, double adaptationSeconds = 0.5}) async {
+    try {
+      await _hostApi.setToneMapping(
+          cameraId, toneMappingOperator, key, adaptationSeconds);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Enables or disables the auto-exposure loop that drives the exposure
+  /// bracket from the preview's luminance statistics.
+  ///
+  /// The longest exposure is driven to a mean mid-tone level of
+  /// [targetBrightness] (0-255). The shortest exposure is driven to keep a
+  /// fraction [overblownTargetRatio] of its pixels at or above
+  /// [overblownThreshold] (0-255). Both loops are proportional, with gain
+  /// [controllerGain].
+  Future<void> setAutoExposure(
+    int cameraId, {
+    required bool enabled,
+    double targetBrightness = 120.0,
+    double overblownThreshold = 240.0,
+    double overblownTargetRatio = 0.01,
+    double controllerGain = 0.6,
+  }) async {
+    try {
+      await _hostApi.setAutoExposure(cameraId, enabled, targetBrightness,
+          overblownThreshold, overblownTargetRatio, controllerGain);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Selects how frames in a Bayer [PlatformImageFormatGroup] are
+  /// interpolated to RGB. Malvar-He-Cutler, the default, shows fewer colour
+  /// fringes than bilinear at a slightly higher GPU cost.
+  Future<void> setDemosaicAlgorithm(
+      int cameraId, PlatformDemosaicAlgorithm algorithm) async {
+    try {
+      await _hostApi.setDemosaicAlgorithm(cameraId, algorithm);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Selects the formats of the HDR chain's intermediate render targets and
+  /// of the preview texture, restarting the stream when it is running.
+  ///
+  /// [PlatformRenderFormat.rgba16f] intermediates keep the fused radiance
+  /// unclipped for tone mapping; [PlatformRenderFormat.rgb10a2] halves their
+  /// bandwidth and is what drivers without float render targets fall back
+  /// to. A [PlatformRenderFormat.rgb10a2] preview avoids banding in smooth
+  /// gradients at the same size as RGBA8.
+  Future<void> setRenderFormats(int cameraId,
+      PlatformRenderFormat intermediateFormat,
+      PlatformRenderFormat displayFormat) async {
+    try {
+      await _hostApi.setRenderFormats(
+          cameraId, intermediateFormat, displayFormat);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Sets the size of the preview texture, restarting the stream when it is
+  /// running.
+  ///
+  /// The preview is scaled down on the GPU from the full-resolution frame,
+  /// which still feeds image streams, pictures and recordings, so a preview
+  /// shown small costs the compositor only its own size. A side of 0 keeps
+  /// the frame's size, or its aspect ratio when the other side is set.
+  Future<void> setPreviewSize(int cameraId,
+      {int width = 0, int height = 0}) async {
+    try {
+      await _hostApi.setPreviewSize(cameraId, width, height);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Keeps the last [frameCount] frames for [takePicture], restarting the
+  /// stream when it is running.
+  ///
+  /// [takePicture] then saves the kept frame closest to the call instead of
+  /// stopping the stream to grab a new one, so the preview keeps running and
+  /// the picture shows the moment it was asked for. A [frameCount] of 0
+  /// turns this off. With [rawFrames], the camera's frames are kept and saved
+  /// as grabbed, each exposure of a bracket on its own, rather than fused and
+  /// tone mapped.
+  Future<void> setZeroShutterLag(int cameraId,
+      {int frameCount = 4, bool rawFrames = false}) async {
+    try {
+      await _hostApi.setZeroShutterLag(cameraId, frameCount, rawFrames);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Takes the next [count] frames of the running stream as pictures in
+  /// [directory], a new temporary directory by default.
+  ///
+  /// Frames are kept as grabbed, each exposure of a bracket on its own, and
+  /// copied as fast as the camera delivers them; the pictures are written
+  /// in parallel once the last frame is in.
+  Future<BurstResult> takeBurst(int cameraId, int count,
+      {String? directory}) async {
+    try {
+      directory ??=
+          (await (await getTemporaryDirectory()).createTemp('burst')).path;
+      final PlatformBurstResult result =
+          await _hostApi.takeBurst(cameraId, count, directory);
+      return BurstResult(
+        pictures: result.paths.map(XFile.new).toList(),
+        timestamps: result.timestampsUs
+            .map((int us) => Duration(microseconds: us))
+            .toList(),
+      );
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Sets how [takePicture] and [takeBurst] compress their JPEGs.
+  ///
+  /// [quality] goes from 1 to 100. Lower chroma [subsampling] keeps finer
+  /// colour detail in larger files. A [restartInterval] puts a restart marker
+  /// every that many rows of 8 or 16 pixel blocks, so a corrupted file loses
+  /// a band rather than the rest of the picture; tall pictures always have
+  /// one between the strips encoded in parallel.
+  Future<void> setJpegSettings(int cameraId,
+      {int quality = 90,
+      PlatformJpegSubsampling subsampling = PlatformJpegSubsampling.yuv420,
+      int restartInterval = 0}) async {
+    try {
+      await _hostApi.setJpegSettings(
+          cameraId, quality, subsampling, restartInterval);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Sets how the next [startVideoRecording] is encoded.
+  ///
+  /// Recordings are H.264, on the hardware encoder when the board has one.
+  /// A [bitrate] of 0 derives one from the frame size and rate. [container]
+  /// is an FFmpeg muxer name such as `mp4`, `matroska` or `mpegts`; empty
+  /// picks it from the file's extension. Frames keep the times they were
+  /// captured at, so recordings play back at the camera's actual rate.
+  Future<void> setVideoRecordingSettings(int cameraId,
+      {int bitrate = 0,
+      int keyFrameInterval = 60,
+      String container = ''}) async {
+    try {
+      await _hostApi.setVideoRecordingSettings(
+          cameraId, bitrate, keyFrameInterval, container);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Sets what the next [startVideoRecording] captures.
+  ///
+  /// By default recordings hold the fused, tone-mapped frames the preview
+  /// shows, read back from the GPU without stalling it. [gpuNv12] converts
+  /// them to NV12 on the GPU first, which reads back less than half the
+  /// bytes; frames whose width is not a multiple of 4 are read back as RGBA
+  /// either way. With [processedFrames] false the raw sensor frames are
+  /// recorded instead. Cannot be changed while recording.
+  Future<void> setVideoRecordingSource(int cameraId,
+      {bool processedFrames = true, bool gpuNv12 = true}) async {
+    try {
+      await _hostApi.setVideoRecordingSource(
+          cameraId, processedFrames, gpuNv12);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Records every frame as the camera delivers it, uncompressed, for
+  /// offline tuning and replay.
+  ///
+  /// Frames are written with direct I/O to a raw sequence file: a header, a
+  /// table of per-frame metadata (capture time, exposure, gain) and the
+  /// payloads. The table has room for [maxFrames] frames, 0 for 65536;
+  /// later ones are dropped. Runs alongside [startVideoRecording].
+  Future<void> startRawRecording(int cameraId,
+      {String? filePath, int maxFrames = 0}) async {
+    try {
+      String path = filePath ?? '';
+      if (path.isEmpty) {
+        final directory = await getTemporaryDirectory();
+        final uuid = DateTime.now().millisecondsSinceEpoch.toString();
+        path = '${directory.path}/$uuid.rawseq';
+      }
+      await _hostApi.startRawRecording(cameraId, path, maxFrames);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Finishes the recording started by [startRawRecording].
+  Future<XFile> stopRawRecording(int cameraId) async {
+    try {
+      final path = await _hostApi.stopRawRecording(cameraId);
+      return XFile(path);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+}
+
+/// The pictures of a [CameraLinux.takeBurst], in capture order.
+class BurstResult {
+  const BurstResult({required this.pictures, required this.timestamps});
+
+  final List<XFile> pictures;
+
+  /// When each frame was retrieved from the camera, after the burst was
+  /// requested.
+  final List<Duration> timestamps;
 }
 
 /// An event fired when the camera texture id changed.
@@ -461,6 +828,36 @@ class HostCameraMessageHandler implements CameraEventApi {
   void textureId(int textureId) {
     streamController.add(TextureIdEvent(cameraId, textureId));
   }
+
+  /// Receives the frames of the image stream, while one is listened to.
+  void Function(CameraImageData image)? onImageStreamFrame;
+
+  /// Frames of the current image stream dropped by the host.
+  int droppedFrameCount = 0;
+
+  @override
+  void imageStreamFrame(int width, int height, int bytesPerRow,
+      Uint8List bytes, int droppedFrameCount) {
+    this.droppedFrameCount = droppedFrameCount;
+    onImageStreamFrame?.call(
+      CameraImageData(
+        // kCVPixelFormatType_32BGRA, as reported on iOS
+        format: const CameraImageFormat(ImageFormatGroup.bgra8888,
+            raw: 1111970369),
+        planes: <CameraImagePlane>[
+          CameraImagePlane(
+            bytes: bytes,
+            bytesPerRow: bytesPerRow,
+            bytesPerPixel: 4,
+            width: width,
+            height: height,
+          ),
+        ],
+        height: height,
+        width: width,
+      ),
+    );
+  }
 }
 
 /// Converts a Pigeon [PlatformExposureMode] to an [ExposureMode].
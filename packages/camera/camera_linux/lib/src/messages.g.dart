@@ -55,6 +55,16 @@ enum PlatformFocusMode {
 enum PlatformImageFormatGroup {
   rgb8,
   mono8,
+  /// Raw sensor data, demosaiced on the GPU.
+  bayerRG8,
+  /// Raw sensor data, demosaiced on the GPU.
+  bayerGB8,
+  /// 12-bit samples packed two to three bytes, unpacked on the GPU.
+  mono12p,
+  /// 12-bit samples packed two to three bytes, unpacked on the GPU.
+  bayerRG12p,
+  /// 12-bit samples packed two to three bytes, unpacked on the GPU.
+  bayerGB12p,
 }
 
 enum PlatformResolutionPreset {
@@ -66,6 +76,36 @@ enum PlatformResolutionPreset {
   max,
 }
 
+enum PlatformFrameQueuePolicy {
+  dropOldest,
+  dropNewest,
+  block,
+}
+
+enum PlatformToneMappingOperator {
+  none,
+  reinhard,
+  acesFilmic,
+}
+
+enum PlatformDemosaicAlgorithm {
+  bilinear,
+  malvarHeCutler,
+}
+
+enum PlatformRenderFormat {
+  rgb8,
+  rgba8,
+  rgb10a2,
+  rgba16f,
+}
+
+enum PlatformJpegSubsampling {
+  yuv420,
+  yuv422,
+  yuv444,
+}
+
 class PlatformSize {
   PlatformSize({
     required this.width,
@@ -164,6 +204,36 @@ class PlatformPoint {
   }
 }
 
+/// Pictures written by a burst.
+class PlatformBurstResult {
+  PlatformBurstResult({
+    required this.paths,
+    required this.timestampsUs,
+  });
+
+  /// The pictures' paths, in capture order.
+  List<String> paths;
+
+  /// When each frame was retrieved from the camera, in microseconds after the
+  /// burst was requested.
+  List<int> timestampsUs;
+
+  Object encode() {
+    return <Object?>[
+      paths,
+      timestampsUs,
+    ];
+  }
+
+  static PlatformBurstResult decode(Object result) {
+    result as List<Object?>;
+    return PlatformBurstResult(
+      paths: (result[0] as List<Object?>?)!.cast<String>(),
+      timestampsUs: (result[1] as List<Object?>?)!.cast<int>(),
+    );
+  }
+}
+
 
 class _PigeonCodec extends StandardMessageCodec {
   const _PigeonCodec();
@@ -190,14 +260,32 @@ class _PigeonCodec extends StandardMessageCodec {
     }    else if (value is PlatformResolutionPreset) {
       buffer.putUint8(134);
       writeValue(buffer, value.index);
-    }    else if (value is PlatformSize) {
+    }    else if (value is PlatformFrameQueuePolicy) {
       buffer.putUint8(135);
+      writeValue(buffer, value.index);
+    }    else if (value is PlatformToneMappingOperator) {
+      buffer.putUint8(136);
+      writeValue(buffer, value.index);
+    }    else if (value is PlatformDemosaicAlgorithm) {
+      buffer.putUint8(137);
+      writeValue(buffer, value.index);
+    }    else if (value is PlatformRenderFormat) {
+      buffer.putUint8(138);
+      writeValue(buffer, value.index);
+    }    else if (value is PlatformJpegSubsampling) {
+      buffer.putUint8(139);
+      writeValue(buffer, value.index);
+    }    else if (value is PlatformSize) {
+      buffer.putUint8(140);
       writeValue(buffer, value.encode());
     }    else if (value is PlatformCameraState) {
-      buffer.putUint8(136);
+      buffer.putUint8(141);
       writeValue(buffer, value.encode());
     }    else if (value is PlatformPoint) {
-      buffer.putUint8(137);
+      buffer.putUint8(142);
+      writeValue(buffer, value.encode());
+    }    else if (value is PlatformBurstResult) {
+      buffer.putUint8(142);
       writeValue(buffer, value.encode());
     } else {
       super.writeValue(buffer, value);
@@ -226,11 +314,28 @@ class _PigeonCodec extends StandardMessageCodec {
         final int? value = readValue(buffer) as int?;
         return value == null ? null : PlatformResolutionPreset.values[value];
       case 135: 
-        return PlatformSize.decode(readValue(buffer)!);
+        final int? value = readValue(buffer) as int?;
+        return value == null ? null : PlatformFrameQueuePolicy.values[value];
       case 136: 
-        return PlatformCameraState.decode(readValue(buffer)!);
+        final int? value = readValue(buffer) as int?;
+        return value == null ? null : PlatformToneMappingOperator.values[value];
       case 137: 
+        final int? value = readValue(buffer) as int?;
+        return value == null ? null : PlatformDemosaicAlgorithm.values[value];
+      case 138: 
+        final int? value = readValue(buffer) as int?;
+        return value == null ? null : PlatformRenderFormat.values[value];
+      case 139: 
+        final int? value = readValue(buffer) as int?;
+        return value == null ? null : PlatformJpegSubsampling.values[value];
+      case 140: 
+        return PlatformSize.decode(readValue(buffer)!);
+      case 141: 
+        return PlatformCameraState.decode(readValue(buffer)!);
+      case 142: 
         return PlatformPoint.decode(readValue(buffer)!);
+      case 142: 
+        return PlatformBurstResult.decode(readValue(buffer)!);
       default:
         return super.readValueOfType(type, buffer);
     }
@@ -519,6 +624,484 @@ class CameraApi {
       return;
     }
   }
+
+  /// Sets how many buffers the camera grabs into, 0 for the default.
+  Future<void> setGrabBufferCount(int cameraId, int count) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.camera_linux.CameraApi.setGrabBufferCount$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[cameraId, count]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Sets how many pixel buffer slots frames are uploaded through, 0 for the
+  /// default.
+  Future<void> setUploadRingDepth(int cameraId, int depth) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.camera_linux.CameraApi.setUploadRingDepth$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[cameraId, depth]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Sets what happens to frames retrieved while [capacity] frames (0 for the
+  /// default) already wait for the GPU: evict the oldest, drop the new one, or
+  /// hold the acquisition thread until one is rendered.
+  Future<void> setFrameQueuePolicy(int cameraId, PlatformFrameQueuePolicy policy, int capacity) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.camera_linux.CameraApi.setFrameQueuePolicy$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[cameraId, policy, capacity]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Sets the exposure bracket fused into each output frame, as exposure times
+  /// in microseconds and matching gains in dB (empty keeps the current gain).
+  Future<void> setExposureBracket(int cameraId, List<double> exposuresUs, List<double> gains) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.camera_linux.CameraApi.setExposureBracket$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[cameraId, exposuresUs, gains]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Selects the tone-mapping operator applied after exposure fusion. [key] is
+  /// the middle grey the scene average maps to, or 0 to derive it from the scene
+  /// brightness; [adaptationSeconds] is the time constant of the adaptation.
+  Future<void> setToneMapping(int cameraId, PlatformToneMappingOperator toneMappingOperator, double key, double adaptationSeconds) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.camera_linux.CameraApi.setToneMapping$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[cameraId, toneMappingOperator, key, adaptationSeconds]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Enables the bracket auto-exposure loop. [targetBrightness] (0-255) is the
+  /// mid-tone level of the longest exposure; the shortest exposure keeps
+  /// [overblownTargetRatio] of its pixels at or above [overblownThreshold] (0-255).
+  /// [controllerGain] is the proportional gain of both loops.
+  Future<void> setAutoExposure(int cameraId, bool enabled, double targetBrightness, double overblownThreshold, double overblownTargetRatio, double controllerGain) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.camera_linux.CameraApi.setAutoExposure$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[cameraId, enabled, targetBrightness, overblownThreshold, overblownTargetRatio, controllerGain]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Selects how Bayer image format groups are interpolated to RGB on the GPU.
+  Future<void> setDemosaicAlgorithm(int cameraId, PlatformDemosaicAlgorithm algorithm) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.camera_linux.CameraApi.setDemosaicAlgorithm$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[cameraId, algorithm]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Selects the formats of the HDR chain's intermediate render targets and of
+  /// the preview texture, restarting the stream when it is running.
+  Future<void> setRenderFormats(int cameraId, PlatformRenderFormat intermediateFormat, PlatformRenderFormat displayFormat) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.camera_linux.CameraApi.setRenderFormats$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[cameraId, intermediateFormat, displayFormat]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Starts streaming frames to CameraEventApi.imageStreamFrame, scaled to
+  /// [width] x [height] (0 keeps the frame's size, or its aspect ratio when
+  /// only one is 0) and at most [maxFrameRate] frames per second (0 for every
+  /// frame).
+  Future<void> startImageStream(int cameraId, int width, int height, double maxFrameRate) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.camera_linux.CameraApi.startImageStream$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[cameraId, width, height, maxFrameRate]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Stops streaming frames to Dart.
+  Future<void> stopImageStream(int cameraId) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.camera_linux.CameraApi.stopImageStream$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[cameraId]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Returns the credit of a streamed frame Dart is done with. Frames rendered
+  /// while every credit is out are dropped rather than queued.
+  Future<void> receivedImageStreamData(int cameraId) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.camera_linux.CameraApi.receivedImageStreamData$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[cameraId]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Sets the size of the preview texture, scaled down on the GPU from the
+  /// full-resolution frame (0 keeps the frame's size, or its aspect ratio when
+  /// only one is 0). Restarts the stream when it is running.
+  Future<void> setPreviewSize(int cameraId, int width, int height) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.camera_linux.CameraApi.setPreviewSize$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[cameraId, width, height]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Keeps the last [frameCount] frames so takePicture picks the one closest to
+  /// the call without stopping the stream (0 stops it and grabs a new frame
+  /// instead). [rawFrames] keeps the camera's frames rather than the fused and
+  /// tone-mapped ones. Restarts the stream when it is running.
+  Future<void> setZeroShutterLag(int cameraId, int frameCount, bool rawFrames) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.camera_linux.CameraApi.setZeroShutterLag$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[cameraId, frameCount, rawFrames]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Captures the next [count] frames from the stream at the sensor's rate and
+  /// writes them as pictures in [directory], in parallel once all are in.
+  Future<PlatformBurstResult> takeBurst(int cameraId, int count, String directory) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.camera_linux.CameraApi.takeBurst$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[cameraId, count, directory]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else if (pigeonVar_replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (pigeonVar_replyList[0] as PlatformBurstResult?)!;
+    }
+  }
+
+  /// Sets how pictures are compressed: [quality] from 1 to 100, the chroma
+  /// [subsampling], and a restart marker every [restartInterval] rows of blocks
+  /// (0 for none, or only between the strips encoded in parallel).
+  Future<void> setJpegSettings(int cameraId, int quality, PlatformJpegSubsampling subsampling, int restartInterval) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.camera_linux.CameraApi.setJpegSettings$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[cameraId, quality, subsampling, restartInterval]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Sets how the next recording is encoded: [bitrate] in bits per second (0 to
+  /// derive it from the frame size and rate), a key frame every
+  /// [keyFrameInterval] frames, and the [container] format name (empty to
+  /// derive it from the file's extension).
+  Future<void> setVideoRecordingSettings(int cameraId, int bitrate, int keyFrameInterval, String container) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.camera_linux.CameraApi.setVideoRecordingSettings$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[cameraId, bitrate, keyFrameInterval, container]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Chooses what the next recording captures: the processed (fused and
+  /// tone-mapped) frames shown in the preview, or the raw sensor frames.
+  /// Processed frames are converted to NV12 on the GPU when [gpuNv12] is
+  /// set and the frame size allows it, reading back 12 bits per pixel
+  /// instead of 32.
+  Future<void> setVideoRecordingSource(int cameraId, bool processedFrames, bool gpuNv12) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.camera_linux.CameraApi.setVideoRecordingSource$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[cameraId, processedFrames, gpuNv12]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Records the camera's frames as grabbed, uncompressed, to a raw sequence
+  /// file at [filePath] with room for [maxFrames] frames (0 for the
+  /// default).
+  Future<void> startRawRecording(int cameraId, String filePath, int maxFrames) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.camera_linux.CameraApi.startRawRecording$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[cameraId, filePath, maxFrames]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Finishes the raw recording and returns the path of its file.
+  Future<String> stopRawRecording(int cameraId) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.camera_linux.CameraApi.stopRawRecording$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[cameraId]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else if (pigeonVar_replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (pigeonVar_replyList[0] as String?)!;
+    }
+  }
 }
 
 /// Handler for native callbacks that are tied to a specific camera ID.
@@ -532,6 +1115,11 @@ abstract class CameraEventApi {
 
   void textureId(int textureId);
 
+  /// Called with each frame streamed after CameraApi.startImageStream, as
+  /// BGRA rows. [droppedFrameCount] counts the frames dropped since the
+  /// stream started because every credit was out.
+  void imageStreamFrame(int width, int height, int bytesPerRow, Uint8List bytes, int droppedFrameCount);
+
   /// Called when an error occurs in the camera.
   ///
   /// This should be used for errors that occur outside of the context of
@@ -590,6 +1178,43 @@ abstract class CameraEventApi {
         });
       }
     }
+    {
+      final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.camera_linux.CameraEventApi.imageStreamFrame$messageChannelSuffix', pigeonChannelCodec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        pigeonVar_channel.setMessageHandler(null);
+      } else {
+        pigeonVar_channel.setMessageHandler((Object? message) async {
+          assert(message != null,
+          'Argument for dev.flutter.pigeon.camera_linux.CameraEventApi.imageStreamFrame was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_width = (args[0] as int?);
+          assert(arg_width != null,
+              'Argument for dev.flutter.pigeon.camera_linux.CameraEventApi.imageStreamFrame was null, expected non-null int.');
+          final int? arg_height = (args[1] as int?);
+          assert(arg_height != null,
+              'Argument for dev.flutter.pigeon.camera_linux.CameraEventApi.imageStreamFrame was null, expected non-null int.');
+          final int? arg_bytesPerRow = (args[2] as int?);
+          assert(arg_bytesPerRow != null,
+              'Argument for dev.flutter.pigeon.camera_linux.CameraEventApi.imageStreamFrame was null, expected non-null int.');
+          final Uint8List? arg_bytes = (args[3] as Uint8List?);
+          assert(arg_bytes != null,
+              'Argument for dev.flutter.pigeon.camera_linux.CameraEventApi.imageStreamFrame was null, expected non-null Uint8List.');
+          final int? arg_droppedFrameCount = (args[4] as int?);
+          assert(arg_droppedFrameCount != null,
+              'Argument for dev.flutter.pigeon.camera_linux.CameraEventApi.imageStreamFrame was null, expected non-null int.');
+          try {
+            api.imageStreamFrame(arg_width!, arg_height!, arg_bytesPerRow!, arg_bytes!, arg_droppedFrameCount!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          }          catch (e) {
+            return wrapResponse(error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
     {
       final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
           'dev.flutter.pigeon.camera_linux.CameraEventApi.error$messageChannelSuffix', pigeonChannelCodec,
@@ -0,0 +1,152 @@
+#include "auto_exposure_controller.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+// Largest correction applied per metered frame, as a factor either way.
+static constexpr double kMaxStep = 2.0;
+// Relative exposure change below which the bracket is left alone.
+static constexpr double kDeadband = 0.02;
+// Mid-tone range the brightness loop averages over, exclusive.
+static constexpr int kShadowLimit = 10;
+static constexpr int kHighlightLimit = 240;
+
+void LuminanceHistogram::Accumulate(const uint8_t* rgba, int width,
+                                    int height, size_t rowStride, bool mono) {
+  const int cx = width / 2;
+  const int cy = height / 2;
+  const int radius = std::min(width, height) / 4;
+
+  for (int y = cy - radius; y <= cy + radius; ++y) {
+    if (y < 0 || y >= height) continue;
+    const int dy = y - cy;
+    const int span = static_cast<int>(
+        std::sqrt(static_cast<double>(radius * radius - dy * dy)));
+    const int x0 = std::max(0, cx - span);
+    const int x1 = std::min(width - 1, cx + span);
+    const uint8_t* pixel = rgba + y * rowStride + x0 * 4;
+    if (mono) {
+      for (int x = x0; x <= x1; ++x, pixel += 4) {
+        ++bins[pixel[0]];
+      }
+    } else {
+      for (int x = x0; x <= x1; ++x, pixel += 4) {
+        // BT.601 weights in 8-bit fixed point, as the old CPU meter used.
+        ++bins[(77 * pixel[0] + 150 * pixel[1] + 29 * pixel[2]) >> 8];
+      }
+    }
+    count += static_cast<uint32_t>(x1 - x0 + 1);
+  }
+}
+
+void AutoExposureController::SetSettings(const AutoExposureSettings& settings) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_settings = settings;
+}
+
+AutoExposureSettings AutoExposureController::GetSettings() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_settings;
+}
+
+bool AutoExposureController::IsEnabled() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_settings.enabled;
+}
+
+void AutoExposureController::SetExposureLimits(double minExposureUs,
+                                               double maxExposureUs) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_min_exposure_us = minExposureUs;
+  m_max_exposure_us = maxExposureUs;
+}
+
+bool AutoExposureController::Update(const LuminanceHistogram& histogram,
+                                    size_t slot, double exposureUs,
+                                    std::vector<double>& exposures) const {
+  AutoExposureSettings settings;
+  double minExposure, maxExposure;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    settings = m_settings;
+    minExposure = m_min_exposure_us;
+    maxExposure = m_max_exposure_us;
+  }
+  const size_t n = exposures.size();
+  if (!settings.enabled || slot >= n || histogram.count == 0 ||
+      exposureUs <= 0.0) {
+    return false;
+  }
+
+  std::vector<size_t> order(n);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+            [&](size_t a, size_t b) { return exposures[a] < exposures[b]; });
+  const size_t shortSlot = order.front();
+  const size_t longSlot = order.back();
+
+  double error;
+  if (slot == longSlot) {
+    uint64_t sum = 0;
+    uint64_t count = 0;
+    for (int i = kShadowLimit + 1; i < kHighlightLimit; ++i) {
+      sum += static_cast<uint64_t>(i) * histogram.bins[i];
+      count += histogram.bins[i];
+    }
+    if (count == 0) {
+      // Everything clipped one way or the other: meter the whole disk.
+      for (int i = 0; i < LUMINANCE_HISTOGRAM_BINS; ++i) {
+        sum += static_cast<uint64_t>(i) * histogram.bins[i];
+      }
+      count = histogram.count;
+    }
+    const double brightness = static_cast<double>(sum) / count;
+    error =
+        (settings.targetBrightness - brightness) / settings.targetBrightness;
+  } else if (slot == shortSlot) {
+    uint64_t overblown = 0;
+    const int threshold = std::clamp(
+        static_cast<int>(std::ceil(settings.overblownThreshold)), 0,
+        LUMINANCE_HISTOGRAM_BINS - 1);
+    for (int i = threshold; i < LUMINANCE_HISTOGRAM_BINS; ++i) {
+      overblown += histogram.bins[i];
+    }
+    const double ratio = static_cast<double>(overblown) / histogram.count;
+    error = (settings.overblownTargetRatio - ratio) /
+            settings.overblownTargetRatio;
+  } else {
+    // Intermediate entries follow the two ends.
+    return false;
+  }
+
+  const double step =
+      std::clamp(1.0 + settings.gain * error, 1.0 / kMaxStep, kMaxStep);
+  std::vector<double> proposed = exposures;
+  proposed[slot] = std::clamp(exposureUs * step, minExposure, maxExposure);
+  if (n > 1) {
+    // Keep the ends ordered.
+    if (slot == shortSlot) {
+      proposed[slot] = std::min(proposed[slot], proposed[longSlot]);
+    } else {
+      proposed[slot] = std::max(proposed[slot], proposed[shortSlot]);
+    }
+    const double shortest = proposed[shortSlot];
+    const double ratio = proposed[longSlot] / shortest;
+    for (size_t rank = 1; rank + 1 < n; ++rank) {
+      proposed[order[rank]] =
+          shortest * std::pow(ratio, static_cast<double>(rank) / (n - 1));
+    }
+  }
+
+  bool changed = false;
+  for (size_t i = 0; i < n; ++i) {
+    if (std::abs(proposed[i] - exposures[i]) > kDeadband * exposures[i]) {
+      changed = true;
+    }
+  }
+  if (changed) {
+    exposures = std::move(proposed);
+  }
+  return changed;
+}
@@ -0,0 +1,63 @@
+#ifndef AUTO_EXPOSURE_CONTROLLER_H_
+#define AUTO_EXPOSURE_CONTROLLER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#define LUMINANCE_HISTOGRAM_BINS 256
+
+// 8-bit luminance histogram of the centred metering disk (radius a quarter of
+// the smaller image side).
+struct LuminanceHistogram {
+  uint32_t bins[LUMINANCE_HISTOGRAM_BINS] = {0};
+  uint32_t count = 0;
+
+  // Mono images are read back as RGBA too, with the grey value in red.
+  void Accumulate(const uint8_t* rgba, int width, int height,
+                  size_t rowStride, bool mono);
+};
+
+struct AutoExposureSettings {
+  bool enabled = false;
+  // Mean luminance (0-255) the longest exposure's mid-tones are driven to
+  double targetBrightness = 120.0;
+  // Luminance (0-255) from which a pixel counts as blown out
+  double overblownThreshold = 240.0;
+  // Fraction of blown-out pixels the shortest exposure is driven to
+  double overblownTargetRatio = 0.01;
+  // Proportional gain of both loops
+  double gain = 0.6;
+};
+
+// Proportional auto-exposure for an exposure bracket.
+//
+// The shortest exposure holds the blown-out fraction at its target so the
+// highlights stay recoverable; the longest exposure holds the mid-tone
+// brightness. Entries in between are spaced geometrically between the two.
+// Each correction is relative to the exposure the metered frame was actually
+// shot with, so frames still in flight do not make the loop overshoot.
+//
+// Settings may be changed from any thread; Update() runs on one thread.
+class AutoExposureController {
+ public:
+  void SetSettings(const AutoExposureSettings& settings);
+  AutoExposureSettings GetSettings() const;
+  bool IsEnabled() const;
+  void SetExposureLimits(double minExposureUs, double maxExposureUs);
+
+  // Meters bracket entry `slot`, shot at `exposureUs`, and updates
+  // `exposures` in place. Returns false, leaving it untouched, when nothing
+  // moved by more than the deadband.
+  bool Update(const LuminanceHistogram& histogram, size_t slot,
+              double exposureUs, std::vector<double>& exposures) const;
+
+ private:
+  mutable std::mutex m_mutex;
+  AutoExposureSettings m_settings;
+  double m_min_exposure_us = 1.0;
+  double m_max_exposure_us = 1e6;
+};
+
+#endif  // AUTO_EXPOSURE_CONTROLLER_H_
@@ -0,0 +1,495 @@
+// Runs the capture pipeline's GPU chain (upload, unpack, demosaic, HDR
+// fusion, tone mapping) on synthetic frames, on a headless EGL context, and
+// prints fps, per-stage GPU time and CPU time per frame as JSON.
+//
+// Frames come from a SyntheticFrameSource, whose output depends only on its
+// size, format and exposure, so runs on different commits process the same
+// input. Mesa's llvmpipe is enough to run it without a GPU.
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GLES3/gl3.h>
+#include <time.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "frame_processor.h"
+#include "gl_utils.h"
+#include "gpu_timer.h"
+#include "synthetic_frame_source.h"
+
+// Few enough for llvmpipe to get through every default case in minutes
+#define BENCHMARK_DEFAULT_FRAMES 100
+#define BENCHMARK_DEFAULT_WARMUP_FRAMES 10
+// Shortest to longest exposure of the default bracket, in us
+#define BENCHMARK_MIN_EXPOSURE_US 2000.0
+#define BENCHMARK_MAX_EXPOSURE_US 16000.0
+// Frame interval the tone mapping's adaptation sees, as from a 60 fps camera
+#define BENCHMARK_FRAME_SECONDS (1.0f / 60.0f)
+
+struct BenchmarkOptions {
+  std::vector<std::pair<int, int>> sizes = {
+      {640, 480}, {1280, 720}, {1920, 1080}};
+  std::vector<Pylon::EPixelType> formats = {
+      Pylon::PixelType_Mono8, Pylon::PixelType_RGB8packed,
+      Pylon::PixelType_BayerRG8, Pylon::PixelType_Mono12p,
+      Pylon::PixelType_BayerRG12p};
+  size_t bracketSize = 2;
+  size_t uploadRingDepth = PBO_UPLOAD_RING_DEPTH;
+  int frames = BENCHMARK_DEFAULT_FRAMES;
+  int warmupFrames = BENCHMARK_DEFAULT_WARMUP_FRAMES;
+  GLenum intermediateFormat = GL_RGBA16F;
+  GLenum displayFormat = GL_RGB8;
+  ToneMappingOperator toneOperator = ToneMappingOperator::Reinhard;
+  DemosaicAlgorithm demosaicAlgorithm = DemosaicAlgorithm::MalvarHeCutler;
+  // Free-form tag of the run, e.g. the commit, copied to the output
+  std::string label;
+  std::string outputPath;
+};
+
+struct BenchmarkResult {
+  int width = 0;
+  int height = 0;
+  std::string format;
+  std::string intermediateFormat;
+  std::string displayFormat;
+  double fps = 0.0;
+  double wallMsPerFrame = 0.0;
+  // CPU time of the thread driving GL, which excludes the driver's own
+  // worker threads (llvmpipe rasterizes on those)
+  double cpuMsPerFrame = 0.0;
+  double gpuMsPerFrame = 0.0;
+  std::vector<std::pair<std::string, double>> gpuStageMs;
+};
+
+static const Pylon::EPixelType kFormats[] = {
+    Pylon::PixelType_Mono8,      Pylon::PixelType_Mono12p,
+    Pylon::PixelType_RGB8packed, Pylon::PixelType_BayerRG8,
+    Pylon::PixelType_BayerGB8,   Pylon::PixelType_BayerRG12p,
+    Pylon::PixelType_BayerGB12p,
+};
+
+static const GLenum kRenderFormats[] = {GL_RGBA16F, GL_RGB10_A2, GL_RGBA8,
+                                        GL_RGB8};
+
+static const char* GetPixelTypeName(Pylon::EPixelType pixelType) {
+  switch (pixelType) {
+    case Pylon::PixelType_Mono8:
+      return "Mono8";
+    case Pylon::PixelType_Mono12p:
+      return "Mono12p";
+    case Pylon::PixelType_RGB8packed:
+      return "RGB8";
+    case Pylon::PixelType_BayerRG8:
+      return "BayerRG8";
+    case Pylon::PixelType_BayerGB8:
+      return "BayerGB8";
+    case Pylon::PixelType_BayerRG12p:
+      return "BayerRG12p";
+    case Pylon::PixelType_BayerGB12p:
+      return "BayerGB12p";
+    default:
+      return "unknown";
+  }
+}
+
+static std::vector<std::string> Split(const std::string& list) {
+  std::vector<std::string> items;
+  std::istringstream stream(list);
+  std::string item;
+  while (std::getline(stream, item, ',')) {
+    if (!item.empty()) {
+      items.push_back(item);
+    }
+  }
+  return items;
+}
+
+static bool ParseRenderFormat(const std::string& name, GLenum& format) {
+  for (GLenum candidate : kRenderFormats) {
+    if (name == GetFormatName(candidate)) {
+      format = candidate;
+      return true;
+    }
+  }
+  return false;
+}
+
+static void PrintUsage() {
+  std::cerr
+      << "Usage: capture_benchmark [options]\n"
+         "  --sizes WxH,...        frame sizes (640x480,1280x720,1920x1080)\n"
+         "  --formats NAME,...     Mono8, Mono12p, RGB8, BayerRG8, BayerGB8,\n"
+         "                         BayerRG12p, BayerGB12p (all but GB)\n"
+         "  --bracket N            exposures per fused frame (2)\n"
+         "  --upload-slots N       PBO upload ring depth (3)\n"
+         "  --frames N             measured frames per case (100)\n"
+         "  --warmup N             frames run before measuring (10)\n"
+         "  --intermediate FORMAT  RGBA16F, RGB10_A2 or RGBA8 (RGBA16F)\n"
+         "  --display FORMAT       RGBA16F, RGB10_A2, RGBA8 or RGB8 (RGB8)\n"
+         "  --tone-mapping OP      none, reinhard or aces (reinhard)\n"
+         "  --demosaic ALGORITHM   bilinear or malvar (malvar)\n"
+         "  --label TEXT           tag copied to the output, e.g. a commit\n"
+         "  --output PATH          write the JSON there instead of stdout\n";
+}
+
+// Returns false, after printing why, on an unknown or malformed option.
+static bool ParseOptions(int argc, char** argv, BenchmarkOptions& options) {
+  for (int i = 1; i < argc; ++i) {
+    const std::string option = argv[i];
+    if (option == "--help" || i + 1 >= argc) {
+      PrintUsage();
+      return false;
+    }
+    const std::string value = argv[++i];
+    bool valid = true;
+    if (option == "--sizes") {
+      options.sizes.clear();
+      for (const std::string& size : Split(value)) {
+        int width = 0;
+        int height = 0;
+        valid = valid &&
+                std::sscanf(size.c_str(), "%dx%d", &width, &height) == 2 &&
+                width > 0 && height > 0;
+        options.sizes.emplace_back(width, height);
+      }
+      valid = valid && !options.sizes.empty();
+    } else if (option == "--formats") {
+      options.formats.clear();
+      for (const std::string& name : Split(value)) {
+        const size_t before = options.formats.size();
+        for (Pylon::EPixelType format : kFormats) {
+          if (name == GetPixelTypeName(format)) {
+            options.formats.push_back(format);
+          }
+        }
+        valid = valid && options.formats.size() > before;
+      }
+      valid = valid && !options.formats.empty();
+    } else if (option == "--bracket") {
+      const int size = std::atoi(value.c_str());
+      valid = size >= 1 && size <= SYNTHETIC_FRAME_CACHE_SIZE;
+      options.bracketSize = static_cast<size_t>(size);
+    } else if (option == "--upload-slots") {
+      const int depth = std::atoi(value.c_str());
+      valid = depth >= 1 && depth <= PBO_UPLOAD_RING_MAX_DEPTH;
+      options.uploadRingDepth = static_cast<size_t>(depth);
+    } else if (option == "--frames") {
+      options.frames = std::atoi(value.c_str());
+      valid = options.frames > 0;
+    } else if (option == "--warmup") {
+      options.warmupFrames = std::atoi(value.c_str());
+      valid = options.warmupFrames >= 0;
+    } else if (option == "--intermediate") {
+      valid = ParseRenderFormat(value, options.intermediateFormat) &&
+              options.intermediateFormat != GL_RGB8;
+    } else if (option == "--display") {
+      valid = ParseRenderFormat(value, options.displayFormat);
+    } else if (option == "--tone-mapping") {
+      if (value == "none") {
+        options.toneOperator = ToneMappingOperator::None;
+      } else if (value == "reinhard") {
+        options.toneOperator = ToneMappingOperator::Reinhard;
+      } else if (value == "aces") {
+        options.toneOperator = ToneMappingOperator::AcesFilmic;
+      } else {
+        valid = false;
+      }
+    } else if (option == "--demosaic") {
+      if (value == "bilinear") {
+        options.demosaicAlgorithm = DemosaicAlgorithm::Bilinear;
+      } else if (value == "malvar") {
+        options.demosaicAlgorithm = DemosaicAlgorithm::MalvarHeCutler;
+      } else {
+        valid = false;
+      }
+    } else if (option == "--label") {
+      options.label = value;
+    } else if (option == "--output") {
+      options.outputPath = value;
+    } else {
+      valid = false;
+    }
+    if (!valid) {
+      std::cerr << "Invalid " << option << ": " << value << std::endl;
+      PrintUsage();
+      return false;
+    }
+  }
+  return true;
+}
+
+// Makes a GLES 3 context current without a window: on Mesa's surfaceless
+// platform where available, otherwise on the default display, with a 1x1
+// pbuffer if the context cannot be made current without a surface.
+static bool CreateHeadlessContext() {
+  EGLDisplay display = EGL_NO_DISPLAY;
+  const char* clientExtensions =
+      eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+  auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+      eglGetProcAddress("eglGetPlatformDisplayEXT"));
+  if (clientExtensions && getPlatformDisplay &&
+      std::strstr(clientExtensions, "EGL_MESA_platform_surfaceless")) {
+    display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA,
+                                 EGL_DEFAULT_DISPLAY, nullptr);
+  }
+  if (display == EGL_NO_DISPLAY) {
+    display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+  }
+  EGLint major = 0;
+  EGLint minor = 0;
+  if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor) ||
+      !eglBindAPI(EGL_OPENGL_ES_API)) {
+    std::cerr << "Failed to initialize EGL: 0x" << std::hex << eglGetError()
+              << std::endl;
+    return false;
+  }
+
+  const EGLint configAttributes[] = {
+      EGL_SURFACE_TYPE,    EGL_PBUFFER_BIT,      EGL_RENDERABLE_TYPE,
+      EGL_OPENGL_ES3_BIT,  EGL_NONE,
+  };
+  EGLConfig config = nullptr;
+  EGLint configCount = 0;
+  eglChooseConfig(display, configAttributes, &config, 1, &configCount);
+  const EGLint contextAttributes[] = {EGL_CONTEXT_MAJOR_VERSION, 3, EGL_NONE};
+  EGLContext context =
+      eglCreateContext(display, configCount ? config : EGL_NO_CONFIG_KHR,
+                       EGL_NO_CONTEXT, contextAttributes);
+  if (context == EGL_NO_CONTEXT) {
+    std::cerr << "Failed to create a GLES 3 context: 0x" << std::hex
+              << eglGetError() << std::endl;
+    return false;
+  }
+
+  if (eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context)) {
+    return true;
+  }
+  const EGLint pbufferAttributes[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+  EGLSurface surface =
+      configCount ? eglCreatePbufferSurface(display, config, pbufferAttributes)
+                  : EGL_NO_SURFACE;
+  if (surface == EGL_NO_SURFACE ||
+      !eglMakeCurrent(display, surface, surface, context)) {
+    std::cerr << "Failed to make the context current: 0x" << std::hex
+              << eglGetError() << std::endl;
+    return false;
+  }
+  return true;
+}
+
+static double GetThreadCpuMs() {
+  timespec time;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+  return time.tv_sec * 1e3 + time.tv_nsec / 1e6;
+}
+
+// Exposures spaced evenly in stops between the shortest and longest
+static std::vector<double> GetBracket(size_t size) {
+  std::vector<double> exposuresUs;
+  for (size_t i = 0; i < size; ++i) {
+    const double t = size > 1 ? static_cast<double>(i) / (size - 1) : 0.5;
+    exposuresUs.push_back(
+        BENCHMARK_MIN_EXPOSURE_US *
+        std::pow(BENCHMARK_MAX_EXPOSURE_US / BENCHMARK_MIN_EXPOSURE_US, t));
+  }
+  return exposuresUs;
+}
+
+// Returns false, after printing why, when the case cannot run.
+static bool RunCase(const BenchmarkOptions& options, int width, int height,
+                    Pylon::EPixelType format, BenchmarkResult& result) {
+  SyntheticFrameSource source(width, height, 0.0);
+  if (!source.SetPixelType(format)) {
+    std::cerr << "Unsupported format " << GetPixelTypeName(format)
+              << std::endl;
+    return false;
+  }
+  source.Start();
+  const std::vector<double> exposuresUs = GetBracket(options.bracketSize);
+
+  const GLenum intermediateFormat =
+      ResolveRenderFormat(options.intermediateFormat);
+  const GLenum displayFormat = ResolveRenderFormat(options.displayFormat);
+  FrameProcessor processor(intermediateFormat, options.uploadRingDepth);
+  GLuint target = 0;
+  glGenTextures(1, &target);
+  glBindTexture(GL_TEXTURE_2D, target);
+  glTexStorage2D(GL_TEXTURE_2D, 1, displayFormat, width, height);
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  bool uploaded = true;
+  auto runFrame = [&](int frame, GpuTimer& timer) {
+    const size_t slot = static_cast<size_t>(frame) % exposuresUs.size();
+    source.Trigger(exposuresUs[slot], 0.0);
+    SourceFrame image;
+    source.Retrieve(image, std::chrono::milliseconds(0));
+    uploaded = uploaded &&
+               processor.Upload(image, slot, exposuresUs.size(),
+                                exposuresUs[slot], 0.0,
+                                options.demosaicAlgorithm, timer);
+    processor.Render(target, width, height, options.toneOperator, 0.0f, 0.5f,
+                     BENCHMARK_FRAME_SECONDS, timer);
+    timer.EndFrame();
+  };
+
+  // Compiles shaders, allocates every texture and renders the bracket's
+  // frames once, none of which a running stream pays per frame.
+  {
+    GpuTimer warmupTimer;
+    for (int frame = 0; frame < options.warmupFrames; ++frame) {
+      runFrame(frame, warmupTimer);
+    }
+    glFinish();
+  }
+
+  GpuTimer timer;
+  const double cpuStartMs = GetThreadCpuMs();
+  const auto start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < options.frames; ++frame) {
+    runFrame(frame, timer);
+  }
+  glFinish();
+  const double wallMs = std::chrono::duration<double, std::milli>(
+                            std::chrono::steady_clock::now() - start)
+                            .count();
+  const double cpuMs = GetThreadCpuMs() - cpuStartMs;
+  // Collects the queries still in flight.
+  for (int i = 0; i < GPU_TIMER_LATENCY; ++i) {
+    timer.EndFrame();
+  }
+  glDeleteTextures(1, &target);
+  if (!uploaded) {
+    return false;
+  }
+
+  result.width = width;
+  result.height = height;
+  result.format = GetPixelTypeName(format);
+  result.intermediateFormat = GetFormatName(intermediateFormat);
+  result.displayFormat = GetFormatName(displayFormat);
+  result.fps = options.frames / (wallMs / 1e3);
+  result.wallMsPerFrame = wallMs / options.frames;
+  result.cpuMsPerFrame = cpuMs / options.frames;
+  for (const std::string& stage : timer.GetStageNames()) {
+    const double ms = timer.GetStageMeanMs(stage.c_str());
+    result.gpuStageMs.emplace_back(stage, ms);
+    result.gpuMsPerFrame += ms;
+  }
+  return true;
+}
+
+static std::string ToJsonString(const std::string& text) {
+  std::string json = "\"";
+  for (char c : text) {
+    if (c == '"' || c == '\\') {
+      json += '\\';
+      json += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char escaped[8];
+      std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+      json += escaped;
+    } else {
+      json += c;
+    }
+  }
+  return json + "\"";
+}
+
+static const char* GetGLString(GLenum name) {
+  const GLubyte* value = glGetString(name);
+  return value ? reinterpret_cast<const char*>(value) : "";
+}
+
+static void WriteJson(std::ostream& out, const BenchmarkOptions& options,
+                      bool gpuTimerSupported,
+                      const std::vector<BenchmarkResult>& results) {
+  out << "{\n"
+      << "  \"label\": " << ToJsonString(options.label) << ",\n"
+      << "  \"renderer\": " << ToJsonString(GetGLString(GL_RENDERER)) << ",\n"
+      << "  \"gl_version\": " << ToJsonString(GetGLString(GL_VERSION))
+      << ",\n"
+      << "  \"gpu_timer\": " << (gpuTimerSupported ? "true" : "false")
+      << ",\n"
+      << "  \"frames\": " << options.frames << ",\n"
+      << "  \"warmup_frames\": " << options.warmupFrames << ",\n"
+      << "  \"bracket_size\": " << options.bracketSize << ",\n"
+      << "  \"upload_ring_depth\": " << options.uploadRingDepth << ",\n"
+      << "  \"results\": [";
+  for (size_t i = 0; i < results.size(); ++i) {
+    const BenchmarkResult& result = results[i];
+    out << (i ? "," : "") << "\n    {\n"
+        << "      \"width\": " << result.width << ",\n"
+        << "      \"height\": " << result.height << ",\n"
+        << "      \"format\": " << ToJsonString(result.format) << ",\n"
+        << "      \"intermediate_format\": "
+        << ToJsonString(result.intermediateFormat) << ",\n"
+        << "      \"display_format\": " << ToJsonString(result.displayFormat)
+        << ",\n"
+        << "      \"fps\": " << result.fps << ",\n"
+        << "      \"wall_ms_per_frame\": " << result.wallMsPerFrame << ",\n"
+        << "      \"cpu_ms_per_frame\": " << result.cpuMsPerFrame << ",\n"
+        << "      \"gpu_ms_per_frame\": " << result.gpuMsPerFrame << ",\n"
+        << "      \"gpu_stage_ms\": {";
+    for (size_t j = 0; j < result.gpuStageMs.size(); ++j) {
+      out << (j ? ", " : "") << ToJsonString(result.gpuStageMs[j].first)
+          << ": " << result.gpuStageMs[j].second;
+    }
+    out << "}\n    }";
+  }
+  out << "\n  ]\n}\n";
+}
+
+int main(int argc, char** argv) {
+  // The passes log to std::cout: keep stdout for the JSON.
+  std::ostream stdoutStream(std::cout.rdbuf(std::cerr.rdbuf()));
+  BenchmarkOptions options;
+  if (!ParseOptions(argc, argv, options)) {
+    return 2;
+  }
+  if (!CreateHeadlessContext()) {
+    return 1;
+  }
+  std::cerr << "Renderer: " << GetGLString(GL_RENDERER) << std::endl;
+
+  bool gpuTimerSupported = false;
+  {
+    GpuTimer probe;
+    gpuTimerSupported = probe.IsSupported();
+  }
+  std::vector<BenchmarkResult> results;
+  bool failed = false;
+  for (const auto& size : options.sizes) {
+    for (Pylon::EPixelType format : options.formats) {
+      std::cerr << "Running " << size.first << "x" << size.second << " "
+                << GetPixelTypeName(format) << "..." << std::endl;
+      BenchmarkResult result;
+      if (!RunCase(options, size.first, size.second, format, result)) {
+        failed = true;
+        continue;
+      }
+      results.push_back(result);
+    }
+  }
+
+  if (options.outputPath.empty()) {
+    WriteJson(stdoutStream, options, gpuTimerSupported, results);
+  } else {
+    std::ofstream file(options.outputPath);
+    WriteJson(file, options, gpuTimerSupported, results);
+    if (!file) {
+      std::cerr << "Failed to write " << options.outputPath << std::endl;
+      return 1;
+    }
+  }
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,77 @@
+#include "burst_capture.h"
+
+#include <cstring>
+#include <stdexcept>
+
+BurstCapture::BurstCapture(size_t count, size_t frameBytes)
+    : m_requested(std::chrono::steady_clock::now()),
+      m_frames(count),
+      m_promises(count),
+      m_timestamps(count) {
+  // Sized now, on the caller, so no page is first touched at frame rate.
+  for (StillFrame& frame : m_frames) {
+    frame.pixels.resize(frameBytes);
+  }
+}
+
+std::vector<std::future<StillFrame>> BurstCapture::GetFrames() {
+  std::vector<std::future<StillFrame>> frames;
+  frames.reserve(m_promises.size());
+  for (std::promise<StillFrame>& promise : m_promises) {
+    frames.push_back(promise.get_future());
+  }
+  return frames;
+}
+
+bool BurstCapture::Push(const SourceFrame& image,
+                        std::chrono::steady_clock::time_point timestamp) {
+  if (m_done) {
+    return true;
+  }
+  StillFrame& frame = m_frames[m_filled];
+  const size_t size = image.size;
+  // The payload may carry chunks after the image: shrinking keeps the
+  // buffer, only a grown region of interest reallocates.
+  frame.pixels.resize(size);
+  std::memcpy(frame.pixels.data(), image.pixels, size);
+  frame.width = image.width;
+  frame.height = image.height;
+  frame.bytesPerRow = size / frame.height;
+  frame.raw = true;
+  frame.pixelType = image.pixelType;
+  frame.paddingX = image.paddingX;
+  frame.timestamp = timestamp;
+  m_timestamps[m_filled] = timestamp;
+  if (++m_filled < m_frames.size()) {
+    return false;
+  }
+
+  m_done = true;
+  for (size_t i = 0; i < m_frames.size(); ++i) {
+    m_promises[i].set_value(std::move(m_frames[i]));
+  }
+  return true;
+}
+
+void BurstCapture::Cancel() {
+  if (m_done) {
+    return;
+  }
+  m_done = true;
+  for (std::promise<StillFrame>& promise : m_promises) {
+    promise.set_exception(std::make_exception_ptr(
+        std::runtime_error("Grabbing stopped before the burst completed")));
+  }
+}
+
+std::vector<int64_t> BurstCapture::GetTimestampsUs() const {
+  std::vector<int64_t> timestampsUs;
+  timestampsUs.reserve(m_timestamps.size());
+  for (const auto& timestamp : m_timestamps) {
+    timestampsUs.push_back(
+        std::chrono::duration_cast<std::chrono::microseconds>(timestamp -
+                                                              m_requested)
+            .count());
+  }
+  return timestampsUs;
+}
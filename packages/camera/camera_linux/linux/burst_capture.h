@@ -0,0 +1,68 @@
+#ifndef BURST_CAPTURE_H_
+#define BURST_CAPTURE_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <string>
+#include <vector>
+
+#include "frame_source.h"
+#include "zsl_ring.h"
+
+// Frame bytes a burst may hold in memory until it is written
+#define BURST_MAX_BYTES (1024 * 1024 * 1024)
+// How long each frame of a burst may take to arrive
+#define BURST_FRAME_TIMEOUT_MS 1000
+
+// Runs on the GLib main loop once a burst is written, with an empty
+// `error` on success. Timestamps are in microseconds after the request.
+using BurstCallback =
+    std::function<void(const std::vector<std::string>& paths,
+                       const std::vector<int64_t>& timestampsUs,
+                       const std::string& error)>;
+
+// The next few frames of the stream, kept raw in host memory.
+//
+// Frame buffers are allocated up front, so the acquisition thread only
+// copies each grab into the next one and keeps up with the sensor. The
+// frames are handed over together once the last is in, leaving the
+// encoding to run afterwards without competing with the capture.
+class BurstCapture {
+ public:
+  // Allocates `count` frames of `frameBytes`, the camera's payload size.
+  BurstCapture(size_t count, size_t frameBytes);
+
+  BurstCapture(const BurstCapture&) = delete;
+  BurstCapture& operator=(const BurstCapture&) = delete;
+
+  size_t GetCount() const { return m_frames.size(); }
+
+  // One future per frame, in capture order, all ready once the burst is
+  // complete. Call once, before the burst starts.
+  std::vector<std::future<StillFrame>> GetFrames();
+
+  // Acquisition thread. Copies a retrieved frame into the next buffer and
+  // returns true once it was the last.
+  bool Push(const SourceFrame& image,
+            std::chrono::steady_clock::time_point timestamp);
+
+  // Fails the frames of a burst cut short by the stream stopping.
+  void Cancel();
+
+  // Microseconds from the request to each frame's retrieval. Valid once
+  // the frames are ready.
+  std::vector<int64_t> GetTimestampsUs() const;
+
+ private:
+  const std::chrono::steady_clock::time_point m_requested;
+  std::vector<StillFrame> m_frames;
+  std::vector<std::promise<StillFrame>> m_promises;
+  std::vector<std::chrono::steady_clock::time_point> m_timestamps;
+  size_t m_filled = 0;
+  bool m_done = false;
+};
+
+#endif  // BURST_CAPTURE_H_
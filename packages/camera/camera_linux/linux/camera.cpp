@@ -1,14 +1,59 @@
 #include "camera.h"
 
-#include <opencv2/opencv.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <future>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
 #include <thread>
 
 #include "capture_pipeline.h"
+#include "pylon_frame_source.h"
+
+static Pylon::EPixelType GetPixelType(
+    CameraLinuxPlatformImageFormatGroup imageFormatGroup) {
+  switch (imageFormatGroup) {
+    case CameraLinuxPlatformImageFormatGroup::
+        CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_MONO8:
+      return Pylon::PixelType_Mono8;
+    case CameraLinuxPlatformImageFormatGroup::
+        CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_BAYER_RG8:
+      return Pylon::PixelType_BayerRG8;
+    case CameraLinuxPlatformImageFormatGroup::
+        CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_BAYER_GB8:
+      return Pylon::PixelType_BayerGB8;
+    case CameraLinuxPlatformImageFormatGroup::
+        CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_MONO12P:
+      return Pylon::PixelType_Mono12p;
+    case CameraLinuxPlatformImageFormatGroup::
+        CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_BAYER_RG12P:
+      return Pylon::PixelType_BayerRG12p;
+    case CameraLinuxPlatformImageFormatGroup::
+        CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_BAYER_GB12P:
+      return Pylon::PixelType_BayerGB12p;
+    case CameraLinuxPlatformImageFormatGroup::
+        CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_RGB8:
+    default:
+      return Pylon::PixelType_RGB8packed;
+  }
+}
 
 Camera::Camera(Pylon::IPylonDevice* device, int64_t camera_id,
                FlPluginRegistrar* registrar,
                CameraLinuxPlatformResolutionPreset resolution_preset)
+    : Camera(std::unique_ptr<FrameSource>(), camera_id, registrar,
+             resolution_preset) {
+  camera = std::make_unique<Pylon::CInstantCamera>(device);
+  frameSource = std::make_unique<PylonFrameSource>(*camera);
+}
+
+Camera::Camera(std::unique_ptr<FrameSource> frameSource, int64_t camera_id,
+               FlPluginRegistrar* registrar,
+               CameraLinuxPlatformResolutionPreset resolution_preset)
     : camera_id(camera_id),
+      frameSource(std::move(frameSource)),
       cameraLinuxCameraEventApi(camera_linux_camera_event_api_new(
           fl_plugin_registrar_get_messenger(registrar),
           std::to_string(camera_id).c_str())),
@@ -22,13 +67,17 @@ Camera::Camera(Pylon::IPylonDevice* device, int64_t camera_id,
                            CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_RGB8),
       resolution_preset(resolution_preset),
       registrar(registrar) {
-  camera = std::make_unique<Pylon::CInstantCamera>(device);
+  stillEncoder = std::make_unique<StillEncoder>(
+      STILL_ENCODER_THREAD_COUNT, STILL_ENCODER_MAX_QUEUED_BYTES);
+  burstEncoder = std::make_unique<StillEncoder>(
+      std::max(1u, std::thread::hardware_concurrency()), BURST_MAX_BYTES);
   setResolutionPreset(resolution_preset);
   if (registrar) g_object_ref(registrar);
 }
 
 Camera::~Camera() {
-  if (capturePipeline && camera) camera->StopGrabbing();
+  if (imageStream) imageStream->Close();
+  if (capturePipeline && frameSource) frameSource->Stop();
   if (camera) {
     if (camera->IsGrabbing()) camera->StopGrabbing();
     if (camera->IsOpen()) camera->Close();
@@ -40,6 +89,23 @@ Camera::~Camera() {
 void Camera::initialize(CameraLinuxPlatformImageFormatGroup imageFormat) {
   imageFormatGroup = imageFormat;
   capturePipeline = std::make_unique<CapturePipeline>(*this, registrar);
+  if (camera) {
+    openDevice(imageFormat);
+  } else if (!frameSource->SetPixelType(GetPixelType(imageFormat))) {
+    // A replay delivers the format it was recorded in.
+    std::cout << "[DEBUG] Frame source keeps its own pixel format."
+              << std::endl;
+  }
+  // The camera may round the requested size; other sources have their own.
+  if (frameSource->GetWidth() > 0 && frameSource->GetHeight() > 0) {
+    width = frameSource->GetWidth();
+    height = frameSource->GetHeight();
+  }
+  capturePipeline->StartGrabbing();
+  emitState();
+}
+
+void Camera::openDevice(CameraLinuxPlatformImageFormatGroup imageFormat) {
   if (camera->IsOpen()) {
     camera->Close();
   }
@@ -52,6 +118,8 @@ void Camera::initialize(CameraLinuxPlatformImageFormatGroup imageFormat) {
       .TrySetValue(true);
   Pylon::CFloatParameter(nodemap, "AcquisitionFrameRate").TrySetValue(60.0);
   Pylon::CFloatParameter(nodemap, "ResultingFrameRate").TrySetValue(60.0);
+  // Also sizes the capture pipeline's grab buffer pool.
+  camera->MaxNumBuffer.TrySetValue(grabBufferCount);
   setImageFormatGroup(imageFormat);
   Pylon::CIntegerParameter(nodemap, "Width").TrySetValue(width);
   Pylon::CIntegerParameter(nodemap, "Height").TrySetValue(height);
@@ -66,26 +134,17 @@ void Camera::initialize(CameraLinuxPlatformImageFormatGroup imageFormat) {
   Pylon::CEnumParameter(nodemap, "BslDefectPixelCorrectionMode")
       .TrySetValue("On");
 
-  capturePipeline->StartGrabbing();
-  emitState();
 }
 
 void Camera::setImageFormatGroup(
     CameraLinuxPlatformImageFormatGroup imageFormatGroup) {
-  CAMERA_CONFIG_LOCK({
-    GenApi::INodeMap& nodemap = camera->GetNodeMap();
-    switch (imageFormatGroup) {
-      case CameraLinuxPlatformImageFormatGroup::
-          CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_MONO8:
-        Pylon::CEnumParameter(nodemap, "PixelFormat").SetValue("Mono8");
-        break;
-      case CameraLinuxPlatformImageFormatGroup::
-          CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_RGB8:
-      default:
-        Pylon::CEnumParameter(nodemap, "PixelFormat").SetValue("RGB8");
-        break;
-    }
-  });
+  const Pylon::EPixelType pixelType = GetPixelType(imageFormatGroup);
+  bool supported = true;
+  CAMERA_CONFIG_LOCK({ supported = frameSource->SetPixelType(pixelType); });
+  // Outside the lock, which restarts the stream either way.
+  if (!supported) {
+    throw std::invalid_argument("Image format not supported by the camera");
+  }
 }
 
 int64_t Camera::getTextureId() {
@@ -93,34 +152,124 @@ int64_t Camera::getTextureId() {
   return capturePipeline->get_texture_id();
 }
 
-void Camera::takePicture(std::string filePath) {
-  CAMERA_CONFIG_LOCK(
-      Pylon::CGrabResultPtr grabResult;
+void Camera::takePicture(std::string filePath, StillCallback done) {
+  // Frames are at most RGBA: count that against the encoder's cap.
+  const size_t frameBytes = static_cast<size_t>(width) * height * 4;
+  if (!stillEncoder->HasRoomFor(frameBytes)) {
+    throw std::runtime_error("Too many pictures in flight");
+  }
 
-      if (camera->IsGrabbing()) { camera->StopGrabbing(); }
+  // Zero shutter lag: take the frame closest to now from the running
+  // stream, without stopping it.
+  if (zslFrameCount > 0 && capturePipeline && frameSource &&
+      frameSource->IsGrabbing()) {
+    stillEncoder->Submit(
+        capturePipeline->CaptureStill(std::chrono::steady_clock::now()),
+        frameBytes, std::move(filePath), jpegSettings,
+        std::chrono::milliseconds(ZSL_CAPTURE_TIMEOUT_MS), std::move(done));
+    return;
+  }
 
-      if (!camera->GrabOne(Pylon::INFINITE, grabResult,
-                           Pylon::TimeoutHandling_Return)) {
-        std::cerr << "Failed to grab image within timeout." << std::endl;
-        return;
-      }
+  if (!camera) {
+    throw std::runtime_error("Pictures need zero shutter lag without a camera");
+  }
+  std::promise<StillFrame> grabbed;
+  CAMERA_CONFIG_LOCK({
+    Pylon::CGrabResultPtr grabResult;
+    if (camera->IsGrabbing()) {
+      camera->StopGrabbing();
+    }
+    if (camera->GrabOne(Pylon::INFINITE, grabResult,
+                        Pylon::TimeoutHandling_Return) &&
+        grabResult.IsValid() && grabResult->GrabSucceeded()) {
+      // The grab buffer goes back to the camera on restart: copy it.
+      const uint8_t* buffer =
+          static_cast<const uint8_t*>(grabResult->GetBuffer());
+      StillFrame still;
+      still.pixels.assign(buffer, buffer + grabResult->GetImageSize());
+      still.width = static_cast<int>(grabResult->GetWidth());
+      still.height = static_cast<int>(grabResult->GetHeight());
+      still.bytesPerRow = grabResult->GetImageSize() / still.height;
+      still.raw = true;
+      still.pixelType = grabResult->GetPixelType();
+      still.paddingX = grabResult->GetPaddingX();
+      still.timestamp = std::chrono::steady_clock::now();
+      grabbed.set_value(std::move(still));
+    } else {
+      std::cerr << "Failed to grab image." << std::endl;
+      grabbed.set_exception(
+          std::make_exception_ptr(std::runtime_error("Failed to grab image")));
+    }
+  });
+  stillEncoder->Submit(grabbed.get_future(), frameBytes, std::move(filePath),
+                       jpegSettings,
+                       std::chrono::milliseconds(ZSL_CAPTURE_TIMEOUT_MS),
+                       std::move(done));
+}
 
-      if (!grabResult.IsValid() || !grabResult->GrabSucceeded()) {
-        std::cerr << "Failed to grab image." << std::endl;
-        return;
-      };
-      Pylon::CPylonImage image; image.AttachGrabResultBuffer(grabResult);
-      bool isMono = image.GetPixelType() == Pylon::PixelType_Mono8 ||
-                    image.GetPixelType() == Pylon::PixelType_Mono12 ||
-                    image.GetPixelType() == Pylon::PixelType_Mono16;
+void Camera::takeBurst(int64_t count, const std::string& directory,
+                       BurstCallback done) {
+  if (count <= 0) {
+    throw std::invalid_argument("Burst count must be positive");
+  }
+  // Bursts come from the stream at the sensor's rate: GrabOne would be
+  // far slower.
+  if (!capturePipeline || !frameSource || !frameSource->IsGrabbing()) {
+    throw std::runtime_error("Camera is not streaming");
+  }
+  const size_t frameBytes = frameSource->GetPayloadSize();
+  if (frameBytes * static_cast<size_t>(count) > BURST_MAX_BYTES) {
+    throw std::runtime_error("Burst does not fit in memory");
+  }
+  if (!burstEncoder->HasRoomFor(frameBytes * count)) {
+    throw std::runtime_error("A burst is still being written");
+  }
 
-      cv::Mat mat(grabResult->GetHeight(), grabResult->GetWidth(),
-                  isMono ? CV_8UC1 : CV_8UC3, (uint8_t*)image.GetBuffer());
-      cv::Mat bgr;
-      cv::cvtColor(mat, bgr, isMono ? cv::COLOR_GRAY2BGR : cv::COLOR_RGB2BGR);
-      cv::imwrite(filePath, bgr);
+  auto burst = std::make_shared<BurstCapture>(count, frameBytes);
+  std::vector<std::future<StillFrame>> frames = burst->GetFrames();
+  capturePipeline->StartBurst(burst);
+
+  struct Progress {
+    std::vector<std::string> paths;
+    size_t remaining = 0;
+    std::string error;
+    std::shared_ptr<BurstCapture> burst;
+    BurstCallback done;
+  };
+  auto progress = std::make_shared<Progress>();
+  progress->remaining = frames.size();
+  progress->burst = burst;
+  progress->done = std::move(done);
+  for (size_t i = 0; i < frames.size(); ++i) {
+    std::ostringstream path;
+    path << directory << "/burst_" << std::setw(4) << std::setfill('0') << i
+         << ".jpg";
+    progress->paths.push_back(path.str());
+  }
 
-  );
+  // Every frame is ready at once, so the encoder's threads write them in
+  // parallel, each waiting at most for the whole burst to arrive.
+  const auto timeout = std::chrono::milliseconds(
+      ZSL_CAPTURE_TIMEOUT_MS + count * BURST_FRAME_TIMEOUT_MS);
+  for (size_t i = 0; i < frames.size(); ++i) {
+    burstEncoder->Submit(
+        std::move(frames[i]), frameBytes, progress->paths[i], jpegSettings,
+        timeout,
+        [progress](const std::string& error) {
+          if (!error.empty() && progress->error.empty()) {
+            progress->error = error;
+          }
+          if (--progress->remaining > 0) {
+            return;
+          }
+          if (!progress->error.empty()) {
+            progress->done({}, {}, progress->error);
+            return;
+          }
+          progress->done(progress->paths, progress->burst->GetTimestampsUs(),
+                         "");
+        });
+  }
 }
 
 void camera_linux_camera_event_api_initialized_callback(GObject* object,
@@ -148,154 +297,6 @@ void Camera::emitTextureId(int64_t textureId) const {
       camera_linux_camera_event_api_initialized_callback, nullptr);
 }
 
-// void Camera::startGrabbing() {
-//   GenApi::INodeMap& nodemap = camera->GetNodeMap();
-//   Pylon::CEnumParameter(nodemap, "TriggerSelector").SetValue("FrameStart");
-//   Pylon::CEnumParameter(nodemap, "TriggerMode").SetValue("On");
-//   Pylon::CEnumParameter(nodemap, "TriggerSource").SetValue("Software");
-
-//   // Manual grab loop with exposure bracketing
-//   cameraTextureImageEventHandler->OnImageEventHandlerRegistered(*camera);
-
-//   camera->StartGrabbing(Pylon::GrabStrategy_OneByOne,
-//                         Pylon::EGrabLoop::GrabLoop_ProvidedByUser);
-
-//   std::thread([this]() {
-//     double shortExposure = 1000.0;  // µs - initial value
-//     // double longExposure = 128000.0;  // µs
-//     // const double gain = 0.6;
-//     // const double targetBrightness = 120.0;  // target average
-//     // brightness
-
-//     // const double overblownTargetRatio = 0.01;  // 3%
-//     // const double overblownThreshold = 240.0;
-
-//     auto& nodemap = camera->GetNodeMap();
-//     // const double minExposure =
-//     //     Pylon::CFloatParameter(nodemap, "ExposureTime").GetMin();
-//     // const double maxExposure =
-//     //     Pylon::CFloatParameter(nodemap, "ExposureTime").GetMax();
-
-//     while (camera->IsGrabbing()) {
-//       // --- Short exposure ---
-//       Pylon::CFloatParameter(nodemap, "ExposureTime")
-//           .TrySetValue(shortExposure);
-//       camera->WaitForFrameTriggerReady(5000,
-//                                        Pylon::TimeoutHandling_ThrowException);
-//       camera->ExecuteSoftwareTrigger();
-
-//       Pylon::CGrabResultPtr shortResult;
-//       camera->RetrieveResult(5000, shortResult,
-//                              Pylon::TimeoutHandling_ThrowException);
-
-//       // if (shortResult && shortResult->GrabSucceeded()) {
-//       //   cameraTextureImageEventHandler->OnImageGrabbed(*camera,
-//       //   shortResult);
-
-//       //   // === Adjust short exposure for overblown % ===
-//       //   const int width = shortResult->GetWidth();
-//       //   const int height = shortResult->GetHeight();
-//       //   const uint8_t* buffer =
-//       //       static_cast<const uint8_t*>(shortResult->GetBuffer());
-
-//       //   const int cx = width / 2;
-//       //   const int cy = height / 2;
-//       //   const int radius = std::min(width, height) / 4;
-
-//       //   size_t overblown = 0;
-//       //   size_t total = 0;
-
-//       //   for (int y = 0; y < height; ++y) {
-//       //     for (int x = 0; x < width; ++x) {
-//       //       int dx = x - cx;
-//       //       int dy = y - cy;
-//       //       if (dx * dx + dy * dy <= radius * radius) {
-//       //         int index = (y * width + x) * 3;
-//       //         uint8_t r = buffer[index];
-//       //         uint8_t g = buffer[index + 1];
-//       //         uint8_t b = buffer[index + 2];
-//       //         double luminance = 0.299 * r + 0.587 * g + 0.114 * b;
-
-//       //         if (luminance >= overblownThreshold) {
-//       //           overblown++;
-//       //         }
-//       //         total++;
-//       //       }
-//       //     }
-//       //   }
-
-//       //   if (total > 0) {
-//       //     double ratio = static_cast<double>(overblown) / total;
-//       //     double error = overblownTargetRatio - ratio;
-
-//       //     // Adjust short exposure proportionally
-//       //     double proposed =
-//       //         shortExposure * (1.0 + gain * error /
-//       //         overblownTargetRatio);
-//       //     shortExposure =
-//       //         std::max(minExposure, std::min(maxExposure, proposed));
-//       //   }
-//       // }
-
-//       // // --- Long exposure ---
-//       // Pylon::CFloatParameter(nodemap,
-//       // "ExposureTime").TrySetValue(longExposure);
-//       // camera->WaitForFrameTriggerReady(5000,
-//       // Pylon::TimeoutHandling_ThrowException);
-//       // camera->ExecuteSoftwareTrigger();
-
-//       // Pylon::CGrabResultPtr longResult;
-//       // camera->RetrieveResult(5000, longResult,
-//       //                        Pylon::TimeoutHandling_ThrowException);
-//       // if (longResult && longResult->GrabSucceeded()) {
-//       //   cameraTextureImageEventHandler->OnImageGrabbed(*camera,
-//       //   longResult);
-
-//       //   // === Adjust long exposure brightness as before ===
-//       //   const int width = longResult->GetWidth();
-//       //   const int height = longResult->GetHeight();
-//       //   const uint8_t* buffer =
-//       //       static_cast<const uint8_t*>(longResult->GetBuffer());
-
-//       //   const int cx = width / 2;
-//       //   const int cy = height / 2;
-//       //   const int radius = std::min(width, height) / 4;
-
-//       //   uint64_t sum = 0;
-//       //   size_t count = 0;
-
-//       //   for (int y = 0; y < height; ++y) {
-//       //     for (int x = 0; x < width; ++x) {
-//       //       int dx = x - cx;
-//       //       int dy = y - cy;
-//       //       if (dx * dx + dy * dy <= radius * radius) {
-//       //         int index = (y * width + x) * 3;
-//       //         uint8_t r = buffer[index];
-//       //         uint8_t g = buffer[index + 1];
-//       //         uint8_t b = buffer[index + 2];
-//       //         double luminance = 0.299 * r + 0.587 * g + 0.114 * b;
-
-//       //         if (luminance > 10 && luminance < 240) {
-//       //           sum += luminance;
-//       //           count++;
-//       //         }
-//       //       }
-//       //     }
-//       //   }
-
-//       //   if (count > 0) {
-//       //     double avgBrightness = static_cast<double>(sum) / count;
-//       //     double error = targetBrightness - avgBrightness;
-//       //     double proposed =
-//       //         longExposure * (1.0 + gain * error / targetBrightness);
-//       //     longExposure = std::max(minExposure, std::min(maxExposure,
-//       //     proposed));
-//       //   }
-//       // }
-//     }
-//   }).detach();
-// }
-
 Camera& Camera::setResolutionPreset(
     CameraLinuxPlatformResolutionPreset preset) {
   switch (preset) {
@@ -336,6 +337,12 @@ Camera& Camera::setResolutionPreset(
 }
 
 void Camera::setExposureMode(CameraLinuxPlatformExposureMode mode) {
+  // Generated and replayed frames have no exposure control to switch.
+  if (!camera) {
+    exposure_mode = mode;
+    emitState();
+    return;
+  }
   CAMERA_CONFIG_LOCK({
     GenApi::INodeMap& nodemap = camera->GetNodeMap();
     switch (mode) {
@@ -359,6 +366,11 @@ void Camera::setExposureMode(CameraLinuxPlatformExposureMode mode) {
 }
 
 void Camera::setFocusMode(CameraLinuxPlatformFocusMode mode) {
+  if (!camera) {
+    focus_mode = mode;
+    emitState();
+    return;
+  }
   CAMERA_CONFIG_LOCK({
     GenApi::INodeMap& nodemap = camera->GetNodeMap();
     switch (mode) {
@@ -381,17 +393,318 @@ void Camera::setFocusMode(CameraLinuxPlatformFocusMode mode) {
   });
 }
 
+void Camera::setGrabBufferCount(int64_t count) {
+  const size_t bufferCount =
+      count > 0 ? static_cast<size_t>(count) : GRAB_BUFFER_POOL_SIZE;
+  if (count < 0 || bufferCount > GRAB_BUFFER_POOL_MAX_SIZE) {
+    throw std::invalid_argument("Grab buffer count must be between 0 and " +
+                                std::to_string(GRAB_BUFFER_POOL_MAX_SIZE));
+  }
+  // Queued frames hold grab buffers: leave the camera one to grab into.
+  if (bufferCount <= frameQueueCapacity) {
+    throw std::invalid_argument(
+        "Grab buffer count must exceed the frame queue capacity (" +
+        std::to_string(frameQueueCapacity) + ")");
+  }
+  // The pool is sized from MaxNumBuffer when the pipeline starts: restart
+  // it.
+  CAMERA_CONFIG_LOCK({
+    grabBufferCount = bufferCount;
+    if (camera) {
+      camera->MaxNumBuffer.TrySetValue(grabBufferCount);
+    }
+  });
+}
+
+void Camera::setUploadRingDepth(int64_t depth) {
+  const size_t slotCount =
+      depth > 0 ? static_cast<size_t>(depth) : PBO_UPLOAD_RING_DEPTH;
+  if (depth < 0 || slotCount > PBO_UPLOAD_RING_MAX_DEPTH) {
+    throw std::invalid_argument("Upload ring depth must be between 0 and " +
+                                std::to_string(PBO_UPLOAD_RING_MAX_DEPTH));
+  }
+  // The ring is allocated when the pipeline starts: restart it.
+  CAMERA_CONFIG_LOCK({ uploadRingDepth = slotCount; });
+}
+
+void Camera::setFrameQueuePolicy(CameraLinuxPlatformFrameQueuePolicy policy,
+                                 int64_t capacity) {
+  const size_t queueCapacity =
+      capacity > 0 ? static_cast<size_t>(capacity) : FRAME_QUEUE_CAPACITY;
+  // Queued frames hold grab buffers: leave the camera one to grab into.
+  if (capacity < 0 || queueCapacity >= grabBufferCount) {
+    throw std::invalid_argument(
+        "Frame queue capacity must be between 0 and " +
+        std::to_string(grabBufferCount - 1));
+  }
+  FrameQueueOverflowPolicy queuePolicy;
+  switch (policy) {
+    case CameraLinuxPlatformFrameQueuePolicy::
+        CAMERA_LINUX_PLATFORM_FRAME_QUEUE_POLICY_DROP_NEWEST:
+      queuePolicy = FrameQueueOverflowPolicy::DropNewest;
+      break;
+    case CameraLinuxPlatformFrameQueuePolicy::
+        CAMERA_LINUX_PLATFORM_FRAME_QUEUE_POLICY_BLOCK:
+      queuePolicy = FrameQueueOverflowPolicy::Block;
+      break;
+    case CameraLinuxPlatformFrameQueuePolicy::
+        CAMERA_LINUX_PLATFORM_FRAME_QUEUE_POLICY_DROP_OLDEST:
+    default:
+      queuePolicy = FrameQueueOverflowPolicy::DropOldest;
+      break;
+  }
+  // The queue is allocated when the pipeline starts: restart it.
+  CAMERA_CONFIG_LOCK({
+    frameQueuePolicy = queuePolicy;
+    frameQueueCapacity = queueCapacity;
+  });
+}
+
+void Camera::setExposureBracket(const std::vector<double>& exposuresUs,
+                                const std::vector<double>& gains) {
+  if (exposuresUs.empty() || exposuresUs.size() > MAX_EXPOSURE_BRACKET_SIZE) {
+    throw std::invalid_argument("Exposure bracket must hold 1 to " +
+                                std::to_string(MAX_EXPOSURE_BRACKET_SIZE) +
+                                " exposures");
+  }
+  if (!gains.empty() && gains.size() != exposuresUs.size()) {
+    throw std::invalid_argument("Expected one gain per exposure");
+  }
+  for (double exposureUs : exposuresUs) {
+    if (!std::isfinite(exposureUs) || exposureUs <= 0.0) {
+      throw std::invalid_argument("Exposures must be positive");
+    }
+  }
+  for (double gain : gains) {
+    if (!std::isfinite(gain)) {
+      throw std::invalid_argument("Gains must be finite");
+    }
+  }
+
+  std::vector<double> clampedUs = exposuresUs;
+  if (camera && camera->IsOpen()) {
+    Pylon::CFloatParameter exposureTime(camera->GetNodeMap(), "ExposureTime");
+    if (exposureTime.IsReadable()) {
+      for (double& exposureUs : clampedUs) {
+        exposureUs = std::clamp(exposureUs, exposureTime.GetMin(),
+                                exposureTime.GetMax());
+      }
+    }
+  }
+
+  exposureBracketUs = clampedUs;
+  exposureBracketGains = gains;
+  // No CAMERA_CONFIG_LOCK: the pipeline swaps the bracket between frames
+  // instead of restarting the stream.
+  if (capturePipeline) {
+    capturePipeline->SetExposureBracket(clampedUs, gains);
+  }
+}
+
+void Camera::setToneMapping(
+    CameraLinuxPlatformToneMappingOperator toneOperator, double key,
+    double adaptationSeconds) {
+  if (key < 0.0 || key > 1.0) {
+    throw std::invalid_argument("Tone mapping key must be within [0, 1]");
+  }
+  if (adaptationSeconds < 0.0) {
+    throw std::invalid_argument("Adaptation time must not be negative");
+  }
+  ToneMappingOperator pipelineOperator;
+  switch (toneOperator) {
+    case CameraLinuxPlatformToneMappingOperator::
+        CAMERA_LINUX_PLATFORM_TONE_MAPPING_OPERATOR_NONE:
+      pipelineOperator = ToneMappingOperator::None;
+      break;
+    case CameraLinuxPlatformToneMappingOperator::
+        CAMERA_LINUX_PLATFORM_TONE_MAPPING_OPERATOR_ACES_FILMIC:
+      pipelineOperator = ToneMappingOperator::AcesFilmic;
+      break;
+    case CameraLinuxPlatformToneMappingOperator::
+        CAMERA_LINUX_PLATFORM_TONE_MAPPING_OPERATOR_REINHARD:
+    default:
+      pipelineOperator = ToneMappingOperator::Reinhard;
+      break;
+  }
+  toneMappingOperator = pipelineOperator;
+  toneMappingKey = static_cast<float>(key);
+  toneMappingAdaptationSeconds = static_cast<float>(adaptationSeconds);
+  if (capturePipeline) {
+    capturePipeline->SetToneMapping(toneMappingOperator, toneMappingKey,
+                                    toneMappingAdaptationSeconds);
+  }
+}
+
+void Camera::setDemosaicAlgorithm(
+    CameraLinuxPlatformDemosaicAlgorithm algorithm) {
+  demosaicAlgorithm =
+      algorithm == CameraLinuxPlatformDemosaicAlgorithm::
+                       CAMERA_LINUX_PLATFORM_DEMOSAIC_ALGORITHM_BILINEAR
+          ? DemosaicAlgorithm::Bilinear
+          : DemosaicAlgorithm::MalvarHeCutler;
+  if (capturePipeline) {
+    capturePipeline->SetDemosaicAlgorithm(demosaicAlgorithm);
+  }
+}
+
+static GLenum ToGLFormat(CameraLinuxPlatformRenderFormat format) {
+  switch (format) {
+    case CameraLinuxPlatformRenderFormat::
+        CAMERA_LINUX_PLATFORM_RENDER_FORMAT_RGB8:
+      return GL_RGB8;
+    case CameraLinuxPlatformRenderFormat::
+        CAMERA_LINUX_PLATFORM_RENDER_FORMAT_RGBA8:
+      return GL_RGBA8;
+    case CameraLinuxPlatformRenderFormat::
+        CAMERA_LINUX_PLATFORM_RENDER_FORMAT_RGB10A2:
+      return GL_RGB10_A2;
+    case CameraLinuxPlatformRenderFormat::
+        CAMERA_LINUX_PLATFORM_RENDER_FORMAT_RGBA16F:
+      return GL_RGBA16F;
+  }
+  throw std::invalid_argument("Unsupported render format");
+}
+
+void Camera::setRenderFormats(
+    CameraLinuxPlatformRenderFormat intermediateFormat,
+    CameraLinuxPlatformRenderFormat displayFormat) {
+  const GLenum intermediate = ToGLFormat(intermediateFormat);
+  const GLenum display = ToGLFormat(displayFormat);
+  // Both are allocated when the pipeline starts: restart it.
+  CAMERA_CONFIG_LOCK({
+    renderIntermediateFormat = intermediate;
+    renderDisplayFormat = display;
+  });
+}
+
+void Camera::setZeroShutterLag(int64_t frameCount, bool rawFrames) {
+  if (frameCount < 0 || frameCount > ZSL_MAX_FRAME_COUNT) {
+    throw std::invalid_argument("Frame count must be between 0 and " +
+                                std::to_string(ZSL_MAX_FRAME_COUNT));
+  }
+  // The ring is allocated when the pipeline starts: restart it.
+  CAMERA_CONFIG_LOCK({
+    zslFrameCount = static_cast<size_t>(frameCount);
+    zslRawFrames = rawFrames;
+  });
+}
+
+void Camera::setJpegSettings(int64_t quality,
+                             CameraLinuxPlatformJpegSubsampling subsampling,
+                             int64_t restartInterval) {
+  if (quality < 1 || quality > 100) {
+    throw std::invalid_argument("JPEG quality must be between 1 and 100");
+  }
+  if (restartInterval < 0) {
+    throw std::invalid_argument("Restart interval must not be negative");
+  }
+  // Copied into each picture as it is submitted: no restart needed.
+  jpegSettings.quality = static_cast<int>(quality);
+  switch (subsampling) {
+    case CameraLinuxPlatformJpegSubsampling::
+        CAMERA_LINUX_PLATFORM_JPEG_SUBSAMPLING_YUV420:
+      jpegSettings.subsampling = JpegSubsampling::Yuv420;
+      break;
+    case CameraLinuxPlatformJpegSubsampling::
+        CAMERA_LINUX_PLATFORM_JPEG_SUBSAMPLING_YUV422:
+      jpegSettings.subsampling = JpegSubsampling::Yuv422;
+      break;
+    case CameraLinuxPlatformJpegSubsampling::
+        CAMERA_LINUX_PLATFORM_JPEG_SUBSAMPLING_YUV444:
+      jpegSettings.subsampling = JpegSubsampling::Yuv444;
+      break;
+  }
+  jpegSettings.restartInterval = static_cast<int>(
+      std::min<int64_t>(restartInterval, JPEG_MAX_RESTART_INTERVAL));
+}
+
+void Camera::setPreviewSize(int64_t width, int64_t height) {
+  if (width < 0 || height < 0) {
+    throw std::invalid_argument("Preview size must not be negative");
+  }
+  CAMERA_CONFIG_LOCK({
+    previewWidth = static_cast<int>(width);
+    previewHeight = static_cast<int>(height);
+  });
+}
+
+void Camera::startImageStream(const ImageStreamOptions& options) {
+  if (options.width < 0 || options.height < 0) {
+    throw std::invalid_argument("Image stream size must not be negative");
+  }
+  if (options.maxFrameRate < 0.0) {
+    throw std::invalid_argument("Image stream frame rate must not be negative");
+  }
+  if (!capturePipeline) {
+    throw std::runtime_error("Camera is not initialized");
+  }
+  // No CAMERA_CONFIG_LOCK: the GL thread switches streams between frames.
+  auto stream =
+      std::make_shared<ImageStream>(cameraLinuxCameraEventApi, options);
+  std::shared_ptr<ImageStream> previous =
+      std::atomic_exchange(&imageStream, stream);
+  if (previous) previous->Close();
+}
+
+void Camera::stopImageStream() {
+  std::shared_ptr<ImageStream> previous =
+      std::atomic_exchange(&imageStream, std::shared_ptr<ImageStream>());
+  if (previous) previous->Close();
+}
+
+void Camera::receivedImageStreamData() {
+  std::shared_ptr<ImageStream> stream = std::atomic_load(&imageStream);
+  if (stream) stream->ReleaseCredit();
+}
+
+void Camera::setAutoExposure(const AutoExposureSettings& settings) {
+  if (settings.targetBrightness <= 0.0 || settings.targetBrightness >= 255.0) {
+    throw std::invalid_argument("Target brightness must be within (0, 255)");
+  }
+  if (settings.overblownThreshold <= 0.0 ||
+      settings.overblownThreshold > 255.0) {
+    throw std::invalid_argument("Overblown threshold must be within (0, 255]");
+  }
+  if (settings.overblownTargetRatio <= 0.0 ||
+      settings.overblownTargetRatio >= 1.0) {
+    throw std::invalid_argument("Overblown target ratio must be within (0, 1)");
+  }
+  if (settings.gain <= 0.0) {
+    throw std::invalid_argument("Controller gain must be positive");
+  }
+  autoExposureSettings = settings;
+  if (capturePipeline) {
+    capturePipeline->SetAutoExposure(settings);
+  }
+}
+
 void Camera::startVideoRecording(std::string filePath) {
-  if (!camera || !Pylon::CVideoWriter::IsSupported() ||
-      cameraVideoRecorderImageEventHandler) {
-    std::cerr << "Video recording is not supported or camera is not "
-                 "initialized. or already recording."
+  if (!frameSource || cameraVideoRecorderImageEventHandler ||
+      std::atomic_load(&processedRecorder)) {
+    std::cerr << "Camera is not initialized or already recording."
               << std::endl;
     return;
   }
+  VideoRecorderSettings settings = videoRecordingSettings;
+  if (frameSource->GetFrameRate() > 0.0) {
+    settings.frameRate = frameSource->GetFrameRate();
+  }
+  if (recordProcessedFrames) {
+    // Picked up by the GL thread on its next frame: no restart.
+    std::atomic_store(&processedRecorder,
+                      std::make_shared<VideoRecorder>(filePath, settings));
+    return;
+  }
+  // Raw frames are recorded by an image event handler, which only a
+  // camera runs.
+  if (!camera) {
+    std::cerr << "Recording raw frames needs a camera." << std::endl;
+    return;
+  }
   CAMERA_CONFIG_LOCK({
     cameraVideoRecorderImageEventHandler =
-        std::make_unique<CameraVideoRecorderImageEventHandler>(filePath);
+        std::make_unique<CameraVideoRecorderImageEventHandler>(filePath,
+                                                               settings);
     camera->RegisterImageEventHandler(
         cameraVideoRecorderImageEventHandler.get(),
         Pylon::RegistrationMode_Append, Pylon::Cleanup_None);
@@ -399,13 +712,81 @@ void Camera::startVideoRecording(std::string filePath) {
 }
 
 void Camera::stopVideoRecording(std::string& filePath) {
+  std::shared_ptr<VideoRecorder> processed = std::atomic_exchange(
+      &processedRecorder, std::shared_ptr<VideoRecorder>());
+  if (processed) {
+    // Frames still being read back are dropped with the GL thread's
+    // reference.
+    filePath = processed->GetFilePath();
+    const std::string error = processed->Finish();
+    if (!error.empty()) {
+      throw std::runtime_error(error);
+    }
+    return;
+  }
   if (!camera || !cameraVideoRecorderImageEventHandler) {
     return;
   }
+  std::unique_ptr<CameraVideoRecorderImageEventHandler> recorder;
   CAMERA_CONFIG_LOCK({
     filePath = cameraVideoRecorderImageEventHandler->m_videoFilePath;
     camera->DeregisterImageEventHandler(
         cameraVideoRecorderImageEventHandler.get());
-    cameraVideoRecorderImageEventHandler.reset();
+    recorder = std::move(cameraVideoRecorderImageEventHandler);
   });
+  // Outside the lock: the stream restarts while the queue drains.
+  const std::string error = recorder->Finish();
+  if (!error.empty()) {
+    throw std::runtime_error(error);
+  }
+}
+
+void Camera::startRawRecording(std::string filePath, int64_t maxFrames) {
+  if (!camera || cameraRawRecorderImageEventHandler) {
+    throw std::runtime_error("Camera is not initialized or already recording");
+  }
+  if (maxFrames < 0) {
+    throw std::invalid_argument("Frame limit must not be negative");
+  }
+  const double rate = frameSource->GetFrameRate();
+  CAMERA_CONFIG_LOCK({
+    cameraRawRecorderImageEventHandler =
+        std::make_unique<CameraRawRecorderImageEventHandler>(
+            filePath, rate, static_cast<uint64_t>(maxFrames));
+    camera->RegisterImageEventHandler(
+        cameraRawRecorderImageEventHandler.get(),
+        Pylon::RegistrationMode_Append, Pylon::Cleanup_None);
+  });
+}
+
+void Camera::stopRawRecording(std::string& filePath) {
+  if (!camera || !cameraRawRecorderImageEventHandler) {
+    return;
+  }
+  std::unique_ptr<CameraRawRecorderImageEventHandler> recorder;
+  CAMERA_CONFIG_LOCK({
+    filePath = cameraRawRecorderImageEventHandler->m_filePath;
+    camera->DeregisterImageEventHandler(
+        cameraRawRecorderImageEventHandler.get());
+    recorder = std::move(cameraRawRecorderImageEventHandler);
+  });
+  // Outside the lock: the stream restarts while the queue drains.
+  const std::string error = recorder->Finish();
+  if (!error.empty()) {
+    throw std::runtime_error(error);
+  }
+}
+
+void Camera::setVideoRecordingSettings(int64_t bitrate,
+                                       int64_t keyFrameInterval,
+                                       std::string container) {
+  if (bitrate < 0) {
+    throw std::invalid_argument("Bitrate must not be negative");
+  }
+  if (keyFrameInterval <= 0) {
+    throw std::invalid_argument("Key frame interval must be positive");
+  }
+  videoRecordingSettings.bitrate = bitrate;
+  videoRecordingSettings.keyFrameInterval = static_cast<int>(keyFrameInterval);
+  videoRecordingSettings.container = std::move(container);
 }
\ No newline at end of file
@@ -4,10 +4,15 @@
 
 #include <functional>
 
+#include "burst_capture.h"
+#include "camera_raw_recorder_image_event_handler.h"
 #include "camera_video_recorder_image_event_handler.h"
 #include "capture_pipeline.h"
 #include "flutter_linux/flutter_linux.h"
+#include "frame_source.h"
+#include "image_stream.h"
 #include "messages.g.h"
+#include "still_encoder.h"
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Woverloaded-virtual"
@@ -21,15 +26,37 @@ class Camera {
   // Camera
  public:
   int64_t camera_id;
+  // nullptr when frames are generated or replayed rather than grabbed
   std::unique_ptr<Pylon::CInstantCamera> camera;
+  // Where the pipeline gets its frames: the camera, or one standing in
+  // for it
+  std::unique_ptr<FrameSource> frameSource;
+  // Frames streamed to Dart, picked up by the pipeline's GL thread through
+  // std::atomic_load. Declared first so it outlives the pipeline.
+  std::shared_ptr<ImageStream> imageStream;
+  // Recording fed with processed frames by the GL thread, which picks it up
+  // the same way.
+  std::shared_ptr<VideoRecorder> processedRecorder;
   std::unique_ptr<CapturePipeline> capturePipeline;
   CameraLinuxCameraEventApi* cameraLinuxCameraEventApi;
   std::unique_ptr<CameraVideoRecorderImageEventHandler>
       cameraVideoRecorderImageEventHandler;
+  std::unique_ptr<CameraRawRecorderImageEventHandler>
+      cameraRawRecorderImageEventHandler;
+  // Writes pictures off the main thread
+  std::unique_ptr<StillEncoder> stillEncoder;
+  // Writes bursts, one thread per core
+  std::unique_ptr<StillEncoder> burstEncoder;
 
   Camera(Pylon::IPylonDevice* device, int64_t camera_id,
          FlPluginRegistrar* registrar,
          CameraLinuxPlatformResolutionPreset resolution_preset);
+  // A camera whose frames come from `frameSource`, e.g. a
+  // SyntheticFrameSource or a ReplayFrameSource, for running the pipeline
+  // without hardware.
+  Camera(std::unique_ptr<FrameSource> frameSource, int64_t camera_id,
+         FlPluginRegistrar* registrar,
+         CameraLinuxPlatformResolutionPreset resolution_preset);
 
   Camera(Camera&&) = default;
   Camera& operator=(Camera&&) = default;
@@ -40,14 +67,55 @@ class Camera {
 
   int64_t getTextureId();
 
-  void takePicture(std::string filePath);
+  // Returns once the frame is picked; `done` runs on the main loop once it
+  // is written.
+  void takePicture(std::string filePath, StillCallback done);
+  // Takes the next `count` frames of the running stream as raw pictures in
+  // `directory`. Returns once the burst is armed; `done` runs on the main
+  // loop once every picture is written.
+  void takeBurst(int64_t count, const std::string& directory,
+                 BurstCallback done);
   void startVideoRecording(std::string filePath);
+  // Throws when the recording could not be written.
   void stopVideoRecording(std::string& filePath);
+  void setVideoRecordingSettings(int64_t bitrate, int64_t keyFrameInterval,
+                                 std::string container);
+  void setVideoRecordingSource(bool processedFrames, bool gpuNv12);
+  // Records frames as grabbed, uncompressed, to a raw sequence file with
+  // room for `maxFrames` (0 for the default). Runs alongside a video
+  // recording.
+  void startRawRecording(std::string filePath, int64_t maxFrames);
+  // Throws when the recording could not be written.
+  void stopRawRecording(std::string& filePath);
 
   void setImageFormatGroup(
       CameraLinuxPlatformImageFormatGroup imageFormatGroup);
   void setExposureMode(CameraLinuxPlatformExposureMode mode);
   void setFocusMode(CameraLinuxPlatformFocusMode mode);
+  // Restarts the stream with `count` camera buffers, 0 for the default.
+  void setGrabBufferCount(int64_t count);
+  // Restarts the stream with `depth` PBO upload slots, 0 for the default.
+  void setUploadRingDepth(int64_t depth);
+  // Restarts the stream with `capacity` frames (0 for the default) queued
+  // between the acquisition and GL threads.
+  void setFrameQueuePolicy(CameraLinuxPlatformFrameQueuePolicy policy,
+                           int64_t capacity);
+  void setExposureBracket(const std::vector<double>& exposuresUs,
+                          const std::vector<double>& gains);
+  void setToneMapping(CameraLinuxPlatformToneMappingOperator toneOperator,
+                      double key, double adaptationSeconds);
+  void setAutoExposure(const AutoExposureSettings& settings);
+  void setDemosaicAlgorithm(CameraLinuxPlatformDemosaicAlgorithm algorithm);
+  void setRenderFormats(CameraLinuxPlatformRenderFormat intermediateFormat,
+                        CameraLinuxPlatformRenderFormat displayFormat);
+  void setPreviewSize(int64_t width, int64_t height);
+  void setZeroShutterLag(int64_t frameCount, bool rawFrames);
+  void setJpegSettings(int64_t quality,
+                       CameraLinuxPlatformJpegSubsampling subsampling,
+                       int64_t restartInterval);
+  void startImageStream(const ImageStreamOptions& options);
+  void stopImageStream();
+  void receivedImageStreamData();
 
   struct HDRFrame {
     std::vector<uint8_t> buffer;
@@ -63,6 +131,49 @@ class Camera {
   int width;
   int height;
   CameraLinuxPlatformImageFormatGroup imageFormatGroup;
+  // Buffers the camera grabs into (its MaxNumBuffer), and PBO slots frames
+  // are uploaded through: more ride out longer stalls, at the cost of
+  // memory and, for uploads, latency
+  size_t grabBufferCount = GRAB_BUFFER_POOL_SIZE;
+  size_t uploadRingDepth = PBO_UPLOAD_RING_DEPTH;
+  // Frames waiting for the GL thread, and what happens to the next one
+  // when there are that many
+  size_t frameQueueCapacity = FRAME_QUEUE_CAPACITY;
+  FrameQueueOverflowPolicy frameQueuePolicy =
+      FrameQueueOverflowPolicy::DropOldest;
+  // Exposure bracket (in us) and gain per entry (in dB, empty to leave the
+  // camera's gain alone), handed to each pipeline as it starts
+  std::vector<double> exposureBracketUs = {2000.0, 16000.0};
+  std::vector<double> exposureBracketGains;
+  // Tone mapping of the fused frame; a key of 0 derives it from the scene
+  ToneMappingOperator toneMappingOperator = ToneMappingOperator::Reinhard;
+  float toneMappingKey = 0.0f;
+  float toneMappingAdaptationSeconds = 0.5f;
+  // Auto exposure of the bracket, off by default
+  AutoExposureSettings autoExposureSettings;
+  // Interpolation of Bayer frames
+  DemosaicAlgorithm demosaicAlgorithm = DemosaicAlgorithm::MalvarHeCutler;
+  // Sized internal formats of the fusion and tone-mapping intermediates and
+  // of the textures handed to Flutter. Formats the context cannot render to
+  // fall back to the closest one it can.
+  GLenum renderIntermediateFormat = GL_RGBA16F;
+  GLenum renderDisplayFormat = GL_RGB8;
+  // Size of the texture handed to Flutter, 0 to follow the frame: its size
+  // when both are 0, its aspect ratio when only one is.
+  int previewWidth = 0;
+  int previewHeight = 0;
+  // Recent frames kept for takePicture, 0 to stop the stream and grab a
+  // new one instead. Raw frames skip fusion and tone mapping.
+  size_t zslFrameCount = 0;
+  bool zslRawFrames = false;
+  // Compression of the pictures taken next
+  JpegSettings jpegSettings;
+  // Encoding of the next recording; the frame rate is the camera's
+  VideoRecorderSettings videoRecordingSettings;
+  // Record the fused, tone-mapped frames rather than raw ones, read back
+  // as NV12 when the frame size allows it
+  bool recordProcessedFrames = true;
+  bool recordNv12 = true;
 
   void emitState();
   void emitTextureId(int64_t textureId) const;
@@ -72,15 +183,17 @@ class Camera {
  private:
   CameraLinuxPlatformResolutionPreset resolution_preset;
   FlPluginRegistrar* registrar;
+
+  void openDevice(CameraLinuxPlatformImageFormatGroup imageFormat);
 };
 
 #define CAMERA_CONFIG_LOCK(code)                                             \
   do {                                                                       \
-    bool wasGrabbing = camera->IsGrabbing();                                 \
-    if (!camera) {                                                           \
+    if (!frameSource) {                                                      \
       std::cerr << "Camera is not initialized." << std::endl;                \
       return;                                                                \
     }                                                                        \
+    bool wasGrabbing = frameSource->IsGrabbing();                            \
     if (wasGrabbing) {                                                       \
       capturePipeline->StopGrabbing();                                       \
       capturePipeline.reset();                                               \
@@ -1,5 +1,10 @@
 #include "camera_host_plugin.h"
 
+#include <cstdio>
+
+#include "replay_frame_source.h"
+#include "synthetic_frame_source.h"
+
 std::vector<Camera> CameraHostPlugin::cameras = {};
 FlPluginRegistrar* CameraHostPlugin::registrar = nullptr;
 
@@ -18,6 +23,25 @@ CameraHostPlugin::CameraHostPlugin(FlPluginRegistrar* registrar)
       .set_exposure_mode = set_exposure_mode,
       .set_focus_mode = set_focus_mode,
       .set_image_format_group = set_image_format_group,
+      .set_grab_buffer_count = set_grab_buffer_count,
+      .set_upload_ring_depth = set_upload_ring_depth,
+      .set_frame_queue_policy = set_frame_queue_policy,
+      .set_exposure_bracket = set_exposure_bracket,
+      .set_tone_mapping = set_tone_mapping,
+      .set_auto_exposure = set_auto_exposure,
+      .set_demosaic_algorithm = set_demosaic_algorithm,
+      .set_render_formats = set_render_formats,
+      .start_image_stream = start_image_stream,
+      .stop_image_stream = stop_image_stream,
+      .received_image_stream_data = received_image_stream_data,
+      .set_preview_size = set_preview_size,
+      .set_zero_shutter_lag = set_zero_shutter_lag,
+      .take_burst = take_burst,
+      .set_jpeg_settings = set_jpeg_settings,
+      .set_video_recording_settings = set_video_recording_settings,
+      .set_video_recording_source = set_video_recording_source,
+      .start_raw_recording = start_raw_recording,
+      .stop_raw_recording = stop_raw_recording,
   };
 
   camera_linux_camera_api_set_method_handlers(
@@ -59,11 +83,57 @@ void CameraHostPlugin::get_available_cameras_names(
   });
 }
 
+// Frame source standing in for a camera called `name`, with its camera ID,
+// or nullptr for other names. Throws when a replay cannot be read.
+static std::unique_ptr<FrameSource> CreateFrameSource(const std::string& name,
+                                                      int64_t& cameraId) {
+  const std::string synthetic = SYNTHETIC_CAMERA_NAME;
+  if (name.compare(0, synthetic.size(), synthetic) == 0) {
+    int width = SYNTHETIC_CAMERA_WIDTH;
+    int height = SYNTHETIC_CAMERA_HEIGHT;
+    if (name.size() > synthetic.size() &&
+        (std::sscanf(name.c_str() + synthetic.size(), ":%dx%d", &width,
+                     &height) != 2 ||
+         width <= 0 || height <= 0)) {
+      return nullptr;
+    }
+    cameraId = SYNTHETIC_CAMERA_ID;
+    return std::make_unique<SyntheticFrameSource>(width, height,
+                                                  SYNTHETIC_CAMERA_FRAME_RATE);
+  }
+  for (const std::string prefix :
+       {REPLAY_CAMERA_PREFIX, REPLAY_FAST_CAMERA_PREFIX}) {
+    if (name.compare(0, prefix.size(), prefix) == 0) {
+      cameraId = REPLAY_CAMERA_ID;
+      return std::make_unique<ReplayFrameSource>(
+          name.substr(prefix.size()), prefix == REPLAY_CAMERA_PREFIX);
+    }
+  }
+  return nullptr;
+}
+
 void CameraHostPlugin::create(
     const gchar* camera_name,
     CameraLinuxPlatformResolutionPreset resolution_preset,
     CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data) {
   CAMERA_HOST_ERROR_HANDLING(create, {
+    int64_t source_id = 0;
+    std::unique_ptr<FrameSource> source =
+        CreateFrameSource(camera_name, source_id);
+    if (source) {
+      for (auto&& camera_it = cameras.begin(); camera_it != cameras.end();
+           ++camera_it) {
+        if (camera_it->camera_id == source_id) {
+          cameras.erase(camera_it);
+          break;
+        }
+      }
+      cameras.emplace_back(std::move(source), source_id, registrar,
+                           resolution_preset);
+      CAMERA_HOST_RETURN(source_id);
+      return;
+    }
+
     Pylon::CTlFactory& TlFactory = Pylon::CTlFactory::GetInstance();
     Pylon::DeviceInfoList_t lstDevices;
     TlFactory.EnumerateDevices(lstDevices);
@@ -118,6 +188,195 @@ void CameraHostPlugin::set_image_format_group(
   });
 }
 
+void CameraHostPlugin::set_grab_buffer_count(
+    int64_t camera_id, int64_t count,
+    CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data) {
+  CAMERA_HOST_ERROR_HANDLING(set_grab_buffer_count, {
+    Camera& camera = get_camera_by_id(camera_id);
+    camera.setGrabBufferCount(count);
+    CAMERA_HOST_VOID_RETURN();
+  });
+}
+
+void CameraHostPlugin::set_upload_ring_depth(
+    int64_t camera_id, int64_t depth,
+    CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data) {
+  CAMERA_HOST_ERROR_HANDLING(set_upload_ring_depth, {
+    Camera& camera = get_camera_by_id(camera_id);
+    camera.setUploadRingDepth(depth);
+    CAMERA_HOST_VOID_RETURN();
+  });
+}
+
+void CameraHostPlugin::set_frame_queue_policy(
+    int64_t camera_id, CameraLinuxPlatformFrameQueuePolicy policy,
+    int64_t capacity, CameraLinuxCameraApiResponseHandle* response_handle,
+    gpointer user_data) {
+  CAMERA_HOST_ERROR_HANDLING(set_frame_queue_policy, {
+    Camera& camera = get_camera_by_id(camera_id);
+    camera.setFrameQueuePolicy(policy, capacity);
+    CAMERA_HOST_VOID_RETURN();
+  });
+}
+
+void CameraHostPlugin::set_exposure_bracket(
+    int64_t camera_id, FlValue* exposures_us, FlValue* gains,
+    CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data) {
+  CAMERA_HOST_ERROR_HANDLING(set_exposure_bracket, {
+    Camera& camera = get_camera_by_id(camera_id);
+    std::vector<double> exposures;
+    for (size_t i = 0; i < fl_value_get_length(exposures_us); ++i) {
+      exposures.push_back(
+          fl_value_get_float(fl_value_get_list_value(exposures_us, i)));
+    }
+    std::vector<double> gainLevels;
+    for (size_t i = 0; i < fl_value_get_length(gains); ++i) {
+      gainLevels.push_back(
+          fl_value_get_float(fl_value_get_list_value(gains, i)));
+    }
+    camera.setExposureBracket(exposures, gainLevels);
+    CAMERA_HOST_VOID_RETURN();
+  });
+}
+
+void CameraHostPlugin::set_tone_mapping(
+    int64_t camera_id,
+    CameraLinuxPlatformToneMappingOperator tone_mapping_operator, double key,
+    double adaptation_seconds,
+    CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data) {
+  CAMERA_HOST_ERROR_HANDLING(set_tone_mapping, {
+    Camera& camera = get_camera_by_id(camera_id);
+    camera.setToneMapping(tone_mapping_operator, key, adaptation_seconds);
+    CAMERA_HOST_VOID_RETURN();
+  });
+}
+
+void CameraHostPlugin::set_auto_exposure(
+    int64_t camera_id, gboolean enabled, double target_brightness,
+    double overblown_threshold, double overblown_target_ratio,
+    double controller_gain,
+    CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data) {
+  CAMERA_HOST_ERROR_HANDLING(set_auto_exposure, {
+    Camera& camera = get_camera_by_id(camera_id);
+    AutoExposureSettings settings;
+    settings.enabled = enabled;
+    settings.targetBrightness = target_brightness;
+    settings.overblownThreshold = overblown_threshold;
+    settings.overblownTargetRatio = overblown_target_ratio;
+    settings.gain = controller_gain;
+    camera.setAutoExposure(settings);
+    CAMERA_HOST_VOID_RETURN();
+  });
+}
+
+void CameraHostPlugin::set_demosaic_algorithm(
+    int64_t camera_id, CameraLinuxPlatformDemosaicAlgorithm algorithm,
+    CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data) {
+  CAMERA_HOST_ERROR_HANDLING(set_demosaic_algorithm, {
+    Camera& camera = get_camera_by_id(camera_id);
+    camera.setDemosaicAlgorithm(algorithm);
+    CAMERA_HOST_VOID_RETURN();
+  });
+}
+
+void CameraHostPlugin::set_render_formats(
+    int64_t camera_id, CameraLinuxPlatformRenderFormat intermediate_format,
+    CameraLinuxPlatformRenderFormat display_format,
+    CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data) {
+  CAMERA_HOST_ERROR_HANDLING(set_render_formats, {
+    Camera& camera = get_camera_by_id(camera_id);
+    camera.setRenderFormats(intermediate_format, display_format);
+    CAMERA_HOST_VOID_RETURN();
+  });
+}
+
+void CameraHostPlugin::start_image_stream(
+    int64_t camera_id, int64_t width, int64_t height, double max_frame_rate,
+    CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data) {
+  CAMERA_HOST_ERROR_HANDLING(start_image_stream, {
+    Camera& camera = get_camera_by_id(camera_id);
+    ImageStreamOptions options;
+    options.width = static_cast<int>(width);
+    options.height = static_cast<int>(height);
+    options.maxFrameRate = max_frame_rate;
+    camera.startImageStream(options);
+    CAMERA_HOST_VOID_RETURN();
+  });
+}
+
+void CameraHostPlugin::stop_image_stream(
+    int64_t camera_id, CameraLinuxCameraApiResponseHandle* response_handle,
+    gpointer user_data) {
+  CAMERA_HOST_ERROR_HANDLING(stop_image_stream, {
+    Camera& camera = get_camera_by_id(camera_id);
+    camera.stopImageStream();
+    CAMERA_HOST_VOID_RETURN();
+  });
+}
+
+void CameraHostPlugin::received_image_stream_data(
+    int64_t camera_id, CameraLinuxCameraApiResponseHandle* response_handle,
+    gpointer user_data) {
+  CAMERA_HOST_ERROR_HANDLING(received_image_stream_data, {
+    Camera& camera = get_camera_by_id(camera_id);
+    camera.receivedImageStreamData();
+    CAMERA_HOST_VOID_RETURN();
+  });
+}
+
+void CameraHostPlugin::set_preview_size(
+    int64_t camera_id, int64_t width, int64_t height,
+    CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data) {
+  CAMERA_HOST_ERROR_HANDLING(set_preview_size, {
+    Camera& camera = get_camera_by_id(camera_id);
+    camera.setPreviewSize(width, height);
+    CAMERA_HOST_VOID_RETURN();
+  });
+}
+
+void CameraHostPlugin::set_zero_shutter_lag(
+    int64_t camera_id, int64_t frame_count, gboolean raw_frames,
+    CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data) {
+  CAMERA_HOST_ERROR_HANDLING(set_zero_shutter_lag, {
+    Camera& camera = get_camera_by_id(camera_id);
+    camera.setZeroShutterLag(frame_count, raw_frames);
+    CAMERA_HOST_VOID_RETURN();
+  });
+}
+
+void CameraHostPlugin::set_video_recording_settings(
+    int64_t camera_id, int64_t bitrate, int64_t key_frame_interval,
+    const gchar* container,
+    CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data) {
+  CAMERA_HOST_ERROR_HANDLING(set_video_recording_settings, {
+    Camera& camera = get_camera_by_id(camera_id);
+    camera.setVideoRecordingSettings(bitrate, key_frame_interval,
+                                     std::string(container));
+    CAMERA_HOST_VOID_RETURN();
+  });
+}
+
+void CameraHostPlugin::set_video_recording_source(
+    int64_t camera_id, gboolean processed_frames, gboolean gpu_nv12,
+    CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data) {
+  CAMERA_HOST_ERROR_HANDLING(set_video_recording_source, {
+    Camera& camera = get_camera_by_id(camera_id);
+    camera.setVideoRecordingSource(processed_frames, gpu_nv12);
+    CAMERA_HOST_VOID_RETURN();
+  });
+}
+
+void CameraHostPlugin::set_jpeg_settings(
+    int64_t camera_id, int64_t quality,
+    CameraLinuxPlatformJpegSubsampling subsampling, int64_t restart_interval,
+    CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data) {
+  CAMERA_HOST_ERROR_HANDLING(set_jpeg_settings, {
+    Camera& camera = get_camera_by_id(camera_id);
+    camera.setJpegSettings(quality, subsampling, restart_interval);
+    CAMERA_HOST_VOID_RETURN();
+  });
+}
+
 void CameraHostPlugin::initialize(
     int64_t camera_id, CameraLinuxPlatformImageFormatGroup image_format,
     CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data) {
@@ -141,6 +400,31 @@ void CameraHostPlugin::get_texture_id(
   });
 }
 
+void CameraHostPlugin::start_raw_recording(
+    int64_t camera_id, const gchar* file_path, int64_t max_frames,
+    CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data) {
+  CAMERA_HOST_ERROR_HANDLING(start_raw_recording, {
+    Camera& camera = get_camera_by_id(camera_id);
+    camera.startRawRecording(std::string(file_path), max_frames);
+    CAMERA_HOST_VOID_RETURN();
+  });
+}
+
+void CameraHostPlugin::stop_raw_recording(
+    int64_t camera_id, CameraLinuxCameraApiResponseHandle* response_handle,
+    gpointer user_data) {
+  CAMERA_HOST_ERROR_HANDLING(stop_raw_recording, {
+    Camera& camera = get_camera_by_id(camera_id);
+
+    std::string path;
+    camera.stopRawRecording(path);
+    if (path.empty()) {
+      CAMERA_HOST_RAISE_ERROR("Raw recording not started");
+    }
+    CAMERA_HOST_RETURN(path.c_str());
+  });
+}
+
 void CameraHostPlugin::set_exposure_mode(
     int64_t camera_id, CameraLinuxPlatformExposureMode mode,
     CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data) {
@@ -169,8 +453,53 @@ void CameraHostPlugin::take_picture(
   CAMERA_HOST_ERROR_HANDLING(take_picture, {
     Camera& camera = get_camera_by_id(camera_id);
 
-    camera.takePicture(std::string(path));
-    CAMERA_HOST_VOID_RETURN();
+    // Answered once the picture is written, which outlives this call.
+    std::shared_ptr<CameraLinuxCameraApiResponseHandle> handle(
+        CAMERA_LINUX_CAMERA_API_RESPONSE_HANDLE(g_object_ref(response_handle)),
+        g_object_unref);
+    camera.takePicture(std::string(path), [handle](const std::string& error) {
+      if (error.empty()) {
+        camera_linux_camera_api_respond_take_picture(handle.get());
+      } else {
+        camera_linux_camera_api_respond_error_take_picture(
+            handle.get(), nullptr, error.c_str(), nullptr);
+      }
+    });
+  });
+}
+
+void CameraHostPlugin::take_burst(
+    int64_t camera_id, int64_t count, const gchar* directory,
+    CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data) {
+  CAMERA_HOST_ERROR_HANDLING(take_burst, {
+    Camera& camera = get_camera_by_id(camera_id);
+
+    // Answered once every picture is written, which outlives this call.
+    std::shared_ptr<CameraLinuxCameraApiResponseHandle> handle(
+        CAMERA_LINUX_CAMERA_API_RESPONSE_HANDLE(g_object_ref(response_handle)),
+        g_object_unref);
+    camera.takeBurst(
+        count, std::string(directory),
+        [handle](const std::vector<std::string>& paths,
+                 const std::vector<int64_t>& timestampsUs,
+                 const std::string& error) {
+          if (!error.empty()) {
+            camera_linux_camera_api_respond_error_take_burst(
+                handle.get(), nullptr, error.c_str(), nullptr);
+            return;
+          }
+          g_autoptr(FlValue) pathList = fl_value_new_list();
+          for (const std::string& path : paths) {
+            fl_value_append_take(pathList, fl_value_new_string(path.c_str()));
+          }
+          g_autoptr(FlValue) timestampList = fl_value_new_list();
+          for (int64_t timestampUs : timestampsUs) {
+            fl_value_append_take(timestampList, fl_value_new_int(timestampUs));
+          }
+          g_autoptr(CameraLinuxPlatformBurstResult) result =
+              camera_linux_platform_burst_result_new(pathList, timestampList);
+          camera_linux_camera_api_respond_take_burst(handle.get(), result);
+        });
   });
 }
 
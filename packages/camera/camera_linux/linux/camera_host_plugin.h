@@ -47,6 +47,20 @@
   camera_linux_camera_api_respond_error_macro(response_handle, nullptr, \
                                               #description, nullptr)
 
+// Camera names that stand in for a camera, for running the pipeline
+// without hardware: "synthetic" or "synthetic:<width>x<height>" for a
+// generated test scene, "replay:<path>" for a raw sequence at its recorded
+// pace, "replay-fast:<path>" for one as fast as the pipeline runs.
+#define SYNTHETIC_CAMERA_NAME "synthetic"
+#define REPLAY_CAMERA_PREFIX "replay:"
+#define REPLAY_FAST_CAMERA_PREFIX "replay-fast:"
+// Their camera IDs, out of the way of serial numbers
+#define SYNTHETIC_CAMERA_ID -1
+#define REPLAY_CAMERA_ID -2
+#define SYNTHETIC_CAMERA_WIDTH 1920
+#define SYNTHETIC_CAMERA_HEIGHT 1080
+#define SYNTHETIC_CAMERA_FRAME_RATE 60.0
+
 class CameraHostPlugin {
   static FlPluginRegistrar* registrar;
   FlPluginRegistrar* m_registrar;
@@ -84,6 +98,11 @@ class CameraHostPlugin {
                            CameraLinuxCameraApiResponseHandle* response_handle,
                            gpointer user_data);
 
+  static void take_burst(int64_t camera_id, int64_t count,
+                         const gchar* directory,
+                         CameraLinuxCameraApiResponseHandle* response_handle,
+                         gpointer user_data);
+
   static void start_video_recording(
       int64_t camera_id, const gchar* path,
       CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
@@ -92,6 +111,14 @@ class CameraHostPlugin {
       int64_t camera_id, CameraLinuxCameraApiResponseHandle* response_handle,
       gpointer user_data);
 
+  static void start_raw_recording(
+      int64_t camera_id, const gchar* file_path, int64_t max_frames,
+      CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+
+  static void stop_raw_recording(
+      int64_t camera_id, CameraLinuxCameraApiResponseHandle* response_handle,
+      gpointer user_data);
+
   static void set_exposure_mode(
       int64_t camera_id, CameraLinuxPlatformExposureMode mode,
       CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
@@ -106,6 +133,78 @@ class CameraHostPlugin {
   static void set_image_format_group(
       int64_t camera_id, CameraLinuxPlatformImageFormatGroup image_format_group,
       CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+
+  static void set_grab_buffer_count(
+      int64_t camera_id, int64_t count,
+      CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+
+  static void set_upload_ring_depth(
+      int64_t camera_id, int64_t depth,
+      CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+
+  static void set_frame_queue_policy(
+      int64_t camera_id, CameraLinuxPlatformFrameQueuePolicy policy,
+      int64_t capacity, CameraLinuxCameraApiResponseHandle* response_handle,
+      gpointer user_data);
+
+  static void set_exposure_bracket(
+      int64_t camera_id, FlValue* exposures_us, FlValue* gains,
+      CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+
+  static void set_tone_mapping(
+      int64_t camera_id,
+      CameraLinuxPlatformToneMappingOperator tone_mapping_operator, double key,
+      double adaptation_seconds,
+      CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+
+  static void set_auto_exposure(
+      int64_t camera_id, gboolean enabled, double target_brightness,
+      double overblown_threshold, double overblown_target_ratio,
+      double controller_gain,
+      CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+
+  static void set_demosaic_algorithm(
+      int64_t camera_id, CameraLinuxPlatformDemosaicAlgorithm algorithm,
+      CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+
+  static void set_render_formats(
+      int64_t camera_id, CameraLinuxPlatformRenderFormat intermediate_format,
+      CameraLinuxPlatformRenderFormat display_format,
+      CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+
+  static void start_image_stream(
+      int64_t camera_id, int64_t width, int64_t height, double max_frame_rate,
+      CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+
+  static void stop_image_stream(
+      int64_t camera_id, CameraLinuxCameraApiResponseHandle* response_handle,
+      gpointer user_data);
+
+  static void received_image_stream_data(
+      int64_t camera_id, CameraLinuxCameraApiResponseHandle* response_handle,
+      gpointer user_data);
+
+  static void set_preview_size(
+      int64_t camera_id, int64_t width, int64_t height,
+      CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+
+  static void set_zero_shutter_lag(
+      int64_t camera_id, int64_t frame_count, gboolean raw_frames,
+      CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+
+  static void set_video_recording_settings(
+      int64_t camera_id, int64_t bitrate, int64_t key_frame_interval,
+      const gchar* container,
+      CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+
+  static void set_video_recording_source(
+      int64_t camera_id, gboolean processed_frames, gboolean gpu_nv12,
+      CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+
+  static void set_jpeg_settings(
+      int64_t camera_id, int64_t quality,
+      CameraLinuxPlatformJpegSubsampling subsampling, int64_t restart_interval,
+      CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
 };
 
 #endif  // CAMERA_HOST_PLUGIN_PRIVATE_H_
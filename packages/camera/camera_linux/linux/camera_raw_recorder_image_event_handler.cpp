@@ -0,0 +1,61 @@
+#include "camera_raw_recorder_image_event_handler.h"
+
+CameraRawRecorderImageEventHandler::CameraRawRecorderImageEventHandler(
+    std::string filePath, double frameRate, uint64_t maxFrames)
+    : m_writer(std::make_unique<RawSequenceWriter>(filePath, frameRate,
+                                                   maxFrames)),
+      m_filePath(std::move(filePath)) {}
+
+void CameraRawRecorderImageEventHandler::OnImageGrabbed(
+    Pylon::CInstantCamera& camera, const Pylon::CGrabResultPtr& ptr) {
+  if (!ptr->GrabSucceeded()) {
+    return;
+  }
+  const auto timestamp = std::chrono::steady_clock::now();
+
+  RawSequenceFormat format;
+  format.pixelType = static_cast<uint32_t>(ptr->GetPixelType());
+  format.width = ptr->GetWidth();
+  format.height = ptr->GetHeight();
+  format.paddingX = ptr->GetPaddingX();
+
+  RawSequenceFrameInfo info = {};
+  info.cameraTimestamp = ptr->GetTimeStamp();
+  info.blockId = ptr->GetBlockID();
+  info.sequencerSet = -1;
+  // Chunk data describes the frame itself; the node map holds the values
+  // last set, which are the frame's under software-triggered bracketing.
+  GenApi::INodeMap& chunks = ptr->GetChunkDataNodeMap();
+  GenApi::INodeMap& nodemap = camera.GetNodeMap();
+  Pylon::CFloatParameter chunkExposure(chunks, "ChunkExposureTime");
+  Pylon::CFloatParameter exposure(nodemap, "ExposureTime");
+  if (chunkExposure.IsReadable()) {
+    info.exposureUs = chunkExposure.GetValue();
+  } else if (exposure.IsReadable()) {
+    info.exposureUs = exposure.GetValue();
+  }
+  Pylon::CFloatParameter chunkGain(chunks, "ChunkGain");
+  Pylon::CFloatParameter gain(nodemap, "Gain");
+  if (chunkGain.IsReadable()) {
+    info.gainDb = chunkGain.GetValue();
+  } else if (gain.IsReadable()) {
+    info.gainDb = gain.GetValue();
+  }
+  Pylon::CIntegerParameter sequencerSet(chunks, "ChunkSequencerSetActive");
+  if (sequencerSet.IsReadable()) {
+    info.sequencerSet = static_cast<int32_t>(sequencerSet.GetValue());
+  }
+
+  m_writer->Push(static_cast<const uint8_t*>(ptr->GetBuffer()),
+                 ptr->GetImageSize(), format, info, timestamp);
+}
+
+std::string CameraRawRecorderImageEventHandler::Finish() {
+  const std::string error = m_writer->Finish();
+  if (m_writer->GetDroppedFrameCount() > 0) {
+    std::cout << "[DEBUG] Raw recording dropped "
+              << m_writer->GetDroppedFrameCount()
+              << " frames while the disk was behind" << std::endl;
+  }
+  return error;
+}
@@ -0,0 +1,37 @@
+#ifndef CAMERA_RAW_RECORDER_IMAGE_EVENT_HANDLER_H_
+#define CAMERA_RAW_RECORDER_IMAGE_EVENT_HANDLER_H_
+
+#include <memory>
+
+#include "flutter_linux/flutter_linux.h"
+#include "raw_sequence_writer.h"
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Woverloaded-virtual"
+#pragma clang diagnostic ignored "-Wunused-variable"
+
+#include <pylon/PylonIncludes.h>
+
+#pragma clang diagnostic pop
+
+// Hands each grabbed frame, as delivered, to a RawSequenceWriter. Runs on
+// the thread retrieving grab results, so it only copies the frame and its
+// metadata; writing happens on the writer's thread.
+class CameraRawRecorderImageEventHandler : public Pylon::CImageEventHandler {
+  std::unique_ptr<RawSequenceWriter> m_writer;
+
+ public:
+  std::string m_filePath;
+
+  CameraRawRecorderImageEventHandler(std::string filePath, double frameRate,
+                                     uint64_t maxFrames);
+
+  void OnImageGrabbed(Pylon::CInstantCamera& camera,
+                      const Pylon::CGrabResultPtr& ptr) override;
+
+  // Writes the frames still queued and closes the file. Returns the first
+  // error, or an empty string.
+  std::string Finish();
+};
+
+#endif  // CAMERA_RAW_RECORDER_IMAGE_EVENT_HANDLER_H_
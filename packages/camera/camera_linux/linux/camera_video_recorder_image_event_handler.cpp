@@ -1,8 +1,9 @@
 #include "camera_video_recorder_image_event_handler.h"
 
 CameraVideoRecorderImageEventHandler::CameraVideoRecorderImageEventHandler(
-    std::string videoFilePath)
-    : m_videoFilePath(std::move(videoFilePath)) {}
+    std::string videoFilePath, const VideoRecorderSettings& settings)
+    : m_recorder(std::make_unique<VideoRecorder>(videoFilePath, settings)),
+      m_videoFilePath(std::move(videoFilePath)) {}
 
 void CameraVideoRecorderImageEventHandler::OnImageGrabbed(
     Pylon::CInstantCamera& camera, const Pylon::CGrabResultPtr& ptr) {
@@ -11,30 +12,46 @@ void CameraVideoRecorderImageEventHandler::OnImageGrabbed(
     return;
   }
 
-  static bool isFirstFrame = true;
-  if (isFirstFrame) {
-    m_videoWriter.SetParameter(ptr->GetWidth(), ptr->GetHeight(),
-                               ptr->GetPixelType(),
-                               CAMERA_VIDEO_RECORDER_PLAY_BACK_FRAME_RATE,
-                               CAMERA_VIDEO_RECORDER_QUALITY);
-    m_videoWriter.Open(m_videoFilePath.c_str());
-    isFirstFrame = false;
-  }
-
-  Pylon::CPylonImage image;
-  image.AttachGrabResultBuffer(ptr);
-  m_videoWriter.Add(image);
-}
-
-void CameraVideoRecorderImageEventHandler::OnImageEventHandlerDeregistered(
-    Pylon::CInstantCamera& camera) {
-  if (m_videoWriter.IsOpen()) {
-    m_videoWriter.Close();
+  VideoPixelFormat format;
+  switch (ptr->GetPixelType()) {
+    case Pylon::PixelType_Mono8:
+      format = VideoPixelFormat::Gray8;
+      break;
+    case Pylon::PixelType_RGB8packed:
+      format = VideoPixelFormat::Rgb24;
+      break;
+    case Pylon::PixelType_BayerRG8:
+      format = VideoPixelFormat::BayerRggb8;
+      break;
+    case Pylon::PixelType_BayerGB8:
+      format = VideoPixelFormat::BayerGbrg8;
+      break;
+    case Pylon::PixelType_Mono12p:
+      format = VideoPixelFormat::Gray12p;
+      break;
+    case Pylon::PixelType_BayerRG12p:
+      format = VideoPixelFormat::BayerRggb12p;
+      break;
+    case Pylon::PixelType_BayerGB12p:
+      format = VideoPixelFormat::BayerGbrg12p;
+      break;
+    default:
+      std::cerr << "Error: Pixel type cannot be recorded." << std::endl;
+      return;
   }
+  const int height = static_cast<int>(ptr->GetHeight());
+  m_recorder->Push(static_cast<const uint8_t*>(ptr->GetBuffer()),
+                   static_cast<int>(ptr->GetWidth()), height,
+                   ptr->GetImageSize() / height, format,
+                   std::chrono::steady_clock::now());
 }
 
-CameraVideoRecorderImageEventHandler::~CameraVideoRecorderImageEventHandler() {
-  if (m_videoWriter.IsOpen()) {
-    m_videoWriter.Close();
+std::string CameraVideoRecorderImageEventHandler::Finish() {
+  const std::string error = m_recorder->Finish();
+  if (m_recorder->GetDroppedFrameCount() > 0) {
+    std::cout << "[DEBUG] Recording dropped "
+              << m_recorder->GetDroppedFrameCount()
+              << " frames while the encoder was behind" << std::endl;
   }
+  return error;
 }
@@ -1,8 +1,10 @@
-
 #ifndef CAMERA_VIDEO_RECORDER_IMAGE_EVENT_HANDLER_H_
 #define CAMERA_VIDEO_RECORDER_IMAGE_EVENT_HANDLER_H_
 
+#include <memory>
+
 #include "flutter_linux/flutter_linux.h"
+#include "video_recorder.h"
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Woverloaded-virtual"
@@ -12,23 +14,24 @@
 
 #pragma clang diagnostic pop
 
-#define CAMERA_VIDEO_RECORDER_PLAY_BACK_FRAME_RATE 60.0
-#define CAMERA_VIDEO_RECORDER_QUALITY 100
-
+// Hands each grabbed frame to a VideoRecorder. Runs on the thread
+// retrieving grab results, so it only copies the frame into the recorder's
+// queue; encoding happens on the recorder's thread.
 class CameraVideoRecorderImageEventHandler : public Pylon::CImageEventHandler {
-  Pylon::CVideoWriter m_videoWriter;
+  std::unique_ptr<VideoRecorder> m_recorder;
 
  public:
   std::string m_videoFilePath;
 
-  CameraVideoRecorderImageEventHandler(std::string videoFilePath);
-
-  ~CameraVideoRecorderImageEventHandler() override;
+  CameraVideoRecorderImageEventHandler(std::string videoFilePath,
+                                       const VideoRecorderSettings& settings);
 
   void OnImageGrabbed(Pylon::CInstantCamera& camera,
                       const Pylon::CGrabResultPtr& ptr) override;
 
-  void OnImageEventHandlerDeregistered(Pylon::CInstantCamera& camera) override;
+  // Encodes the frames still queued and closes the file. Returns the first
+  // error, or an empty string.
+  std::string Finish();
 };
 
-#endif  // CAMERA_VIDEO_RECORDER_IMAGE_EVENT_HANDLER_H_
\ No newline at end of file
+#endif  // CAMERA_VIDEO_RECORDER_IMAGE_EVENT_HANDLER_H_
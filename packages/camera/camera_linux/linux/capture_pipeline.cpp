@@ -3,9 +3,12 @@
 
 #include <GLES3/gl3.h>
 
+#include <cmath>
+#include <stdexcept>
 #include <thread>
 
 #include "camera.h"
+#include "gl_utils.h"
 
 CapturePipeline::CapturePipeline(const Camera& camera,
                                  FlPluginRegistrar* registrar)
@@ -15,210 +18,377 @@ CapturePipeline::CapturePipeline(const Camera& camera,
           fl_plugin_registrar_get_texture_registrar(registrar)) {}
 
 CapturePipeline::~CapturePipeline() {
+  StopGrabbing();
+  if (camera.camera) {
+    // Hand later grabs (e.g. GrabOne in takePicture) back to Pylon's default
+    // allocator before the pool goes away.
+    camera.camera->SetBufferFactory(nullptr, Pylon::Cleanup_None);
+  }
   if (m_fl_texture) {
-    glDeleteTextures(1, &m_fl_texture_name);
+    glDeleteTextures(OUTPUT_TEXTURE_COUNT, m_output_textures);
     fl_texture_registrar_unregister_texture(m_fl_texture_registrar,
                                             FL_TEXTURE(m_fl_texture));
     g_object_unref(m_fl_texture);
   }
 }
 
-//   GenApi::INodeMap& nodemap = camera->GetNodeMap();
-//   Pylon::CEnumParameter(nodemap, "TriggerSelector").SetValue("FrameStart");
-//   Pylon::CEnumParameter(nodemap, "TriggerMode").SetValue("On");
-//   Pylon::CEnumParameter(nodemap, "TriggerSource").SetValue("Software");
-
-//   // Manual grab loop with exposure bracketing
-//   cameraTextureImageEventHandler->OnImageEventHandlerRegistered(*camera);
-
-//   camera->StartGrabbing(Pylon::GrabStrategy_OneByOne,
-//                         Pylon::EGrabLoop::GrabLoop_ProvidedByUser);
-
-//   std::thread([this]() {
-//     double shortExposure = 1000.0;  // µs - initial value
-//     // double longExposure = 128000.0;  // µs
-//     // const double gain = 0.6;
-//     // const double targetBrightness = 120.0;  // target average
-//     // brightness
-
-//     // const double overblownTargetRatio = 0.01;  // 3%
-//     // const double overblownThreshold = 240.0;
-
-//     auto& nodemap = camera->GetNodeMap();
-//     // const double minExposure =
-//     //     Pylon::CFloatParameter(nodemap, "ExposureTime").GetMin();
-//     // const double maxExposure =
-//     //     Pylon::CFloatParameter(nodemap, "ExposureTime").GetMax();
-
-//     while (camera->IsGrabbing()) {
-//       // --- Short exposure ---
-//       Pylon::CFloatParameter(nodemap, "ExposureTime")
-//           .TrySetValue(shortExposure);
-//       camera->WaitForFrameTriggerReady(5000,
-//                                        Pylon::TimeoutHandling_ThrowException);
-//       camera->ExecuteSoftwareTrigger();
-
-//       Pylon::CGrabResultPtr shortResult;
-//       camera->RetrieveResult(5000, shortResult,
-//                              Pylon::TimeoutHandling_ThrowException);
-
-//       // if (shortResult && shortResult->GrabSucceeded()) {
-//       //   cameraTextureImageEventHandler->OnImageGrabbed(*camera,
-//       //   shortResult);
-
-//       //   // === Adjust short exposure for overblown % ===
-//       //   const int width = shortResult->GetWidth();
-//       //   const int height = shortResult->GetHeight();
-//       //   const uint8_t* buffer =
-//       //       static_cast<const uint8_t*>(shortResult->GetBuffer());
-
-//       //   const int cx = width / 2;
-//       //   const int cy = height / 2;
-//       //   const int radius = std::min(width, height) / 4;
-
-//       //   size_t overblown = 0;
-//       //   size_t total = 0;
-
-//       //   for (int y = 0; y < height; ++y) {
-//       //     for (int x = 0; x < width; ++x) {
-//       //       int dx = x - cx;
-//       //       int dy = y - cy;
-//       //       if (dx * dx + dy * dy <= radius * radius) {
-//       //         int index = (y * width + x) * 3;
-//       //         uint8_t r = buffer[index];
-//       //         uint8_t g = buffer[index + 1];
-//       //         uint8_t b = buffer[index + 2];
-//       //         double luminance = 0.299 * r + 0.587 * g + 0.114 * b;
-
-//       //         if (luminance >= overblownThreshold) {
-//       //           overblown++;
-//       //         }
-//       //         total++;
-//       //       }
-//       //     }
-//       //   }
-
-//       //   if (total > 0) {
-//       //     double ratio = static_cast<double>(overblown) / total;
-//       //     double error = overblownTargetRatio - ratio;
-
-//       //     // Adjust short exposure proportionally
-//       //     double proposed =
-//       //         shortExposure * (1.0 + gain * error /
-//       //         overblownTargetRatio);
-//       //     shortExposure =
-//       //         std::max(minExposure, std::min(maxExposure, proposed));
-//       //   }
-//       // }
-
-//       // // --- Long exposure ---
-//       // Pylon::CFloatParameter(nodemap,
-//       // "ExposureTime").TrySetValue(longExposure);
-//       // camera->WaitForFrameTriggerReady(5000,
-//       // Pylon::TimeoutHandling_ThrowException);
-//       // camera->ExecuteSoftwareTrigger();
-
-//       // Pylon::CGrabResultPtr longResult;
-//       // camera->RetrieveResult(5000, longResult,
-//       //                        Pylon::TimeoutHandling_ThrowException);
-//       // if (longResult && longResult->GrabSucceeded()) {
-//       //   cameraTextureImageEventHandler->OnImageGrabbed(*camera,
-//       //   longResult);
-
-//       //   // === Adjust long exposure brightness as before ===
-//       //   const int width = longResult->GetWidth();
-//       //   const int height = longResult->GetHeight();
-//       //   const uint8_t* buffer =
-//       //       static_cast<const uint8_t*>(longResult->GetBuffer());
-
-//       //   const int cx = width / 2;
-//       //   const int cy = height / 2;
-//       //   const int radius = std::min(width, height) / 4;
-
-//       //   uint64_t sum = 0;
-//       //   size_t count = 0;
-
-//       //   for (int y = 0; y < height; ++y) {
-//       //     for (int x = 0; x < width; ++x) {
-//       //       int dx = x - cx;
-//       //       int dy = y - cy;
-//       //       if (dx * dx + dy * dy <= radius * radius) {
-//       //         int index = (y * width + x) * 3;
-//       //         uint8_t r = buffer[index];
-//       //         uint8_t g = buffer[index + 1];
-//       //         uint8_t b = buffer[index + 2];
-//       //         double luminance = 0.299 * r + 0.587 * g + 0.114 * b;
-
-//       //         if (luminance > 10 && luminance < 240) {
-//       //           sum += luminance;
-//       //           count++;
-//       //         }
-//       //       }
-//       //     }
-//       //   }
-
-//       //   if (count > 0) {
-//       //     double avgBrightness = static_cast<double>(sum) / count;
-//       //     double error = targetBrightness - avgBrightness;
-//       //     double proposed =
-//       //         longExposure * (1.0 + gain * error / targetBrightness);
-//       //     longExposure = std::max(minExposure, std::min(maxExposure,
-//       //     proposed));
-//       //   }
-//       // }
-//     }
-//   }).detach();
-// }
-
 void CapturePipeline::StartGrabbing() {
-  if (!camera.camera) {
+  FrameSource* source = camera.frameSource.get();
+  if (!source) {
     std::cerr << "Camera is not initialized." << std::endl;
     return;
   }
-  GenApi::INodeMap& nodemap = camera.camera->GetNodeMap();
-  Pylon::CEnumParameter(nodemap, "TriggerSelector").SetValue("FrameStart");
-  Pylon::CEnumParameter(nodemap, "TriggerMode").SetValue("On");
-  Pylon::CEnumParameter(nodemap, "TriggerSource").SetValue("Software");
+  // Restarts from the bracket last requested, before auto exposure.
+  SetExposureBracket(camera.exposureBracketUs, camera.exposureBracketGains);
+  TakePendingExposureBracket();
+  SetToneMapping(camera.toneMappingOperator, camera.toneMappingKey,
+                 camera.toneMappingAdaptationSeconds);
+  SetAutoExposure(camera.autoExposureSettings);
+  SetDemosaicAlgorithm(camera.demosaicAlgorithm);
+  m_use_sequencer = false;
+  m_first_frame_id = -1;
+  // Generated and replayed frames need no setup.
+  if (Pylon::CInstantCamera* device = source->GetCamera()) {
+    GenApi::INodeMap& nodemap = device->GetNodeMap();
+    m_use_sequencer = ConfigureSequencer(nodemap);
+    ConfigureTriggering(nodemap);
+    ConfigureGrabBufferPool(nodemap);
+
+    Pylon::CFloatParameter exposureTime(nodemap, "ExposureTime");
+    if (exposureTime.IsReadable()) {
+      m_auto_exposure.SetExposureLimits(exposureTime.GetMin(),
+                                        exposureTime.GetMax());
+    }
+  }
+
+  source->Start();
 
-  camera.camera->StartGrabbing(Pylon::GrabStrategy_OneByOne,
-                               Pylon::EGrabLoop::GrabLoop_ProvidedByUser);
+  std::cout << "Starting camera grabbing ("
+            << (m_use_sequencer ? "sequencer" : "software trigger")
+            << " bracketing)..." << std::endl;
 
-  std::cout << "Starting camera grabbing..." << std::endl;
+  m_frame_queue = std::make_unique<FrameQueue<GrabbedFrame>>(
+      camera.frameQueueCapacity, camera.frameQueuePolicy);
 
-  std::thread([this]() {
+  m_gl_thread = std::thread([this]() {
     GLInit();
     notifyTextureReady();
 
-    std::vector<double> exposureLevels = {2000.0, 16000.0};
-    size_t exposureIndex = 0;
-    GenApi::INodeMap& nodemap = camera.camera->GetNodeMap();
-
-    while (camera.camera->IsGrabbing()) {
-      // Set new exposure
-      double exposure = exposureLevels[exposureIndex];
-      exposureIndex = (exposureIndex + 1) % exposureLevels.size();
-      Pylon::CFloatParameter(nodemap, "ExposureTime").TrySetValue(exposure);
-      std::cout << "Set exposure to: " << exposure << "us" << std::endl;
-
-      camera.camera->WaitForFrameTriggerReady(5000,
-                                              Pylon::TimeoutHandling_Return);
-      camera.camera->ExecuteSoftwareTrigger();
-      Pylon::CGrabResultPtr grabResult;
-      if (!camera.camera->RetrieveResult(5000, grabResult,
-                                         Pylon::TimeoutHandling_Return)) {
+    for (;;) {
+      GrabbedFrame frame;
+      if (!m_frame_queue->Pop(frame, std::chrono::milliseconds(100))) {
+        if (m_frame_queue->IsClosed()) break;
         continue;
       }
-      std::cout << "image grabbed" << std::endl;
+      OnImageGrabbed(frame);
+    }
 
-      if (!grabResult->GrabSucceeded()) {
-        std::cerr << "Error grabbing image: "
-                  << grabResult->GetErrorDescription() << std::endl;
+    // The ring owns fences and a mapping, the passes their GL objects:
+    // release them on this context.
+    gdk_gl_context_make_current(m_gl_context);
+    m_frame_processor.reset();
+    m_luminance_readback.reset();
+    m_stream_readback.reset();
+    m_stream_downscale_pass.reset();
+    glDeleteTextures(1, &m_stream_texture);
+    m_stream_texture = 0;
+    m_image_stream.reset();
+    m_record_readback.reset();
+    m_record_copy_pass.reset();
+    m_nv12_pass.reset();
+    glDeleteTextures(1, &m_record_texture);
+    m_record_texture = 0;
+    m_record_times.clear();
+    m_video_recorder.reset();
+    m_preview_downscale_pass.reset();
+    glDeleteTextures(1, &m_frame_texture);
+    m_frame_texture = 0;
+    m_zsl_ring.reset();
+    m_gpu_timer.reset();
+  });
+
+  m_grab_thread = std::thread([this]() {
+    size_t exposureIndex = 0;
+    FrameSource& source = *camera.frameSource;
+    Pylon::CInstantCamera* device = source.GetCamera();
+
+    while (source.IsGrabbing()) {
+      if (m_bracket_pending.load(std::memory_order_acquire)) {
+        const size_t previousSize = m_exposure_levels.size();
+        if (device) {
+          ApplyPendingExposureBracket(*device);
+        } else {
+          TakePendingExposureBracket();
+        }
+        // New levels alone (auto exposure) keep the software trigger cycle
+        // going; a reprogrammed sequencer restarts at its first set.
+        if (m_use_sequencer || m_exposure_levels.size() != previousSize) {
+          exposureIndex = 0;
+        }
+      }
+      const size_t triggeredSlot = exposureIndex;
+      exposureIndex = (exposureIndex + 1) % m_exposure_levels.size();
+      GrabbedFrame frame;
+      try {
+        if (!m_use_sequencer) {
+          source.Trigger(m_exposure_levels[triggeredSlot],
+                         m_gain_levels.empty() ? NAN
+                                               : m_gain_levels[triggeredSlot]);
+        }
+        if (!source.Retrieve(frame.image, std::chrono::milliseconds(5000))) {
+          continue;
+        }
+      } catch (const Pylon::GenericException& e) {
+        // StopGrabbing() may race with the trigger/retrieve calls.
+        if (!source.IsGrabbing()) break;
+        std::cerr << "Error in grab loop: " << e.GetDescription() << std::endl;
         continue;
       }
-      OnImageGrabbed(grabResult);
-      std::cout << "finish processing frame" << std::endl;
+
+      frame.timestamp = std::chrono::steady_clock::now();
+      // Copied here rather than on the GL thread, so a burst keeps up with
+      // the sensor even when rendering drops frames.
+      std::shared_ptr<BurstCapture> burst = std::atomic_load(&m_burst);
+      if (burst && burst->Push(frame.image, frame.timestamp)) {
+        std::atomic_store(&m_burst, std::shared_ptr<BurstCapture>());
+      }
+      frame.bracketSlot = GetBracketSlot(frame.image, triggeredSlot);
+      frame.bracketSize = m_exposure_levels.size();
+      if (frame.image.exposureUs > 0.0) {
+        // Replayed frames carry the exposure they were recorded with.
+        frame.exposureUs = frame.image.exposureUs;
+        frame.gainDb = frame.image.gainDb;
+      } else {
+        frame.exposureUs = m_exposure_levels[frame.bracketSlot];
+        if (!m_gain_levels.empty()) {
+          frame.gainDb = m_gain_levels[frame.bracketSlot];
+        }
+      }
+      m_frame_queue->Push(std::move(frame));
+    }
+  });
+}
+
+void CapturePipeline::ConfigureTriggering(GenApi::INodeMap& nodemap) {
+  if (m_use_sequencer) {
+    // Free-running: the sequencer advances to the next exposure set on every
+    // frame, so no per-frame round trip is needed.
+    Pylon::CEnumParameter(nodemap, "TriggerSelector").SetValue("FrameStart");
+    Pylon::CEnumParameter(nodemap, "TriggerMode").SetValue("Off");
+  } else {
+    Pylon::CEnumParameter(nodemap, "TriggerSelector").SetValue("FrameStart");
+    Pylon::CEnumParameter(nodemap, "TriggerMode").SetValue("On");
+    Pylon::CEnumParameter(nodemap, "TriggerSource").SetValue("Software");
+  }
+}
+
+void CapturePipeline::SetExposureBracket(const std::vector<double>& exposuresUs,
+                                         const std::vector<double>& gains) {
+  std::lock_guard<std::mutex> lock(m_bracket_mutex);
+  m_pending_exposure_levels = exposuresUs;
+  m_pending_gain_levels = gains;
+  m_bracket_pending.store(true, std::memory_order_release);
+}
+
+void CapturePipeline::SetToneMapping(ToneMappingOperator toneOperator,
+                                     float key, float adaptationSeconds) {
+  m_tone_mapping_key.store(key);
+  m_tone_mapping_adaptation_time.store(adaptationSeconds);
+  m_tone_mapping_operator.store(toneOperator);
+}
+
+void CapturePipeline::SetDemosaicAlgorithm(DemosaicAlgorithm algorithm) {
+  m_demosaic_algorithm.store(algorithm);
+}
+
+void CapturePipeline::SetAutoExposure(const AutoExposureSettings& settings) {
+  m_auto_exposure.SetSettings(settings);
+}
+
+void CapturePipeline::UpdateAutoExposure(
+    const LuminanceReadback::Result& stats) {
+  std::vector<double> exposures;
+  {
+    std::lock_guard<std::mutex> lock(m_bracket_mutex);
+    if (m_bracket_pending.load(std::memory_order_acquire)) {
+      // Not applied yet, or a bracket set through the API: wait for it.
+      return;
+    }
+    exposures = m_exposure_levels;
+  }
+  if (!m_auto_exposure.Update(stats.histogram, stats.slot, stats.exposureUs,
+                              exposures)) {
+    return;
+  }
+
+  // Software triggering applies new levels on the next trigger for free, but
+  // the sequencer has to stop the camera for each change: rate-limit those.
+  const auto now = std::chrono::steady_clock::now();
+  if (m_use_sequencer &&
+      now - m_last_sequencer_update <
+          std::chrono::milliseconds(AUTO_EXPOSURE_SEQUENCER_INTERVAL_MS)) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(m_bracket_mutex);
+  if (m_bracket_pending.load(std::memory_order_acquire) ||
+      exposures.size() != m_exposure_levels.size()) {
+    return;
+  }
+  m_last_sequencer_update = now;
+  m_pending_exposure_levels = std::move(exposures);
+  m_pending_gain_levels = m_gain_levels;
+  m_bracket_pending.store(true, std::memory_order_release);
+}
+
+bool CapturePipeline::TakePendingExposureBracket() {
+  std::lock_guard<std::mutex> lock(m_bracket_mutex);
+  if (!m_bracket_pending.load(std::memory_order_acquire)) {
+    return false;
+  }
+  m_exposure_levels = std::move(m_pending_exposure_levels);
+  m_gain_levels = std::move(m_pending_gain_levels);
+  m_bracket_pending.store(false, std::memory_order_release);
+  return true;
+}
+
+void CapturePipeline::ApplyPendingExposureBracket(
+    Pylon::CInstantCamera& device) {
+  const bool wasUsingSequencer = m_use_sequencer;
+  if (!TakePendingExposureBracket() || !wasUsingSequencer) {
+    // Software triggering picks the new levels up on the next trigger.
+    return;
+  }
+
+  // Sequencer sets can only be rewritten while acquisition is stopped. Only
+  // the camera pauses: the stream, its buffers and the GL side stay up.
+  GenApi::INodeMap& nodemap = device.GetNodeMap();
+  try {
+    Pylon::CCommandParameter(nodemap, "AcquisitionStop").TryExecute();
+    // Frames still queued were exposed with the old sets: drop them so the
+    // slot count restarts at the first frame of the new sequence.
+    Pylon::CGrabResultPtr staleResult;
+    while (device.RetrieveResult(0, staleResult,
+                                 Pylon::TimeoutHandling_Return)) {
+    }
+    m_use_sequencer = ConfigureSequencer(nodemap);
+    m_first_frame_id = -1;
+    ConfigureTriggering(nodemap);
+    Pylon::CCommandParameter(nodemap, "AcquisitionStart").TryExecute();
+  } catch (const Pylon::GenericException& e) {
+    std::cerr << "Failed to apply the exposure bracket: " << e.GetDescription()
+              << std::endl;
+  }
+  std::cout << "[DEBUG] Exposure bracket set to " << m_exposure_levels.size()
+            << " exposures." << std::endl;
+}
+
+void CapturePipeline::ConfigureGrabBufferPool(GenApi::INodeMap& nodemap) {
+  // Sized last: enabling chunks in ConfigureSequencer grows the payload.
+  const size_t payloadSize = static_cast<size_t>(
+      Pylon::CIntegerParameter(nodemap, "PayloadSize").GetValue());
+  const size_t bufferCount =
+      static_cast<size_t>(camera.camera->MaxNumBuffer.GetValue());
+
+  if (!m_grab_buffer_pool ||
+      m_grab_buffer_pool->GetBufferStride() < payloadSize ||
+      m_grab_buffer_pool->GetBufferCount() != bufferCount) {
+    // Not grabbing, so no buffer of the previous pool is still queued.
+    camera.camera->SetBufferFactory(nullptr, Pylon::Cleanup_None);
+    m_grab_buffer_pool =
+        std::make_unique<GrabBufferPool>(bufferCount, payloadSize);
+    std::cout << "[DEBUG] Allocated grab buffer pool: " << bufferCount << " x "
+              << m_grab_buffer_pool->GetBufferStride() << " bytes"
+              << std::endl;
+  }
+  camera.camera->SetBufferFactory(m_grab_buffer_pool.get(),
+                                  Pylon::Cleanup_None);
+}
+
+bool CapturePipeline::ConfigureSequencer(GenApi::INodeMap& nodemap) {
+  Pylon::CEnumParameter sequencerMode(nodemap, "SequencerMode");
+  Pylon::CEnumParameter configurationMode(nodemap,
+                                          "SequencerConfigurationMode");
+  // Emulated and older cameras have no sequencer: use software triggers.
+  if (!sequencerMode.IsWritable()) {
+    return false;
+  }
+
+  try {
+    sequencerMode.SetValue("Off");
+    configurationMode.SetValue("On");
+
+    const int64_t setCount = static_cast<int64_t>(m_exposure_levels.size());
+    for (int64_t set = 0; set < setCount; ++set) {
+      Pylon::CIntegerParameter(nodemap, "SequencerSetSelector").SetValue(set);
+      Pylon::CFloatParameter(nodemap, "ExposureTime")
+          .SetValue(m_exposure_levels[set]);
+      if (!m_gain_levels.empty()) {
+        Pylon::CFloatParameter(nodemap, "Gain").TrySetValue(m_gain_levels[set]);
+      }
+      Pylon::CIntegerParameter(nodemap, "SequencerPathSelector")
+          .TrySetValue(0);
+      Pylon::CIntegerParameter(nodemap, "SequencerSetNext")
+          .SetValue((set + 1) % setCount);
+      Pylon::CEnumParameter triggerSource(nodemap, "SequencerTriggerSource");
+      if (!triggerSource.TrySetValue("ExposureActive") &&
+          !triggerSource.TrySetValue("FrameStart")) {
+        triggerSource.SetValue("ExposureStart");
+      }
+      Pylon::CEnumParameter(nodemap, "SequencerTriggerActivation")
+          .TrySetValue("RisingEdge");
+      Pylon::CCommandParameter(nodemap, "SequencerSetSave").Execute();
     }
-  }).detach();
+
+    Pylon::CIntegerParameter(nodemap, "SequencerSetStart").TrySetValue(0);
+    configurationMode.SetValue("Off");
+    sequencerMode.SetValue("On");
+  } catch (const Pylon::GenericException& e) {
+    std::cerr << "Failed to program the exposure sequencer: "
+              << e.GetDescription() << std::endl;
+    DisableSequencer(nodemap);
+    return false;
+  }
+
+  // Tag each frame with the set that produced it, so the bracket slot
+  // survives dropped frames.
+  if (Pylon::CBooleanParameter(nodemap, "ChunkModeActive").TrySetValue(true) &&
+      Pylon::CEnumParameter(nodemap, "ChunkSelector")
+          .TrySetValue("SequencerSetActive")) {
+    Pylon::CBooleanParameter(nodemap, "ChunkEnable").TrySetValue(true);
+  }
+  return true;
+}
+
+void CapturePipeline::DisableSequencer(GenApi::INodeMap& nodemap) {
+  Pylon::CEnumParameter(nodemap, "SequencerMode").TrySetValue("Off");
+  Pylon::CEnumParameter(nodemap, "SequencerConfigurationMode")
+      .TrySetValue("Off");
+  if (Pylon::CEnumParameter(nodemap, "ChunkSelector")
+          .TrySetValue("SequencerSetActive")) {
+    Pylon::CBooleanParameter(nodemap, "ChunkEnable").TrySetValue(false);
+  }
+  Pylon::CBooleanParameter(nodemap, "ChunkModeActive").TrySetValue(false);
+}
+
+size_t CapturePipeline::GetBracketSlot(const SourceFrame& image,
+                                       size_t triggeredSlot) {
+  // Set by the sequencer's chunk data, or recorded with a replayed frame
+  const size_t setCount = m_exposure_levels.size();
+  if (image.sequencerSet >= 0) {
+    return static_cast<size_t>(image.sequencerSet) % setCount;
+  }
+  if (!m_use_sequencer) {
+    return triggeredSlot;
+  }
+
+  // No chunk data: the sequencer starts at set 0 and advances once per
+  // frame, so derive the set from the camera's frame ID.
+  const int64_t frameId = image.frameId;
+  if (m_first_frame_id < 0) {
+    m_first_frame_id = frameId;
+  }
+  return static_cast<size_t>(frameId - m_first_frame_id) % setCount;
 }
 
 void CapturePipeline::notifyTextureReady() {
@@ -245,111 +415,89 @@ void CapturePipeline::GLInit() {
   std::cout << "[DEBUG] Camera resolution: " << width << "x" << height
             << std::endl;
 
-  // 1. Create PBO ring buffer
-  m_ring_buffer_index = 0;
-  glGenBuffers(RING_BUFFER_SIZE, m_pbo_ring_buffer);
-  for (size_t i = 0; i < RING_BUFFER_SIZE; ++i) {
-    glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pbo_ring_buffer[i]);
-    glBufferData(GL_PIXEL_PACK_BUFFER, width * height * 3, nullptr,
-                 GL_STREAM_READ);
-    std::cout << "[DEBUG] Created PBO buffer ID: " << m_pbo_ring_buffer[i]
-              << std::endl;
+  // 1. Create the Luminance Readback that meters auto exposure
+  m_luminance_readback =
+      std::make_unique<LuminanceReadback>(LUMINANCE_READBACK_DEPTH);
+
+  // 2. Resolve the configured render formats against the context
+  const GLenum intermediateFormat =
+      ResolveRenderFormat(camera.renderIntermediateFormat);
+  const GLenum displayFormat = ResolveRenderFormat(camera.renderDisplayFormat);
+  m_render_formats_name = std::string(GetFormatName(intermediateFormat)) +
+                          "/" + GetFormatName(displayFormat);
+  std::cout << "[DEBUG] Intermediate/display formats: "
+            << m_render_formats_name << std::endl;
+
+  // 3. Create the Frame Processor: the upload, unpack, demosaic, HDR
+  // fusion and tone mapping passes, sized by the first frame
+  m_frame_processor = std::make_unique<FrameProcessor>(
+      intermediateFormat, camera.uploadRingDepth);
+  m_gpu_timer = std::make_unique<GpuTimer>();
+  m_rendered_frame_count = 0;
+  m_last_report_time = std::chrono::steady_clock::now();
+  if (!m_gpu_timer->IsSupported()) {
+    std::cout << "[DEBUG] GPU timer queries unavailable." << std::endl;
   }
-  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
 
-  glGenTextures(RING_BUFFER_SIZE, m_exposure_textures);
-  for (int i = 0; i < RING_BUFFER_SIZE; ++i) {
-    glBindTexture(GL_TEXTURE_2D, m_exposure_textures[i]);
+  // 4. Create Output Textures at the preview size
+  m_preview_width = camera.previewWidth;
+  m_preview_height = camera.previewHeight;
+  GetDownscaledSize(width, height, m_preview_width, m_preview_height);
+  std::cout << "[DEBUG] Preview resolution: " << m_preview_width << "x"
+            << m_preview_height << std::endl;
+  glGenTextures(OUTPUT_TEXTURE_COUNT, m_output_textures);
+  for (int i = 0; i < OUTPUT_TEXTURE_COUNT; ++i) {
+    glBindTexture(GL_TEXTURE_2D, m_output_textures[i]);
+    glTexStorage2D(GL_TEXTURE_2D, 1, displayFormat, m_preview_width,
+                   m_preview_height);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    std::cout << "[DEBUG] Created output texture ID: " << m_output_textures[i]
+              << std::endl;
+  }
+  m_output_texture = m_output_textures[0];
+
+  // A smaller preview is scaled from a full-resolution frame, which stays
+  // available to the image stream, stills and recording.
+  if (m_preview_width != width || m_preview_height != height) {
+    glGenTextures(1, &m_frame_texture);
+    glBindTexture(GL_TEXTURE_2D, m_frame_texture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, displayFormat, width, height);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    m_preview_downscale_pass =
+        std::make_unique<DownscalePass>("preview_scale");
+    m_output_texture = m_frame_texture;
   }
   glBindTexture(GL_TEXTURE_2D, 0);
 
-  // 2. Create Motion Mask Texture
-  // glGenTextures(1, &m_motion_mask_texture);
-  // glBindTexture(GL_TEXTURE_2D, m_motion_mask_texture);
-  // glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, width, height, 0, GL_RED,
-  //              GL_UNSIGNED_BYTE, nullptr);
-  // glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-  // glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-  // std::cout << "[DEBUG] Created motion mask texture ID: "
-  //           << m_motion_mask_texture << std::endl;
-
-  // 3. Create HDR Fusion Shader Program
-  m_hdr_fusion_shader_program = createHDRShaderProgram();
-  std::cout << "[DEBUG] Created HDR fusion shader program ID: "
-            << m_hdr_fusion_shader_program << std::endl;
-
-  float quadVertices[] = {
-      // pos     // tex
-      -1.0f, -1.0f, 0.0f, 0.0f, 1.0f, -1.0f, 1.0f, 0.0f,
-      -1.0f, 1.0f,  0.0f, 1.0f, 1.0f, 1.0f,  1.0f, 1.0f,
-  };
-
-  glGenVertexArrays(1, &m_hdr_fusion_vao);
-  glGenFramebuffers(1, &m_hdr_fusion_fbo);
-  glBindVertexArray(m_hdr_fusion_vao);
-  glBindBuffer(GL_ARRAY_BUFFER, m_hdr_fusion_vbo);
-  glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices), quadVertices,
-               GL_STATIC_DRAW);
-
-  glEnableVertexAttribArray(0);
-  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
-  glEnableVertexAttribArray(1);
-  glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float),
-                        (void*)(2 * sizeof(float)));
-
-  glBindVertexArray(0);
-  std::cout << "[DEBUG] Created HDR fusion VAO: " << m_hdr_fusion_vao
-            << ", VBO: " << m_hdr_fusion_vbo << std::endl;
-
-  // 4. Create Tone Mapping Shader Program
-  // TODO: Add debug print here when implemented
-
-  // 5. Create Mono Shader Program
-  // m_mono_shader_program = createMonoShaderProgram();
-  // std::cout << "[DEBUG] Created Mono shader program ID: "
-  //           << m_mono_shader_program << std::endl;
-
-  // float quadVerticesMono[] = {
-  //     // pos     // tex
-  //     -1.0f, -1.0f, 0.0f, 0.0f, 1.0f, -1.0f, 1.0f, 0.0f,
-  //     -1.0f, 1.0f,  0.0f, 1.0f, 1.0f, 1.0f,  1.0f, 1.0f,
-  // };
-
-  // glGenVertexArrays(1, &m_mono_vao);
-  // glGenBuffers(1, &m_mono_vbo);
-  // glBindVertexArray(m_mono_vao);
-  // glBindBuffer(GL_ARRAY_BUFFER, m_mono_vbo);
-  // glBufferData(GL_ARRAY_BUFFER, sizeof(quadVerticesMono), quadVerticesMono,
-  //              GL_STATIC_DRAW);
-
-  // glEnableVertexAttribArray(0);
-  // glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float),
-  // (void*)0); glEnableVertexAttribArray(1); glVertexAttribPointer(1, 2,
-  // GL_FLOAT, GL_FALSE, 4 * sizeof(float),
-  //                       (void*)(2 * sizeof(float)));
-
-  // glBindVertexArray(0);
-  // std::cout << "[DEBUG] Created Mono VAO: " << m_mono_vao
-  //           << ", VBO: " << m_mono_vbo << std::endl;
-
-  // 6. Create Output Texture
-  glGenTextures(1, &m_output_texture);
-  glBindTexture(GL_TEXTURE_2D, m_output_texture);
-  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB8, width, height, 0, GL_RGB,
-               GL_UNSIGNED_BYTE, nullptr);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-  std::cout << "[DEBUG] Created output texture ID: " << m_output_texture
-            << std::endl;
+  // 5. Create the Image Stream's Downscale Pass and readback, whose target
+  // is sized by the stream
+  m_stream_downscale_pass = std::make_unique<DownscalePass>("stream_scale");
+  m_stream_downscale_pass->SetSwapRedBlue(true);
+  m_stream_readback = std::make_unique<FrameReadback>(IMAGE_STREAM_CREDITS);
+  m_stream_width = 0;
+  m_stream_height = 0;
+
+  // 6. Create the Recording's NV12 and copy passes and readback, whose
+  // targets are sized by the first recorded frame
+  m_nv12_pass = std::make_unique<Nv12Pass>();
+  m_record_copy_pass = std::make_unique<DownscalePass>("record_copy");
+  m_record_readback = std::make_unique<FrameReadback>(RECORD_READBACK_DEPTH);
+  m_record_width = 0;
+  m_record_height = 0;
+
+  // 7. Create the Zero-Shutter-Lag Ring, whose textures are sized by the
+  // first frame
+  if (camera.zslFrameCount > 0) {
+    m_zsl_ring = std::make_unique<ZslRing>(camera.zslFrameCount,
+                                           camera.zslRawFrames);
+  }
 
-  // 7. Wrap output texture for Flutter
-  m_fl_texture =
-      fl_lightx_texture_gl_new(GL_TEXTURE_2D, m_output_texture, width, height);
-  m_fl_texture_name = m_output_texture;
+  // 8. Wrap output textures for Flutter
+  m_fl_texture = fl_lightx_texture_gl_new_mailbox(
+      GL_TEXTURE_2D, m_output_textures, OUTPUT_TEXTURE_COUNT, m_preview_width,
+      m_preview_height);
   fl_texture_registrar_register_texture(m_fl_texture_registrar,
                                         FL_TEXTURE(m_fl_texture));
   fl_texture_registrar_mark_texture_frame_available(m_fl_texture_registrar,
@@ -359,221 +507,301 @@ void CapturePipeline::GLInit() {
             << m_output_texture << std::endl;
 }
 
-void CapturePipeline::StopGrabbing() {}
-void CapturePipeline::OnImageGrabbed(const Pylon::CGrabResultPtr& grabResult) {
-  if (!grabResult || !grabResult->GrabSucceeded()) {
-    std::cerr << "[DEBUG] Error grabbing image: "
-              << (grabResult ? grabResult->GetErrorDescription() : "No result")
-              << std::endl;
-    return;
+void CapturePipeline::StopGrabbing() {
+  if (camera.frameSource) {
+    camera.frameSource->Stop();
+  }
+  if (m_frame_queue) {
+    // Unblocks a Block-policy producer and lets the GL thread drain and exit.
+    m_frame_queue->Close();
+  }
+  if (m_grab_thread.joinable()) {
+    m_grab_thread.join();
+  }
+  if (m_gl_thread.joinable()) {
+    m_gl_thread.join();
   }
+  std::shared_ptr<BurstCapture> burst =
+      std::atomic_exchange(&m_burst, std::shared_ptr<BurstCapture>());
+  if (burst) {
+    burst->Cancel();
+  }
+  if (camera.camera && m_use_sequencer) {
+    DisableSequencer(camera.camera->GetNodeMap());
+    m_use_sequencer = false;
+  }
+}
 
-  const int width = grabResult->GetWidth();
-  const int height = grabResult->GetHeight();
-  const uint8_t* data = static_cast<const uint8_t*>(grabResult->GetBuffer());
-  if (!data) {
+void CapturePipeline::OnImageGrabbed(const GrabbedFrame& frame) {
+  const SourceFrame& image = frame.image;
+  const size_t bracketSlot = frame.bracketSlot;
+  const int width = image.width;
+  const int height = image.height;
+  if (!image.pixels) {
     std::cerr << "[DEBUG] No image data available." << std::endl;
     return;
   }
 
   gdk_gl_context_make_current(m_gl_context);
 
-  const int bufferIndex = m_ring_buffer_index;
-  const int nextIndex = (m_ring_buffer_index + 1) % RING_BUFFER_SIZE;
-
-  GLuint pbo = m_pbo_ring_buffer[bufferIndex];
-  GLuint texture = m_exposure_textures[bufferIndex];
-
-  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo);
-  glBufferData(GL_PIXEL_UNPACK_BUFFER, width * height * 3, nullptr,
-               GL_STREAM_DRAW);
-
-  void* ptr = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, width * height * 3,
-                               GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
-  if (ptr) {
-    std::memcpy(ptr, data, width * height * 3);
-    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
-  } else {
-    std::cerr << "[ERROR] Failed to map PBO" << std::endl;
+  if (!m_frame_processor->Upload(image, bracketSlot, frame.bracketSize,
+                                 frame.exposureUs, frame.gainDb,
+                                 m_demosaic_algorithm.load(), *m_gpu_timer)) {
+    return;
   }
 
-  // Upload from PBO to texture (allocated only once elsewhere)
-  glBindTexture(GL_TEXTURE_2D, texture);
-  glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGB,
-                  GL_UNSIGNED_BYTE, nullptr);
-  glBindTexture(GL_TEXTURE_2D, 0);
-  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
-
-  std::cout << "[DEBUG] Uploaded image data to texture index " << bufferIndex
-            << std::endl;
-
-  m_ring_buffer_index = nextIndex;
-
-  // --- HDR Shader Pass ---
-  glBindFramebuffer(GL_FRAMEBUFFER, m_hdr_fusion_fbo);
-  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
-                         m_output_texture, 0);
+  // Raw frames are kept as grabbed, each exposure of a bracket on its own.
+  if (m_zsl_ring && m_zsl_ring->IsRaw()) {
+    m_zsl_ring->PushRaw(image.pixels, image.size, image.pixelType, width,
+                        height, image.paddingX, frame.timestamp);
+    ServeStillRequests(frame.timestamp);
+  }
 
-  if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
-    std::cerr << "[ERROR] Framebuffer not complete." << std::endl;
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  // Flutter still holds every other slot: skip rendering, the next frame
+  // will be newer anyway.
+  const int outputSlot = fl_lightx_texture_gl_acquire_slot(m_fl_texture);
+  if (outputSlot < 0) {
     return;
   }
-
-  glViewport(0, 0, width, height);
-  glUseProgram(m_hdr_fusion_shader_program);
-
-  const char* uniformNames[] = {"texLow", "texMidLow"};
-  for (int i = 0; i < 2; ++i) {
-    glActiveTexture(GL_TEXTURE0 + i);
-    glBindTexture(GL_TEXTURE_2D, m_exposure_textures[i]);
-    GLint loc =
-        glGetUniformLocation(m_hdr_fusion_shader_program, uniformNames[i]);
-    glUniform1i(loc, i);
+  const GLuint outputTexture = m_output_textures[outputSlot];
+  m_output_texture = m_frame_texture ? m_frame_texture : outputTexture;
+
+  const auto now = std::chrono::steady_clock::now();
+  const float elapsedSeconds =
+      std::chrono::duration<float>(now - m_last_render_time).count();
+  m_last_render_time = now;
+
+  // --- HDR and Tone Mapping Shader Passes ---
+  m_frame_processor->Render(m_output_texture, width, height,
+                            m_tone_mapping_operator.load(),
+                            m_tone_mapping_key.load(),
+                            m_tone_mapping_adaptation_time.load(),
+                            elapsedSeconds, *m_gpu_timer);
+
+  // --- Auto Exposure Metering ---
+  // The fusion pass just rebuilt the exposure mips: meter this frame's layer
+  // from a small level, and act on reads queued by earlier frames.
+  if (m_auto_exposure.IsEnabled()) {
+    LuminanceReadback::Result stats;
+    while (m_luminance_readback->Poll(stats)) {
+      UpdateAutoExposure(stats);
+    }
+    m_gpu_timer->Begin("ae_readback");
+    ExposureFusionPass& fusion = m_frame_processor->GetFusionPass();
+    m_luminance_readback->Request(
+        fusion.GetExposureTextureArray(), static_cast<GLint>(bracketSlot),
+        width, height, fusion.GetLevelCount(),
+        fusion.GetExposureInternalFormat(), bracketSlot, frame.exposureUs);
+    m_gpu_timer->End();
   }
 
-  glBindVertexArray(m_hdr_fusion_vao);
-  glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-
-  // Cleanup
-  glBindVertexArray(0);
-  for (int i = 0; i < 2; ++i) {
-    glActiveTexture(GL_TEXTURE0 + i);
-    glBindTexture(GL_TEXTURE_2D, 0);
+  // --- Zero-Shutter-Lag Ring ---
+  if (m_zsl_ring && !m_zsl_ring->IsRaw()) {
+    m_zsl_ring->PushProcessed(m_output_texture, width, height,
+                              frame.timestamp, *m_gpu_timer);
+    ServeStillRequests(frame.timestamp);
   }
-  glBindFramebuffer(GL_FRAMEBUFFER, 0);
-  glUseProgram(0);
-
-  // Notify Flutter
-  glFlush();
-  fl_texture_registrar_mark_texture_frame_available(m_fl_texture_registrar,
-                                                    FL_TEXTURE(m_fl_texture));
-}
 
-int64_t CapturePipeline::get_texture_id() {
-  if (!m_fl_texture) {
-    std::cerr << "Texture is null" << std::endl;
-    return -1;
+  // --- Preview Downscale Pass ---
+  if (m_preview_downscale_pass) {
+    m_preview_downscale_pass->Render(m_output_texture, width, height,
+                                     outputTexture, m_preview_width,
+                                     m_preview_height, *m_gpu_timer);
   }
-  return fl_texture_get_id(FL_TEXTURE(m_fl_texture));
-}
 
-void CapturePipeline::OnNewFrame() {}
-
-GLuint CapturePipeline::compileShader(GLenum type, const char* src) {
-  GLuint shader = glCreateShader(type);
-  glShaderSource(shader, 1, &src, nullptr);
-  glCompileShader(shader);
-  GLint success;
-  glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
-  if (!success) {
-    char log[512];
-    glGetShaderInfoLog(shader, 512, nullptr, log);
-    std::cerr << "Shader compile error: " << log << std::endl;
-  }
-  return shader;
-}
-
-GLuint CapturePipeline::createMonoShaderProgram() {
-  const char* vertexSrc = R"(
-    #version 300 es
-    precision mediump float;
-    layout (location = 0) in vec2 position;
-    layout (location = 1) in vec2 texCoord;
-    out vec2 TexCoords;
-    void main() {
-      TexCoords = texCoord;
-      gl_Position = vec4(position, 0.0, 1.0);
+  // --- Image Stream ---
+  StreamFrame(width, height);
+
+  // --- Recording ---
+  RecordFrame(width, height, frame.timestamp);
+
+  m_gpu_timer->EndFrame();
+  if (++m_rendered_frame_count % GPU_TIMER_REPORT_INTERVAL == 0) {
+    const auto reportTime = std::chrono::steady_clock::now();
+    const double fps =
+        GPU_TIMER_REPORT_INTERVAL /
+        std::chrono::duration<double>(reportTime - m_last_report_time).count();
+    m_last_report_time = reportTime;
+    std::cout << "[DEBUG] " << fps << " fps (" << m_render_formats_name
+              << "), GPU time: " << m_gpu_timer->Report() << std::endl;
+    std::cout << "[DEBUG] Frame queue: " << m_frame_queue->GetDepth() << "/"
+              << m_frame_queue->GetCapacity() << " queued, "
+              << m_frame_queue->GetDroppedCount() << " frames dropped."
+              << std::endl;
+    if (m_image_stream) {
+      std::cout << "[DEBUG] Image stream: "
+                << m_image_stream->GetDroppedFrameCount()
+                << " frames dropped." << std::endl;
     }
-  )";
-
-  const char* fragmentSrc = R"(
-    #version 300 es
-    precision mediump float;
-    in vec2 TexCoords;
-    out vec4 FragColor;
-    uniform sampler2D monoTexture;
-    void main() {
-      float gray = texture(monoTexture, TexCoords).r;
-      FragColor = vec4(gray, gray, gray, 1.0);  // convert mono to RGB
+    if (m_video_recorder) {
+      std::cout << "[DEBUG] Recording: "
+                << m_video_recorder->GetDroppedFrameCount()
+                << " frames dropped." << std::endl;
     }
-  )";
-
-  GLuint vs = compileShader(GL_VERTEX_SHADER, vertexSrc);
-  GLuint fs = compileShader(GL_FRAGMENT_SHADER, fragmentSrc);
-
-  GLuint program = glCreateProgram();
-  glAttachShader(program, vs);
-  glAttachShader(program, fs);
-  glLinkProgram(program);
+  }
 
-  GLint success;
-  glGetProgramiv(program, GL_LINK_STATUS, &success);
-  if (!success) {
-    char log[512];
-    glGetProgramInfoLog(program, 512, nullptr, log);
-    std::cerr << "Shader program link error: " << log << std::endl;
+  // Notify Flutter, unless it has not picked up the previous frame yet: it
+  // will get this one instead when it does.
+  if (fl_lightx_texture_gl_publish_slot(m_fl_texture, outputSlot)) {
+    fl_texture_registrar_mark_texture_frame_available(
+        m_fl_texture_registrar, FL_TEXTURE(m_fl_texture));
   }
+}
 
-  glDeleteShader(vs);
-  glDeleteShader(fs);
+std::future<StillFrame> CapturePipeline::CaptureStill(
+    std::chrono::steady_clock::time_point time) {
+  std::lock_guard<std::mutex> lock(m_still_mutex);
+  m_still_requests.push_back({time, std::promise<StillFrame>()});
+  return m_still_requests.back().promise.get_future();
+}
 
-  return program;
+void CapturePipeline::StartBurst(std::shared_ptr<BurstCapture> burst) {
+  std::shared_ptr<BurstCapture> idle;
+  if (!std::atomic_compare_exchange_strong(&m_burst, &idle, burst)) {
+    throw std::runtime_error("A burst is already in progress");
+  }
 }
 
-GLuint CapturePipeline::createHDRShaderProgram() {
-  const char* vertexSrc = R"(
-    #version 300 es
-    precision mediump float;
-    layout (location = 0) in vec2 position;
-    layout (location = 1) in vec2 texCoord;
-    out vec2 TexCoords;
-    void main() {
-      TexCoords = texCoord;
-      gl_Position = vec4(position, 0.0, 1.0);
+void CapturePipeline::ServeStillRequests(
+    std::chrono::steady_clock::time_point frameTime) {
+  m_zsl_ring->Poll();
+  std::lock_guard<std::mutex> lock(m_still_mutex);
+  for (auto it = m_still_requests.begin(); it != m_still_requests.end();) {
+    // A frame after the request may be closer to it than the ones before:
+    // wait for one.
+    if (it->time > frameTime || !m_zsl_ring->Capture(it->time, it->promise)) {
+      ++it;
+      continue;
     }
-  )";
-
-  const char* fragmentSrc = R"(
-    #version 300 es
-    precision mediump float;
-    in vec2 TexCoords;
-    out vec4 FragColor;
-
-    uniform sampler2D texLow;
-    uniform sampler2D texMidLow;
+    it = m_still_requests.erase(it);
+  }
+}
 
-    void main() {
-      vec3 colorLow = texture(texLow, TexCoords).rgb;
-      vec3 colorMidLow = texture(texMidLow, TexCoords).rgb;
+void CapturePipeline::StreamFrame(int width, int height) {
+  std::shared_ptr<ImageStream> stream = std::atomic_load(&camera.imageStream);
+  if (stream != m_image_stream) {
+    // Reads in flight hold credits of the previous stream.
+    m_stream_readback->Discard();
+    m_image_stream = std::move(stream);
+  }
+  if (!m_image_stream) {
+    return;
+  }
 
-      // Simple exposure fusion strategy: weighted average (weights can be adjusted)
-      float w1 = 0.2;
-      float w2 = 0.8;
+  // Hand over reads queued by earlier frames, then queue this one.
+  FrameReadback::Frame frame;
+  while (m_stream_readback->Map(frame)) {
+    m_image_stream->Deliver(frame.pixels, frame.width, frame.height,
+                            frame.bytesPerRow);
+    m_stream_readback->Unmap();
+  }
+  if (!m_image_stream->TryAcquireCredit(std::chrono::steady_clock::now())) {
+    return;
+  }
 
-      vec3 hdr = (colorLow * w1 + colorMidLow * w2) / (w1 + w2);
-      FragColor = vec4(hdr, 1.0);
+  int streamWidth = 0;
+  int streamHeight = 0;
+  m_image_stream->GetFrameSize(width, height, streamWidth, streamHeight);
+  if (streamWidth != m_stream_width || streamHeight != m_stream_height) {
+    for (size_t i = m_stream_readback->Discard(); i > 0; --i) {
+      m_image_stream->CancelCredit();
     }
-  )";
+    glDeleteTextures(1, &m_stream_texture);
+    glGenTextures(1, &m_stream_texture);
+    glBindTexture(GL_TEXTURE_2D, m_stream_texture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, streamWidth, streamHeight);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    m_stream_width = streamWidth;
+    m_stream_height = streamHeight;
+    std::cout << "[DEBUG] Streaming " << streamWidth << "x" << streamHeight
+              << " frames to Dart." << std::endl;
+  }
 
-  GLuint vs = compileShader(GL_VERTEX_SHADER, vertexSrc);
-  GLuint fs = compileShader(GL_FRAGMENT_SHADER, fragmentSrc);
+  m_stream_downscale_pass->Render(m_output_texture, width, height,
+                                  m_stream_texture, m_stream_width,
+                                  m_stream_height, *m_gpu_timer);
+  m_gpu_timer->Begin("stream_readback");
+  if (!m_stream_readback->Request(m_stream_texture, m_stream_width,
+                                  m_stream_height)) {
+    m_image_stream->CancelCredit();
+  }
+  m_gpu_timer->End();
+}
 
-  GLuint program = glCreateProgram();
-  glAttachShader(program, vs);
-  glAttachShader(program, fs);
-  glLinkProgram(program);
+void CapturePipeline::RecordFrame(
+    int width, int height, std::chrono::steady_clock::time_point timestamp) {
+  std::shared_ptr<VideoRecorder> recorder =
+      std::atomic_load(&camera.processedRecorder);
+  if (recorder != m_video_recorder) {
+    // Reads in flight belong to the previous recording.
+    m_record_readback->Discard();
+    m_record_times.clear();
+    m_video_recorder = std::move(recorder);
+    m_record_nv12 = camera.recordNv12 && Nv12Pass::CanConvert(width, height);
+  }
+  if (!m_video_recorder) {
+    return;
+  }
 
-  GLint success;
-  glGetProgramiv(program, GL_LINK_STATUS, &success);
-  if (!success) {
-    char log[512];
-    glGetProgramInfoLog(program, 512, nullptr, log);
-    std::cerr << "Shader program link error: " << log << std::endl;
+  // Hand over reads queued by earlier frames, then queue this one.
+  FrameReadback::Frame frame;
+  while (m_record_readback->Map(frame)) {
+    m_video_recorder->Push(
+        frame.pixels, m_record_width, m_record_height, frame.bytesPerRow,
+        m_record_nv12 ? VideoPixelFormat::Nv12 : VideoPixelFormat::Rgba,
+        m_record_times.front());
+    m_record_times.pop_front();
+    m_record_readback->Unmap();
+  }
+  // The GPU or the encoder is behind: drop this frame before converting it.
+  if (m_record_readback->GetInFlightCount() == RECORD_READBACK_DEPTH) {
+    return;
   }
 
-  glDeleteShader(vs);
-  glDeleteShader(fs);
+  if (width != m_record_width || height != m_record_height) {
+    m_record_readback->Discard();
+    m_record_times.clear();
+    glDeleteTextures(1, &m_record_texture);
+    m_record_texture = 0;
+    m_record_width = width;
+    m_record_height = height;
+  }
+  GLuint texture = 0;
+  GLsizei textureWidth = width;
+  GLsizei textureHeight = height;
+  if (m_record_nv12) {
+    m_nv12_pass->Resize(width, height);
+    m_nv12_pass->Render(m_output_texture, *m_gpu_timer);
+    texture = m_nv12_pass->GetTexture();
+    textureWidth = m_nv12_pass->GetTextureWidth();
+    textureHeight = m_nv12_pass->GetTextureHeight();
+  } else {
+    // Copied to RGBA8 whatever the display format, which may not be one
+    // glReadPixels can return as bytes
+    if (!m_record_texture) {
+      glGenTextures(1, &m_record_texture);
+      glBindTexture(GL_TEXTURE_2D, m_record_texture);
+      glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, width, height);
+      glBindTexture(GL_TEXTURE_2D, 0);
+    }
+    m_record_copy_pass->Render(m_output_texture, width, height,
+                               m_record_texture, width, height,
+                               *m_gpu_timer);
+    texture = m_record_texture;
+  }
+  m_gpu_timer->Begin("record_readback");
+  if (m_record_readback->Request(texture, textureWidth, textureHeight)) {
+    m_record_times.push_back(timestamp);
+  }
+  m_gpu_timer->End();
+}
 
-  return program;
+int64_t CapturePipeline::get_texture_id() {
+  if (!m_fl_texture) {
+    std::cerr << "Texture is null" << std::endl;
+    return -1;
+  }
+  return fl_texture_get_id(FL_TEXTURE(m_fl_texture));
 }
+
+void CapturePipeline::OnNewFrame() {}
@@ -6,22 +6,42 @@
 
 #include <functional>
 
+#include "auto_exposure_controller.h"
+#include "burst_capture.h"
+#include "downscale_pass.h"
 #include "fl_lightx_texture_gl.h"
 #include "flutter_linux/flutter_linux.h"
+#include "frame_processor.h"
+#include "frame_queue.h"
+#include "frame_readback.h"
+#include "frame_source.h"
+#include "gpu_timer.h"
+#include "image_stream.h"
+#include "luminance_readback.h"
+#include "grab_buffer_pool.h"
 #include "messages.g.h"
-
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Woverloaded-virtual"
-#pragma clang diagnostic ignored "-Wunused-variable"
-
-#include <pylon/PylonIncludes.h>
-
-#pragma clang diagnostic pop
-
+#include "nv12_pass.h"
+#include "video_recorder.h"
+#include "zsl_ring.h"
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <future>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <thread>
 #include <vector>
 
-#define RING_BUFFER_SIZE 2
+#define MAX_EXPOSURE_BRACKET_SIZE 8
+#define OUTPUT_TEXTURE_COUNT 3
+#define GPU_TIMER_REPORT_INTERVAL 300
+// Processed frames read back for a recording at once; later ones are
+// dropped until the oldest is mapped
+#define RECORD_READBACK_DEPTH 3
+// Minimum time between auto-exposure updates that reprogram the sequencer
+#define AUTO_EXPOSURE_SEQUENCER_INTERVAL_MS 500
 
 class Camera;
 
@@ -35,47 +55,162 @@ class CapturePipeline {
 
   int64_t get_texture_id();
 
+  // Takes effect between two frames, without restarting the stream.
+  void SetExposureBracket(const std::vector<double>& exposuresUs,
+                          const std::vector<double>& gains);
+
+  // Takes effect on the next rendered frame. A key of 0 derives it from the
+  // scene brightness.
+  void SetToneMapping(ToneMappingOperator toneOperator, float key,
+                      float adaptationSeconds);
+
+  // Takes effect on the next metered frame.
+  void SetAutoExposure(const AutoExposureSettings& settings);
+
+  // Takes effect on the next Bayer frame.
+  void SetDemosaicAlgorithm(DemosaicAlgorithm algorithm);
+
+  // Picture from the zero-shutter-lag ring, taken from the frame closest to
+  // `time` once one at or after it has been rendered. Broken when grabbing
+  // stops first.
+  std::future<StillFrame> CaptureStill(
+      std::chrono::steady_clock::time_point time);
+
+  // Fills `burst` with the next frames the acquisition thread retrieves.
+  // Cancelled when grabbing stops first. Throws when a burst is running.
+  void StartBurst(std::shared_ptr<BurstCapture> burst);
+
  private:
   const Camera& camera;
 
   // FL Texture
-  FlLightxTextureGL* m_fl_texture;
-  unsigned int m_fl_texture_name;
+  FlLightxTextureGL* m_fl_texture = nullptr;
   FlPluginRegistrar* m_fl_registrar;
   FlTextureRegistrar* m_fl_texture_registrar;
   GdkGLContext* m_gl_context;
 
-  // OpenGL resources
-  GLuint m_pbo_ring_buffer[RING_BUFFER_SIZE];
-  GLuint m_exposure_textures[RING_BUFFER_SIZE] = {0};
-  size_t m_ring_buffer_index;
-
-  // motion mask texture
-  // GLuint m_motion_mask_texture;
-
-  // hdr fusion GPU shader pass
-  GLuint m_hdr_fusion_shader_program;
-  GLuint m_hdr_fusion_vao, m_hdr_fusion_vbo;
-  GLuint m_hdr_fusion_fbo;
+  struct GrabbedFrame {
+    SourceFrame image;
+    size_t bracketSlot = 0;
+    size_t bracketSize = 1;
+    double exposureUs = 0.0;
+    double gainDb = 0.0;
+    // When the acquisition thread retrieved the frame
+    std::chrono::steady_clock::time_point timestamp;
+  };
+
+  // Acquisition thread: triggers and retrieves frames only
+  std::thread m_grab_thread;
+  // GL thread: uploads, runs the shader passes and notifies Flutter
+  std::thread m_gl_thread;
+  // Sized and set up as the camera's frameQueueCapacity and
+  // frameQueuePolicy on StartGrabbing()
+  std::unique_ptr<FrameQueue<GrabbedFrame>> m_frame_queue;
+  // Backs every grab buffer, one slot per MaxNumBuffer
+  std::unique_ptr<GrabBufferPool> m_grab_buffer_pool;
+
+  // Exposure bracket, one sequencer set per entry (in us), taken from the
+  // camera's on StartGrabbing()
+  std::vector<double> m_exposure_levels;
+  // Gain per entry (in dB), empty to leave the camera's gain alone
+  std::vector<double> m_gain_levels;
+  // Bracket requested through SetExposureBracket(), picked up by the
+  // acquisition thread
+  std::mutex m_bracket_mutex;
+  std::vector<double> m_pending_exposure_levels;
+  std::vector<double> m_pending_gain_levels;
+  std::atomic<bool> m_bracket_pending{false};
+  // True when the camera cycles the bracket itself through its sequencer,
+  // false when we fall back to one trigger per exposure (and for sources
+  // other than cameras).
+  std::atomic<bool> m_use_sequencer{false};
+  int64_t m_first_frame_id = -1;
+
+  // Auto exposure, metered on the GL thread from the exposure array mips
+  AutoExposureController m_auto_exposure;
+  std::unique_ptr<LuminanceReadback> m_luminance_readback;
+  std::chrono::steady_clock::time_point m_last_sequencer_update;
 
-  // tone mapping GPU shader pass
-  // GLuint m_tone_mapping_shader_program;
-  // GLuint m_tone_mapping_vao, m_tone_mapping_vbo;
-  // GLuint m_tone_mapping_fbo;
-
-  // mono texture GPU shader pass
-  // GLuint m_mono_shader_program;
-  // GLuint m_mono_fbo;
-
-  // output texture
-  GLuint m_output_texture;
-
-  void OnImageGrabbed(const Pylon::CGrabResultPtr& grabResult);
+  // OpenGL resources
+  std::unique_ptr<GpuTimer> m_gpu_timer;
+  uint64_t m_rendered_frame_count = 0;
+  std::chrono::steady_clock::time_point m_last_report_time;
+  // "intermediate/display" as resolved on the context, for reports
+  std::string m_render_formats_name;
+
+  // upload, unpack, demosaic, hdr fusion and tone mapping GPU chain
+  std::unique_ptr<FrameProcessor> m_frame_processor;
+  std::atomic<DemosaicAlgorithm> m_demosaic_algorithm{
+      DemosaicAlgorithm::MalvarHeCutler};
+  std::atomic<ToneMappingOperator> m_tone_mapping_operator{
+      ToneMappingOperator::Reinhard};
+  std::atomic<float> m_tone_mapping_key{0.0f};
+  std::atomic<float> m_tone_mapping_adaptation_time{0.5f};
+  std::chrono::steady_clock::time_point m_last_render_time;
+
+  // output textures at the preview size, handed to Flutter as a
+  // latest-frame-wins mailbox
+  GLuint m_output_textures[OUTPUT_TEXTURE_COUNT] = {0};
+  int m_preview_width = 0;
+  int m_preview_height = 0;
+  // full-resolution target and the pass that scales it into the output
+  // slot, when the preview is smaller than the frame
+  GLuint m_frame_texture = 0;
+  std::unique_ptr<DownscalePass> m_preview_downscale_pass;
+  // the full-resolution frame last rendered: the frame texture, or the
+  // output slot itself when the preview is full size
+  GLuint m_output_texture = 0;
+
+  // image stream to Dart: the camera's current stream, as last seen by the
+  // GL thread, and the scaled copy of the output read back for it
+  std::shared_ptr<ImageStream> m_image_stream;
+  std::unique_ptr<DownscalePass> m_stream_downscale_pass;
+  std::unique_ptr<FrameReadback> m_stream_readback;
+  GLuint m_stream_texture = 0;
+  int m_stream_width = 0;
+  int m_stream_height = 0;
+
+  // recording of processed frames: the camera's current recorder, as last
+  // seen by the GL thread, the copy of the output read back for it (NV12
+  // or RGBA) and the capture times of the reads in flight
+  std::shared_ptr<VideoRecorder> m_video_recorder;
+  std::unique_ptr<Nv12Pass> m_nv12_pass;
+  std::unique_ptr<DownscalePass> m_record_copy_pass;
+  std::unique_ptr<FrameReadback> m_record_readback;
+  GLuint m_record_texture = 0;
+  int m_record_width = 0;
+  int m_record_height = 0;
+  bool m_record_nv12 = false;
+  std::deque<std::chrono::steady_clock::time_point> m_record_times;
+
+  // zero-shutter-lag ring, and the stills requested from it that wait for
+  // a frame at or after their time
+  std::unique_ptr<ZslRing> m_zsl_ring;
+  struct StillRequest {
+    std::chrono::steady_clock::time_point time;
+    std::promise<StillFrame> promise;
+  };
+  std::mutex m_still_mutex;
+  std::vector<StillRequest> m_still_requests;
+
+  // burst being filled by the acquisition thread, through std::atomic_load
+  std::shared_ptr<BurstCapture> m_burst;
+
+  void OnImageGrabbed(const GrabbedFrame& frame);
+  void ServeStillRequests(std::chrono::steady_clock::time_point frameTime);
+  void UpdateAutoExposure(const LuminanceReadback::Result& stats);
+  void StreamFrame(int width, int height);
+  void RecordFrame(int width, int height,
+                   std::chrono::steady_clock::time_point timestamp);
+  void ConfigureGrabBufferPool(GenApi::INodeMap& nodemap);
+  void ConfigureTriggering(GenApi::INodeMap& nodemap);
+  bool TakePendingExposureBracket();
+  void ApplyPendingExposureBracket(Pylon::CInstantCamera& device);
+  bool ConfigureSequencer(GenApi::INodeMap& nodemap);
+  void DisableSequencer(GenApi::INodeMap& nodemap);
+  size_t GetBracketSlot(const SourceFrame& image, size_t triggeredSlot);
   void GLInit();
   void OnNewFrame();
-  GLuint compileShader(GLenum type, const char* src);
-  GLuint createMonoShaderProgram();
-  GLuint createHDRShaderProgram();
   void notifyTextureReady();
 };
 
@@ -0,0 +1,148 @@
+#include "demosaic_pass.h"
+
+#include <iostream>
+
+#include "gl_utils.h"
+
+static const char* const kDemosaicFragmentShader = R"(
+  #version 300 es
+  precision highp float;
+  precision highp int;
+  out vec4 FragColor;
+
+  uniform sampler2D mosaic;
+  // Position of the red sample within each 2x2 cell
+  uniform ivec2 firstRed;
+  uniform bool malvar;
+
+  ivec2 size;
+
+  // Mirrors at the borders, which keeps the colour of every sample.
+  float fetch(ivec2 p) {
+    p = abs(p);
+    p = min(p, 2 * (size - 1) - p);
+    return texelFetch(mosaic, p, 0).r;
+  }
+
+  void main() {
+    size = textureSize(mosaic, 0);
+    ivec2 p = ivec2(gl_FragCoord.xy);
+    float c = fetch(p);
+    float h1 = fetch(p + ivec2(-1, 0)) + fetch(p + ivec2(1, 0));
+    float v1 = fetch(p + ivec2(0, -1)) + fetch(p + ivec2(0, 1));
+    float d = fetch(p + ivec2(-1, -1)) + fetch(p + ivec2(1, -1)) +
+              fetch(p + ivec2(-1, 1)) + fetch(p + ivec2(1, 1));
+
+    // Own colour, the other primary, green, and the colours of the
+    // horizontal and vertical neighbours at green sites.
+    float green;
+    float opposite;
+    float horizontal;
+    float vertical;
+    if (malvar) {
+      // Malvar, He and Cutler, "High-quality linear interpolation for
+      // demosaicing of Bayer-patterned color images", ICASSP 2004.
+      float h2 = fetch(p + ivec2(-2, 0)) + fetch(p + ivec2(2, 0));
+      float v2 = fetch(p + ivec2(0, -2)) + fetch(p + ivec2(0, 2));
+      green = (4.0 * c + 2.0 * (h1 + v1) - (h2 + v2)) / 8.0;
+      opposite = (6.0 * c + 2.0 * d - 1.5 * (h2 + v2)) / 8.0;
+      horizontal = (5.0 * c + 4.0 * h1 - h2 - d + 0.5 * v2) / 8.0;
+      vertical = (5.0 * c + 4.0 * v1 - v2 - d + 0.5 * h2) / 8.0;
+    } else {
+      green = (h1 + v1) / 4.0;
+      opposite = d / 4.0;
+      horizontal = h1 / 2.0;
+      vertical = v1 / 2.0;
+    }
+
+    ivec2 site = (p + 2 - firstRed) & 1;
+    vec3 rgb;
+    if (site == ivec2(0, 0)) {
+      rgb = vec3(c, green, opposite);
+    } else if (site == ivec2(1, 1)) {
+      rgb = vec3(opposite, green, c);
+    } else if (site == ivec2(1, 0)) {
+      // Green on a red row
+      rgb = vec3(horizontal, c, vertical);
+    } else {
+      // Green on a blue row
+      rgb = vec3(vertical, c, horizontal);
+    }
+    FragColor = vec4(clamp(rgb, 0.0, 1.0), 1.0);
+  }
+)";
+
+DemosaicPass::DemosaicPass() {
+  m_program =
+      CreateShaderProgram(kFullscreenVertexShader, kDemosaicFragmentShader);
+  glGenVertexArrays(1, &m_vao);
+  glGenFramebuffers(1, &m_fbo);
+
+  glUseProgram(m_program);
+  glUniform1i(glGetUniformLocation(m_program, "mosaic"), 0);
+  glUseProgram(0);
+
+  std::cout << "[DEBUG] Created demosaic program: " << m_program << std::endl;
+}
+
+DemosaicPass::~DemosaicPass() {
+  glDeleteTextures(1, &m_mosaic);
+  glDeleteFramebuffers(1, &m_fbo);
+  glDeleteVertexArrays(1, &m_vao);
+  glDeleteProgram(m_program);
+}
+
+void DemosaicPass::SetAlgorithm(DemosaicAlgorithm algorithm) {
+  m_algorithm = algorithm;
+}
+
+void DemosaicPass::Resize(GLsizei width, GLsizei height, GLenum format) {
+  if (width == m_width && height == m_height && format == m_format) {
+    return;
+  }
+  glDeleteTextures(1, &m_mosaic);
+
+  // Read with texelFetch only, so never filtered.
+  glGenTextures(1, &m_mosaic);
+  glBindTexture(GL_TEXTURE_2D, m_mosaic);
+  glTexStorage2D(GL_TEXTURE_2D, 1, format, width, height);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  m_width = width;
+  m_height = height;
+  m_format = format;
+}
+
+void DemosaicPass::Render(GLuint targetArray, GLint layer,
+                          BayerPattern pattern, GpuTimer& timer) {
+  if (!m_mosaic) {
+    return;
+  }
+  timer.Begin("demosaic");
+  glBindVertexArray(m_vao);
+  glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+  glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, targetArray,
+                            0, layer);
+  glViewport(0, 0, m_width, m_height);
+  glUseProgram(m_program);
+  if (pattern == BayerPattern::RG) {
+    glUniform2i(glGetUniformLocation(m_program, "firstRed"), 0, 0);
+  } else {
+    glUniform2i(glGetUniformLocation(m_program, "firstRed"), 0, 1);
+  }
+  glUniform1i(glGetUniformLocation(m_program, "malvar"),
+              m_algorithm == DemosaicAlgorithm::MalvarHeCutler);
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, m_mosaic);
+  glDrawArrays(GL_TRIANGLES, 0, 3);
+
+  // Cleanup
+  glBindTexture(GL_TEXTURE_2D, 0);
+  glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, 0, 0, 0);
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  glBindVertexArray(0);
+  glUseProgram(0);
+  timer.End();
+}
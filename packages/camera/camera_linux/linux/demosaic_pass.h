@@ -0,0 +1,64 @@
+#ifndef DEMOSAIC_PASS_H_
+#define DEMOSAIC_PASS_H_
+
+#include <GLES3/gl3.h>
+
+#include "gpu_timer.h"
+
+// Colour of the first two pixels of the first row
+enum class BayerPattern {
+  RG,
+  GB,
+};
+
+enum class DemosaicAlgorithm {
+  Bilinear,
+  MalvarHeCutler,
+};
+
+// Interpolates raw Bayer frames to RGB on the GPU.
+//
+// Frames arrive as a single-channel mosaic, a third of the bytes of the
+// camera's own RGB8 output, and are rendered into a layer of the exposure
+// array. Bilinear averages the nearest samples of each colour;
+// Malvar-He-Cutler adds a gradient correction from the other channels over
+// a 5x5 neighbourhood, which removes most of bilinear's colour fringes at
+// the same single pass.
+//
+// All methods must be called with the rendering GL context current.
+class DemosaicPass {
+ public:
+  DemosaicPass();
+  ~DemosaicPass();
+
+  DemosaicPass(const DemosaicPass&) = delete;
+  DemosaicPass& operator=(const DemosaicPass&) = delete;
+
+  // (Re)allocates the mosaic texture; no-op when nothing changed. `format`
+  // is GL_R8 for 8-bit frames uploaded as GL_RED, or a renderable format
+  // such as GL_R16F for deeper frames unpacked by an earlier pass.
+  void Resize(GLsizei width, GLsizei height, GLenum format);
+
+  GLuint GetMosaicTexture() const { return m_mosaic; }
+
+  // Demosaics the mosaic into `layer` of `targetArray`, a renderable RGBA
+  // texture array of the size given to Resize().
+  void Render(GLuint targetArray, GLint layer, BayerPattern pattern,
+              GpuTimer& timer);
+
+  void SetAlgorithm(DemosaicAlgorithm algorithm);
+
+ private:
+  GLuint m_program = 0;
+  GLuint m_vao = 0;
+  GLuint m_fbo = 0;
+  GLuint m_mosaic = 0;
+
+  GLsizei m_width = 0;
+  GLsizei m_height = 0;
+  GLenum m_format = GL_NONE;
+
+  DemosaicAlgorithm m_algorithm = DemosaicAlgorithm::MalvarHeCutler;
+};
+
+#endif  // DEMOSAIC_PASS_H_
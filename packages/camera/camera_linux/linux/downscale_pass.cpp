@@ -0,0 +1,112 @@
+#include "downscale_pass.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "gl_utils.h"
+
+static const char* const kDownscaleFragmentShader = R"(
+  #version 300 es
+  precision highp float;
+  in vec2 TexCoords;
+  out vec4 FragColor;
+
+  uniform sampler2D source;
+  // Bilinear taps per axis, and the extent of a target pixel in uv
+  uniform ivec2 taps;
+  uniform vec2 footprint;
+  uniform bool swapRedBlue;
+
+  void main() {
+    vec2 step = footprint / vec2(taps);
+    vec2 origin = TexCoords - 0.5 * footprint + 0.5 * step;
+    vec4 sum = vec4(0.0);
+    for (int y = 0; y < taps.y; ++y) {
+      for (int x = 0; x < taps.x; ++x) {
+        sum += texture(source, origin + vec2(x, y) * step);
+      }
+    }
+    vec4 color = sum / float(taps.x * taps.y);
+    FragColor = vec4(swapRedBlue ? color.bgr : color.rgb, 1.0);
+  }
+)";
+
+void GetDownscaledSize(int sourceWidth, int sourceHeight, int& width,
+                       int& height) {
+  if (width <= 0 && height <= 0) {
+    width = sourceWidth;
+    height = sourceHeight;
+  } else if (width <= 0) {
+    width = static_cast<int>(
+        std::lround(static_cast<double>(height) * sourceWidth / sourceHeight));
+  } else if (height <= 0) {
+    height = static_cast<int>(
+        std::lround(static_cast<double>(width) * sourceHeight / sourceWidth));
+  }
+  width = std::clamp(width, 1, sourceWidth);
+  height = std::clamp(height, 1, sourceHeight);
+}
+
+// Taps that cover `scale` source texels along an axis, two per tap
+static GLint GetTapCount(GLsizei sourceSize, GLsizei targetSize) {
+  const float scale = static_cast<float>(sourceSize) / targetSize;
+  return std::clamp(static_cast<GLint>(std::ceil(scale / 2.0f)), 1,
+                    DOWNSCALE_MAX_TAPS);
+}
+
+DownscalePass::DownscalePass(const char* timerStage)
+    : m_timer_stage(timerStage) {
+  m_program =
+      CreateShaderProgram(kFullscreenVertexShader, kDownscaleFragmentShader);
+  glGenVertexArrays(1, &m_vao);
+  glGenFramebuffers(1, &m_fbo);
+
+  glUseProgram(m_program);
+  glUniform1i(glGetUniformLocation(m_program, "source"), 0);
+  glUseProgram(0);
+
+  std::cout << "[DEBUG] Created downscale program: " << m_program << std::endl;
+}
+
+DownscalePass::~DownscalePass() {
+  glDeleteFramebuffers(1, &m_fbo);
+  glDeleteVertexArrays(1, &m_vao);
+  glDeleteProgram(m_program);
+}
+
+void DownscalePass::SetSwapRedBlue(bool swapRedBlue) {
+  m_swap_red_blue = swapRedBlue;
+}
+
+void DownscalePass::Render(GLuint source, GLsizei sourceWidth,
+                           GLsizei sourceHeight, GLuint target,
+                           GLsizei targetWidth, GLsizei targetHeight,
+                           GpuTimer& timer) {
+  timer.Begin(m_timer_stage);
+  glBindVertexArray(m_vao);
+  glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                         target, 0);
+  glViewport(0, 0, targetWidth, targetHeight);
+  glUseProgram(m_program);
+  glUniform2i(glGetUniformLocation(m_program, "taps"),
+              GetTapCount(sourceWidth, targetWidth),
+              GetTapCount(sourceHeight, targetHeight));
+  glUniform2f(glGetUniformLocation(m_program, "footprint"),
+              1.0f / targetWidth, 1.0f / targetHeight);
+  glUniform1i(glGetUniformLocation(m_program, "swapRedBlue"),
+              m_swap_red_blue);
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, source);
+  glDrawArrays(GL_TRIANGLES, 0, 3);
+
+  // Cleanup
+  glBindTexture(GL_TEXTURE_2D, 0);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0,
+                         0);
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  glBindVertexArray(0);
+  glUseProgram(0);
+  timer.End();
+}
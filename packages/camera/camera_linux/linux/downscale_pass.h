@@ -0,0 +1,54 @@
+#ifndef DOWNSCALE_PASS_H_
+#define DOWNSCALE_PASS_H_
+
+#include <GLES3/gl3.h>
+
+#include "gpu_timer.h"
+
+// Largest number of bilinear taps per axis; each averages 2x2 texels, so
+// scale factors up to twice this are filtered without skipping texels.
+#define DOWNSCALE_MAX_TAPS 8
+
+// Size of a `sourceWidth` x `sourceHeight` frame downscaled to `width` x
+// `height`, updated in place. A side of 0 follows the source: its size when
+// both are 0, its aspect ratio when only one is. Never upscales: it costs
+// bandwidth without adding detail.
+void GetDownscaledSize(int sourceWidth, int sourceHeight, int& width,
+                       int& height);
+
+// Resamples a texture to a smaller size on the GPU.
+//
+// Each target pixel averages a grid of bilinear taps spread over the source
+// texels it covers, a box filter that keeps fine detail from aliasing the
+// way a single bilinear fetch (or glBlitFramebuffer) does past 2x. Red and
+// blue can be swapped on the way, so frames read back for consumers that
+// expect BGRA need no CPU pass.
+//
+// All methods must be called with the rendering GL context current.
+class DownscalePass {
+ public:
+  // `timerStage` names the pass in GpuTimer reports, unique per instance.
+  explicit DownscalePass(const char* timerStage);
+  ~DownscalePass();
+
+  DownscalePass(const DownscalePass&) = delete;
+  DownscalePass& operator=(const DownscalePass&) = delete;
+
+  void SetSwapRedBlue(bool swapRedBlue);
+
+  // Renders `source` (`sourceWidth` x `sourceHeight`) into the whole of
+  // `target`, a renderable 2D texture of `targetWidth` x `targetHeight`.
+  void Render(GLuint source, GLsizei sourceWidth, GLsizei sourceHeight,
+              GLuint target, GLsizei targetWidth, GLsizei targetHeight,
+              GpuTimer& timer);
+
+ private:
+  GLuint m_program = 0;
+  GLuint m_vao = 0;
+  GLuint m_fbo = 0;
+
+  const char* m_timer_stage;
+  bool m_swap_red_blue = false;
+};
+
+#endif  // DOWNSCALE_PASS_H_
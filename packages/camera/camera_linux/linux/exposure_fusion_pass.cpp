@@ -0,0 +1,538 @@
+#include "exposure_fusion_pass.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "gl_utils.h"
+
+// GLES 3.0 guarantees at least four draw buffers.
+static constexpr int kWeightOutputs = 4;
+
+static const char* const kWeightsFragmentShader = R"(
+  #version 300 es
+  precision highp float;
+  precision highp sampler2DArray;
+  in vec2 TexCoords;
+  layout (location = 0) out float weight0;
+  layout (location = 1) out float weight1;
+  layout (location = 2) out float weight2;
+  layout (location = 3) out float weight3;
+
+  uniform sampler2DArray exposures;
+  uniform int exposureCount;
+  uniform int firstLayer;
+  uniform vec3 exponents;
+  uniform sampler2D motionMask;
+  uniform bool deghost;
+  // One motion mask texel, in texture coordinates
+  uniform vec2 maskTexel;
+
+  // Mono exposures are stored in the red channel only.
+  uniform bool mono;
+
+  vec3 channels(vec4 texel) {
+    return mono ? texel.rrr : texel.rgb;
+  }
+
+  float luma(vec3 color) {
+    return dot(color, vec3(0.299, 0.587, 0.114));
+  }
+
+  float wellExposedness(vec3 color) {
+    vec3 offset = color - 0.5;
+    vec3 exposed = exp(-12.5 * offset * offset);
+    return exposed.r * exposed.g * exposed.b;
+  }
+
+  float fusionWeight(int layer) {
+    vec3 uv = vec3(TexCoords, float(layer));
+    vec3 color = channels(textureLod(exposures, uv, 0.0));
+
+    // Laplacian of the luminance: favours sharp, detailed regions.
+    float neighbours =
+        luma(channels(textureLodOffset(exposures, uv, 0.0, ivec2(1, 0)))) +
+        luma(channels(textureLodOffset(exposures, uv, 0.0, ivec2(-1, 0)))) +
+        luma(channels(textureLodOffset(exposures, uv, 0.0, ivec2(0, 1)))) +
+        luma(channels(textureLodOffset(exposures, uv, 0.0, ivec2(0, -1))));
+    float contrast = abs(neighbours - 4.0 * luma(color));
+
+    float mean = (color.r + color.g + color.b) / 3.0;
+    vec3 deviation = color - mean;
+    // Grey has no saturation; leave the factor out rather than zero it.
+    float saturation = mono ? 1.0 : sqrt(dot(deviation, deviation) / 3.0);
+
+    // Gaussian around mid-grey, sigma = 0.2.
+    float exposedness = wellExposedness(color);
+
+    return pow(max(contrast, 1e-6), exponents.x) *
+           pow(max(saturation, 1e-6), exponents.y) *
+           pow(max(exposedness, 1e-6), exponents.z);
+  }
+
+  // Same choice as the motion pass, made at the mask's resolution.
+  int bestExposedLayer() {
+    int best = 0;
+    float bestWeight = -1.0;
+    for (int i = 0; i < exposureCount; ++i) {
+      float w = wellExposedness(
+          channels(textureLod(exposures, vec3(TexCoords, float(i)), 1.0)));
+      if (w > bestWeight) {
+        bestWeight = w;
+        best = i;
+      }
+    }
+    return best;
+  }
+
+  float normalized(float weights[8], int layer, float total, int reference,
+                   float motion) {
+    if (layer >= exposureCount) {
+      return 0.0;
+    }
+    return mix(weights[layer] / total, layer == reference ? 1.0 : 0.0, motion);
+  }
+
+  void main() {
+    float weights[8];
+    float total = 0.0;
+    for (int i = 0; i < exposureCount; ++i) {
+      weights[i] = fusionWeight(i);
+      total += weights[i];
+    }
+
+    // Moving regions take a single exposure. Dilate the mask by a texel so
+    // the ghost's halo goes too.
+    float motion = 0.0;
+    int reference = 0;
+    if (deghost) {
+      vec2 d = maskTexel;
+      motion = max(
+          max(textureLod(motionMask, TexCoords + vec2(-d.x, -d.y), 0.0).r,
+              textureLod(motionMask, TexCoords + vec2(d.x, -d.y), 0.0).r),
+          max(textureLod(motionMask, TexCoords + vec2(-d.x, d.y), 0.0).r,
+              textureLod(motionMask, TexCoords + vec2(d.x, d.y), 0.0).r));
+      if (motion > 0.0) {
+        reference = bestExposedLayer();
+      }
+    }
+
+    weight0 = normalized(weights, firstLayer, total, reference, motion);
+    weight1 = normalized(weights, firstLayer + 1, total, reference, motion);
+    weight2 = normalized(weights, firstLayer + 2, total, reference, motion);
+    weight3 = normalized(weights, firstLayer + 3, total, reference, motion);
+  }
+)";
+
+// Flags pixels whose exposure-normalized brightness disagrees between the
+// best-exposed layer and any other. Runs at pyramid level 1, which is also
+// enough smoothing to keep sensor noise out of the mask.
+static const char* const kMotionFragmentShader = R"(
+  #version 300 es
+  precision highp float;
+  precision highp sampler2DArray;
+  in vec2 TexCoords;
+  out float motion;
+
+  uniform sampler2DArray exposures;
+  uniform int exposureCount;
+  // Effective exposure (time x gain) of every layer
+  uniform float layerExposures[8];
+  // log2 radiance difference at which a pixel starts to count as moving
+  uniform float threshold;
+
+  // Mono exposures are stored in the red channel only.
+  uniform bool mono;
+
+  vec3 channels(vec4 texel) {
+    return mono ? texel.rrr : texel.rgb;
+  }
+
+  // Outside this range a layer carries no usable radiance estimate.
+  const float kMinValid = 0.02;
+  const float kMaxValid = 0.9;
+
+  float luma(vec3 color) {
+    return dot(color, vec3(0.299, 0.587, 0.114));
+  }
+
+  float wellExposedness(vec3 color) {
+    vec3 offset = color - 0.5;
+    vec3 exposed = exp(-12.5 * offset * offset);
+    return exposed.r * exposed.g * exposed.b;
+  }
+
+  void main() {
+    vec3 colors[8];
+    int reference = 0;
+    float bestWeight = -1.0;
+    for (int i = 0; i < exposureCount; ++i) {
+      colors[i] =
+          channels(textureLod(exposures, vec3(TexCoords, float(i)), 1.0));
+      float w = wellExposedness(colors[i]);
+      if (w > bestWeight) {
+        bestWeight = w;
+        reference = i;
+      }
+    }
+
+    float referenceLuma = luma(colors[reference]);
+    float referenceRadiance =
+        log2(max(referenceLuma, kMinValid) / layerExposures[reference]);
+    float difference = 0.0;
+    for (int i = 0; i < exposureCount; ++i) {
+      float l = luma(colors[i]);
+      if (i == reference || l < kMinValid || l > kMaxValid) {
+        continue;
+      }
+      difference = max(difference,
+                       abs(log2(l / layerExposures[i]) - referenceRadiance));
+    }
+    bool valid = referenceLuma >= kMinValid && referenceLuma <= kMaxValid;
+    motion = valid ? smoothstep(threshold, 2.0 * threshold, difference) : 0.0;
+  }
+)";
+
+static const char* const kBlendFragmentShader = R"(
+  #version 300 es
+  precision highp float;
+  precision highp sampler2DArray;
+  in vec2 TexCoords;
+  out vec4 FragColor;
+
+  uniform sampler2DArray exposures;
+  uniform sampler2DArray weights;
+  // Fused image one level coarser, upsampled by the bilinear lookup
+  uniform sampler2D coarser;
+  uniform int exposureCount;
+  uniform float level;
+  uniform bool isTop;
+
+  // Mono exposures are stored in the red channel only.
+  uniform bool mono;
+
+  vec3 channels(vec4 texel) {
+    return mono ? texel.rrr : texel.rgb;
+  }
+
+  void main() {
+    vec3 result =
+        isTop ? vec3(0.0) : channels(textureLod(coarser, TexCoords, 0.0));
+    for (int i = 0; i < exposureCount; ++i) {
+      vec3 uv = vec3(TexCoords, float(i));
+      // Laplacian level: this Gaussian level minus the next one, upsampled.
+      vec3 detail = channels(textureLod(exposures, uv, level));
+      if (!isTop) {
+        detail -= channels(textureLod(exposures, uv, level + 1.0));
+      }
+      result += textureLod(weights, uv, level).r * detail;
+    }
+    FragColor = vec4(result, 1.0);
+  }
+)";
+
+ExposureFusionPass::ExposureFusionPass() {
+  m_weights_program =
+      CreateShaderProgram(kFullscreenVertexShader, kWeightsFragmentShader);
+  m_blend_program =
+      CreateShaderProgram(kFullscreenVertexShader, kBlendFragmentShader);
+  m_motion_program =
+      CreateShaderProgram(kFullscreenVertexShader, kMotionFragmentShader);
+  glGenVertexArrays(1, &m_vao);
+  glGenFramebuffers(1, &m_fbo);
+
+  glUseProgram(m_weights_program);
+  glUniform1i(glGetUniformLocation(m_weights_program, "exposures"), 0);
+  glUniform1i(glGetUniformLocation(m_weights_program, "motionMask"), 1);
+  glUseProgram(m_motion_program);
+  glUniform1i(glGetUniformLocation(m_motion_program, "exposures"), 0);
+  glUseProgram(m_blend_program);
+  glUniform1i(glGetUniformLocation(m_blend_program, "exposures"), 0);
+  glUniform1i(glGetUniformLocation(m_blend_program, "weights"), 1);
+  glUniform1i(glGetUniformLocation(m_blend_program, "coarser"), 2);
+  glUseProgram(0);
+
+  std::cout << "[DEBUG] Created exposure fusion programs: " << m_weights_program
+            << ", " << m_blend_program << ", " << m_motion_program
+            << std::endl;
+}
+
+ExposureFusionPass::~ExposureFusionPass() {
+  ReleaseTextures();
+  glDeleteFramebuffers(1, &m_fbo);
+  glDeleteVertexArrays(1, &m_vao);
+  glDeleteProgram(m_motion_program);
+  glDeleteProgram(m_blend_program);
+  glDeleteProgram(m_weights_program);
+}
+
+void ExposureFusionPass::ReleaseTextures() {
+  GLuint textures[] = {m_exposures, m_weights, m_pyramid, m_motion_mask};
+  glDeleteTextures(4, textures);
+  m_exposures = m_weights = m_pyramid = m_motion_mask = 0;
+  m_layers = m_width = m_height = m_levels = 0;
+  m_format = GL_NONE;
+}
+
+bool ExposureFusionPass::IsMono() const {
+  return m_format == GL_R8 || m_format == GL_R16F;
+}
+
+GLenum ExposureFusionPass::GetExposureFormat() const {
+  switch (m_format) {
+    case GL_R8:
+      return GL_RED;
+    case GL_RGBA8:
+      return GL_RGBA;
+    default:
+      return GL_RGB;
+  }
+}
+
+void ExposureFusionPass::SetIntermediateFormat(GLenum format) {
+  if (format != m_intermediate_format) {
+    ReleaseTextures();
+    m_intermediate_format = format;
+  }
+}
+
+void ExposureFusionPass::SetWeightExponents(float contrast, float saturation,
+                                            float exposedness) {
+  m_exponents[0] = contrast;
+  m_exponents[1] = saturation;
+  m_exponents[2] = exposedness;
+}
+
+void ExposureFusionPass::SetLayerExposure(GLsizei layer,
+                                          float effectiveExposure) {
+  if (layer >= 0 && layer < EXPOSURE_FUSION_MAX_LAYERS) {
+    m_layer_exposures[layer] = effectiveExposure;
+  }
+}
+
+void ExposureFusionPass::SetMotionThreshold(float log2Threshold) {
+  m_motion_threshold = log2Threshold;
+}
+
+bool ExposureFusionPass::CanDeghost() const {
+  if (!m_motion_mask || m_motion_threshold <= 0.0f) {
+    return false;
+  }
+  for (GLsizei i = 0; i < m_layers; ++i) {
+    if (m_layer_exposures[i] <= 0.0f) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ExposureFusionPass::Resize(GLsizei layers, GLsizei width, GLsizei height,
+                                GLenum format) {
+  if (layers == m_layers && width == m_width && height == m_height &&
+      format == m_format) {
+    return;
+  }
+  ReleaseTextures();
+
+  // Stop a few levels short of 1x1: the coarsest levels carry little but
+  // global brightness and each one costs a pass.
+  const GLsizei fullLevels =
+      static_cast<GLsizei>(std::log2(std::min(width, height))) + 1;
+  const GLsizei levels =
+      std::max(1, std::min(EXPOSURE_FUSION_MAX_LEVELS, fullLevels - 3));
+
+  glGenTextures(1, &m_exposures);
+  glBindTexture(GL_TEXTURE_2D_ARRAY, m_exposures);
+  const bool mono = format == GL_R8 || format == GL_R16F;
+  glTexStorage3D(GL_TEXTURE_2D_ARRAY, levels, format, width, height, layers);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER,
+                  GL_LINEAR_MIPMAP_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+  glGenTextures(1, &m_weights);
+  glBindTexture(GL_TEXTURE_2D_ARRAY, m_weights);
+  glTexStorage3D(GL_TEXTURE_2D_ARRAY, levels, GL_R8, width, height, layers);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER,
+                  GL_LINEAR_MIPMAP_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+  if (levels > 1) {
+    // Sampled through TEXTURE_BASE_LEVEL with a non-mipmapped filter, so a
+    // pass can read one level while rendering into the next finer one.
+    glGenTextures(1, &m_pyramid);
+    glBindTexture(GL_TEXTURE_2D, m_pyramid);
+    // RGB10_A2 has no single-channel counterpart; mono keeps it.
+    GLenum pyramidFormat = m_intermediate_format;
+    if (mono && pyramidFormat == GL_RGBA16F) {
+      pyramidFormat = ResolveRenderFormat(GL_R16F);
+    } else if (mono && pyramidFormat == GL_RGBA8) {
+      pyramidFormat = GL_R8;
+    }
+    glTexStorage2D(GL_TEXTURE_2D, levels - 1, pyramidFormat,
+                   std::max(1, width / 2), std::max(1, height / 2));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+  }
+
+  if (layers > 1) {
+    // Half resolution, matching the exposure level the motion pass reads.
+    glGenTextures(1, &m_motion_mask);
+    glBindTexture(GL_TEXTURE_2D, m_motion_mask);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_R8, std::max(1, width / 2),
+                   std::max(1, height / 2));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+  }
+
+  m_layers = layers;
+  m_width = width;
+  m_height = height;
+  m_levels = levels;
+  m_format = format;
+  std::cout << "[DEBUG] Allocated exposure fusion for " << layers
+            << (mono ? " mono" : " RGB") << " exposures, " << levels
+            << " pyramid levels." << std::endl;
+}
+
+void ExposureFusionPass::Render(GLuint outputTexture, GpuTimer& timer) {
+  if (!m_exposures) {
+    return;
+  }
+  glBindVertexArray(m_vao);
+  glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D_ARRAY, m_exposures);
+
+  // 1. Gaussian pyramid of the exposures; the motion and weight passes both
+  // read level 1.
+  timer.Begin("fusion_exposure_mips");
+  glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+  timer.End();
+
+  // 2. Motion mask at half resolution.
+  const bool mono = IsMono();
+  const bool deghost = CanDeghost();
+  const GLsizei maskWidth = std::max(1, m_width / 2);
+  const GLsizei maskHeight = std::max(1, m_height / 2);
+  if (deghost) {
+    timer.Begin("fusion_motion");
+    glUseProgram(m_motion_program);
+    glUniform1i(glGetUniformLocation(m_motion_program, "exposureCount"),
+                m_layers);
+    glUniform1fv(glGetUniformLocation(m_motion_program, "layerExposures"),
+                 m_layers, m_layer_exposures);
+    glUniform1f(glGetUniformLocation(m_motion_program, "threshold"),
+                m_motion_threshold);
+    glUniform1i(glGetUniformLocation(m_motion_program, "mono"), mono);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                           GL_TEXTURE_2D, m_motion_mask, 0);
+    glViewport(0, 0, maskWidth, maskHeight);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                           GL_TEXTURE_2D, 0, 0);
+    timer.End();
+  }
+
+  // 3. Normalized weights, up to kWeightOutputs layers per draw. Moving
+  // regions fall back to the best-exposed layer alone.
+  timer.Begin("fusion_weights");
+  glUseProgram(m_weights_program);
+  glUniform1i(glGetUniformLocation(m_weights_program, "exposureCount"),
+              m_layers);
+  glUniform3fv(glGetUniformLocation(m_weights_program, "exponents"), 1,
+               m_exponents);
+  glUniform1i(glGetUniformLocation(m_weights_program, "deghost"), deghost);
+  glUniform1i(glGetUniformLocation(m_weights_program, "mono"), mono);
+  glUniform2f(glGetUniformLocation(m_weights_program, "maskTexel"),
+              1.0f / maskWidth, 1.0f / maskHeight);
+  glActiveTexture(GL_TEXTURE1);
+  glBindTexture(GL_TEXTURE_2D, deghost ? m_motion_mask : 0);
+  glViewport(0, 0, m_width, m_height);
+  for (GLsizei first = 0; first < m_layers; first += kWeightOutputs) {
+    GLenum drawBuffers[kWeightOutputs];
+    for (int i = 0; i < kWeightOutputs; ++i) {
+      const bool used = first + i < m_layers;
+      glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + i,
+                                used ? m_weights : 0, 0, used ? first + i : 0);
+      drawBuffers[i] = used ? GL_COLOR_ATTACHMENT0 + i : GL_NONE;
+    }
+    glDrawBuffers(kWeightOutputs, drawBuffers);
+    glUniform1i(glGetUniformLocation(m_weights_program, "firstLayer"), first);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+  }
+  for (int i = 0; i < kWeightOutputs; ++i) {
+    glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + i, 0, 0,
+                              0);
+  }
+  const GLenum firstDrawBuffer = GL_COLOR_ATTACHMENT0;
+  glDrawBuffers(1, &firstDrawBuffer);
+  timer.End();
+
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  // 4. Gaussian pyramid of the weights.
+  timer.Begin("fusion_weight_mips");
+  glBindTexture(GL_TEXTURE_2D_ARRAY, m_weights);
+  glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+  timer.End();
+
+  // 5. Blend the Laplacian levels and collapse, coarsest level first. Fused
+  // level l lives in pyramid mip l - 1; level 0 goes straight to the output.
+  timer.Begin("fusion_blend");
+  glUseProgram(m_blend_program);
+  glUniform1i(glGetUniformLocation(m_blend_program, "exposureCount"),
+              m_layers);
+  glUniform1i(glGetUniformLocation(m_blend_program, "mono"), mono);
+  const GLint levelLocation = glGetUniformLocation(m_blend_program, "level");
+  const GLint isTopLocation = glGetUniformLocation(m_blend_program, "isTop");
+  glActiveTexture(GL_TEXTURE2);
+  for (GLsizei level = m_levels - 1; level >= 0; --level) {
+    const bool isTop = level == m_levels - 1;
+    if (level > 0) {
+      glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                             GL_TEXTURE_2D, m_pyramid, level - 1);
+    } else {
+      glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                             GL_TEXTURE_2D, outputTexture, 0);
+    }
+    if (isTop) {
+      glBindTexture(GL_TEXTURE_2D, 0);
+    } else {
+      glBindTexture(GL_TEXTURE_2D, m_pyramid);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, level);
+    }
+    glViewport(0, 0, std::max(1, m_width >> level),
+               std::max(1, m_height >> level));
+    glUniform1f(levelLocation, static_cast<float>(level));
+    glUniform1i(isTopLocation, isTop);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+  }
+  if (m_pyramid) {
+    glBindTexture(GL_TEXTURE_2D, m_pyramid);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+  }
+  timer.End();
+
+  // Cleanup
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0,
+                         0);
+  glBindTexture(GL_TEXTURE_2D, 0);
+  glActiveTexture(GL_TEXTURE1);
+  glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  glBindVertexArray(0);
+  glUseProgram(0);
+}
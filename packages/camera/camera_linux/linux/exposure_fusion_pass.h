@@ -0,0 +1,105 @@
+#ifndef EXPOSURE_FUSION_PASS_H_
+#define EXPOSURE_FUSION_PASS_H_
+
+#include <GLES3/gl3.h>
+
+#include "gpu_timer.h"
+
+#define EXPOSURE_FUSION_MAX_LEVELS 8
+#define EXPOSURE_FUSION_MAX_LAYERS 8
+// Default log2 radiance disagreement at which a pixel is treated as moving
+#define EXPOSURE_FUSION_MOTION_THRESHOLD 0.5f
+
+// Mertens exposure fusion on the GPU.
+//
+// Every exposure gets a per-pixel weight from local contrast, saturation and
+// well-exposedness, normalized across the bracket. The exposures and their
+// weights are decomposed into Gaussian pyramids through their mip chains,
+// each Laplacian level is blended by the weights, and the result is
+// collapsed from the coarsest level down into the output texture in the same
+// passes.
+//
+// Before weighting, a half-resolution motion mask compares each exposure,
+// normalized by its exposure time and gain, against the best-exposed one.
+// Where they disagree the scene moved between shots, and the weights fall
+// back to the best-exposed exposure alone so the output shows no ghosts.
+// The comparison assumes pixel values proportional to sensor exposure.
+//
+// Mono brackets stay single-channel through the exposures and the fused
+// pyramid; grey is only expanded to RGB when writing the output.
+//
+// All methods must be called with the rendering GL context current.
+class ExposureFusionPass {
+ public:
+  ExposureFusionPass();
+  ~ExposureFusionPass();
+
+  ExposureFusionPass(const ExposureFusionPass&) = delete;
+  ExposureFusionPass& operator=(const ExposureFusionPass&) = delete;
+
+  // (Re)allocates the exposure array and intermediates; no-op when nothing
+  // changed. `format` is GL_R8 for mono, GL_RGB8 for uploaded colour, or
+  // GL_RGBA8, GL_R16F or GL_RGBA16F for exposures rendered by an earlier
+  // pass. Previous exposure contents are lost on reallocation.
+  void Resize(GLsizei layers, GLsizei width, GLsizei height, GLenum format);
+
+  // One layer per bracket entry; callers upload or render into level 0.
+  GLuint GetExposureTextureArray() const { return m_exposures; }
+  GLenum GetExposureInternalFormat() const { return m_format; }
+  // Pixel format uploads into the exposure array use
+  GLenum GetExposureFormat() const;
+  bool IsMono() const;
+  GLsizei GetLayerCount() const { return m_layers; }
+  // Mip levels of the exposure array, current after Render()
+  GLsizei GetLevelCount() const { return m_levels; }
+
+  // Fuses all layers into `outputTexture`, a renderable texture of the size
+  // given to Resize().
+  void Render(GLuint outputTexture, GpuTimer& timer);
+
+  // Renderable colour format of the fused pyramid levels; GL_RGBA16F by
+  // default. Takes effect on the next Resize().
+  void SetIntermediateFormat(GLenum format);
+
+  // Mertens' contrast, saturation and well-exposedness exponents.
+  void SetWeightExponents(float contrast, float saturation,
+                          float exposedness);
+
+  // Effective exposure (time x linear gain) `layer` was shot at, in any
+  // unit common to all layers. Deghosting stays off until every layer has
+  // one.
+  void SetLayerExposure(GLsizei layer, float effectiveExposure);
+
+  // log2 radiance disagreement at which pixels start to count as moving;
+  // 0 disables deghosting.
+  void SetMotionThreshold(float log2Threshold);
+
+ private:
+  GLuint m_weights_program = 0;
+  GLuint m_blend_program = 0;
+  GLuint m_motion_program = 0;
+  GLuint m_vao = 0;
+  GLuint m_fbo = 0;
+
+  GLuint m_exposures = 0;
+  GLuint m_weights = 0;
+  // Fused image at pyramid levels 1..m_levels-1, stored from mip 0
+  GLuint m_pyramid = 0;
+  // R8, half resolution: 1 where the scene moved across the bracket
+  GLuint m_motion_mask = 0;
+
+  GLsizei m_layers = 0;
+  GLsizei m_width = 0;
+  GLsizei m_height = 0;
+  GLsizei m_levels = 0;
+  GLenum m_format = GL_NONE;
+  GLenum m_intermediate_format = GL_RGBA16F;
+  float m_exponents[3] = {1.0f, 1.0f, 1.0f};
+  float m_layer_exposures[EXPOSURE_FUSION_MAX_LAYERS] = {};
+  float m_motion_threshold = EXPOSURE_FUSION_MOTION_THRESHOLD;
+
+  bool CanDeghost() const;
+  void ReleaseTextures();
+};
+
+#endif  // EXPOSURE_FUSION_PASS_H_
@@ -1,16 +1,57 @@
 #include "fl_lightx_texture_gl.h"
 
+#include <GLES3/gl3.h>
+
 G_DEFINE_TYPE(FlLightxTextureGL, fl_lightx_texture_gl, fl_texture_gl_get_type())
 
+static constexpr uint32_t kPendingBit = 1u << 4;
+
+static uint32_t state_front(uint32_t state) { return state & 0x3; }
+static uint32_t state_latest(uint32_t state) { return (state >> 2) & 0x3; }
+static uint32_t make_state(uint32_t front, uint32_t latest, bool pending) {
+  return front | (latest << 2) | (pending ? kPendingBit : 0);
+}
+
+// Makes the current context wait for whoever released the slot last.
+static void wait_slot_fence(FlLightxTextureGL* f, uint32_t slot) {
+  GLsync fence = static_cast<GLsync>(f->fences[slot]);
+  if (fence) {
+    glWaitSync(fence, 0, GL_TIMEOUT_IGNORED);
+    glDeleteSync(fence);
+    f->fences[slot] = nullptr;
+  }
+}
+
 static gboolean fl_lightx_texture_gl_populate(FlTextureGL* texture,
                                               uint32_t* target, uint32_t* name,
                                               uint32_t* width, uint32_t* height,
                                               GError** error) {
   FlLightxTextureGL* f = (FlLightxTextureGL*)texture;
   *target = f->target;
-  *name = f->name;
   *width = f->width;
   *height = f->height;
+  if (f->slot_count <= 1) {
+    *name = f->name;
+    return true;
+  }
+
+  uint32_t state = f->state.load(std::memory_order_acquire);
+  if (state & kPendingBit) {
+    // Only the front slot changes hands here, and the producer cannot touch
+    // it before the exchange below, so its fence can be set up front.
+    const uint32_t released = state_front(state);
+    f->fences[released] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+    uint32_t next;
+    do {
+      next = make_state(state_latest(state), state_latest(state), false);
+    } while (!f->state.compare_exchange_weak(state, next,
+                                             std::memory_order_acq_rel));
+    wait_slot_fence(f, state_front(next));
+    state = next;
+  }
+
+  *name = f->names[state_front(state)];
   return true;
 }
 
@@ -22,11 +63,65 @@ FlLightxTextureGL* fl_lightx_texture_gl_new(uint32_t target, uint32_t name,
   r->name = name;
   r->width = width;
   r->height = height;
+  r->slot_count = 1;
+  r->names[0] = name;
   return r;
 }
 
+FlLightxTextureGL* fl_lightx_texture_gl_new_mailbox(uint32_t target,
+                                                    const uint32_t* names,
+                                                    uint32_t slot_count,
+                                                    uint32_t width,
+                                                    uint32_t height) {
+  g_return_val_if_fail(slot_count >= 2, nullptr);
+  g_return_val_if_fail(slot_count <= FL_LIGHTX_TEXTURE_GL_MAX_SLOTS, nullptr);
+
+  auto r = fl_lightx_texture_gl_new(target, names[0], width, height);
+  r->slot_count = slot_count;
+  for (uint32_t i = 0; i < slot_count; ++i) {
+    r->names[i] = names[i];
+  }
+  r->state.store(make_state(0, 0, false), std::memory_order_release);
+  return r;
+}
+
+int fl_lightx_texture_gl_acquire_slot(FlLightxTextureGL* texture) {
+  if (texture->slot_count <= 1) {
+    return 0;
+  }
+
+  // The raster thread only ever moves front onto latest, so a slot that is
+  // neither stays free even if the state changes under us.
+  const uint32_t state = texture->state.load(std::memory_order_acquire);
+  for (uint32_t slot = 0; slot < texture->slot_count; ++slot) {
+    if (slot != state_front(state) && slot != state_latest(state)) {
+      wait_slot_fence(texture, slot);
+      return static_cast<int>(slot);
+    }
+  }
+  return -1;
+}
+
+gboolean fl_lightx_texture_gl_publish_slot(FlLightxTextureGL* texture,
+                                           int slot) {
+  if (texture->slot_count <= 1) {
+    return true;
+  }
+
+  texture->fences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  glFlush();
+
+  uint32_t state = texture->state.load(std::memory_order_acquire);
+  uint32_t next;
+  do {
+    next = make_state(state_front(state), static_cast<uint32_t>(slot), true);
+  } while (!texture->state.compare_exchange_weak(state, next,
+                                                 std::memory_order_acq_rel));
+  return (state & kPendingBit) == 0;
+}
+
 static void fl_lightx_texture_gl_class_init(FlLightxTextureGLClass* klass) {
   FL_TEXTURE_GL_CLASS(klass)->populate = fl_lightx_texture_gl_populate;
 }
 
-static void fl_lightx_texture_gl_init(FlLightxTextureGL* self) {}
\ No newline at end of file
+static void fl_lightx_texture_gl_init(FlLightxTextureGL* self) {}
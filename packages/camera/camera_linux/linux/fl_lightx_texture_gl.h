@@ -1,22 +1,53 @@
-
 #ifndef FL_LIGHTX_TEXTURE_GL_H_
 #define FL_LIGHTX_TEXTURE_GL_H_
 
+#include <atomic>
+
 #include "flutter_linux/flutter_linux.h"
 #include "messages.g.h"
 
+#define FL_LIGHTX_TEXTURE_GL_MAX_SLOTS 3
+
 G_DECLARE_FINAL_TYPE(FlLightxTextureGL, fl_lightx_texture_gl, FL,
                      LIGHTX_TEXTURE_GL, FlTextureGL)
 
+// In mailbox mode the texture owns two or three GL textures: one shown by
+// Flutter (front), at most one completed but not yet shown (latest), and the
+// rest free for the producer. populate() always switches to the latest
+// completed slot, so display lags the camera by at most one frame and the
+// producer never waits on the raster thread.
 struct _FlLightxTextureGL {
   FlTextureGL parent_instance;
   uint32_t target;
   uint32_t name;
   uint32_t width;
   uint32_t height;
+
+  uint32_t slot_count;
+  uint32_t names[FL_LIGHTX_TEXTURE_GL_MAX_SLOTS];
+  // GLsync guarding each slot, set by whichever side last released it
+  gpointer fences[FL_LIGHTX_TEXTURE_GL_MAX_SLOTS];
+  // front | latest << 2 | pending << 4
+  std::atomic<uint32_t> state;
 };
 
 FlLightxTextureGL* fl_lightx_texture_gl_new(uint32_t target, uint32_t name,
                                             uint32_t width, uint32_t height);
 
-#endif  // FL_LIGHTX_TEXTURE_GL_H_
\ No newline at end of file
+FlLightxTextureGL* fl_lightx_texture_gl_new_mailbox(uint32_t target,
+                                                    const uint32_t* names,
+                                                    uint32_t slot_count,
+                                                    uint32_t width,
+                                                    uint32_t height);
+
+// Producer side, with the producer's GL context current. Returns the slot to
+// render into next, or -1 when every slot is taken (two-slot mailbox with a
+// frame still pending): the frame should then be skipped.
+int fl_lightx_texture_gl_acquire_slot(FlLightxTextureGL* texture);
+
+// Publishes a slot rendered since acquire_slot(). Returns TRUE if no frame
+// was pending before, i.e. when the caller must mark a frame available.
+gboolean fl_lightx_texture_gl_publish_slot(FlLightxTextureGL* texture,
+                                           int slot);
+
+#endif  // FL_LIGHTX_TEXTURE_GL_H_
@@ -0,0 +1,187 @@
+#include "frame_processor.h"
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+#include "gl_utils.h"
+
+FrameProcessor::FrameProcessor(GLenum intermediateFormat,
+                               size_t uploadRingDepth)
+    : m_upload_ring_depth(uploadRingDepth) {
+  // Rows of packed and odd-width frames are not 4-byte aligned.
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+  m_hdr_fusion_pass = std::make_unique<ExposureFusionPass>();
+  m_hdr_fusion_pass->SetIntermediateFormat(intermediateFormat);
+  m_unpack_pass = std::make_unique<UnpackPass>();
+  m_can_render_half_float = CanRenderToHalfFloat();
+  m_demosaic_pass = std::make_unique<DemosaicPass>();
+  m_tone_mapping_pass = std::make_unique<ToneMappingPass>();
+  m_tone_mapping_pass->SetInputFormat(intermediateFormat);
+}
+
+bool FrameProcessor::Upload(const SourceFrame& image, size_t bracketSlot,
+                            size_t bracketSize, double exposureUs,
+                            double gainDb, DemosaicAlgorithm algorithm,
+                            GpuTimer& timer) {
+  const int width = image.width;
+  const int height = image.height;
+  const uint8_t* data = image.pixels;
+
+  // Bayer frames are uploaded raw and demosaiced into the exposure array,
+  // as RGBA8, which drivers render to natively, rather than RGB8. Packed 10
+  // and 12-bit frames are uploaded raw too and unpacked into half floats where
+  // the context can render to them.
+  const bool halfFloat = m_can_render_half_float;
+  int bitsPerPixel = 8;
+  bool packed = false;
+  GLenum exposureFormat;
+  bool bayer = false;
+  BayerPattern bayerPattern = BayerPattern::RG;
+  switch (image.pixelType) {
+    case Pylon::PixelType_Mono8:
+      exposureFormat = GL_R8;
+      break;
+    case Pylon::PixelType_RGB8packed:
+      bitsPerPixel = 24;
+      exposureFormat = GL_RGB8;
+      break;
+    case Pylon::PixelType_Mono10p:
+    case Pylon::PixelType_Mono12p:
+      bitsPerPixel = image.pixelType == Pylon::PixelType_Mono10p ? 10 : 12;
+      packed = true;
+      exposureFormat = halfFloat ? GL_R16F : GL_R8;
+      break;
+    case Pylon::PixelType_BayerRG8:
+    case Pylon::PixelType_BayerGB8:
+      exposureFormat = GL_RGBA8;
+      bayer = true;
+      bayerPattern = image.pixelType == Pylon::PixelType_BayerRG8
+                         ? BayerPattern::RG
+                         : BayerPattern::GB;
+      break;
+    case Pylon::PixelType_BayerRG12p:
+    case Pylon::PixelType_BayerGB12p:
+      bitsPerPixel = 12;
+      packed = true;
+      exposureFormat = halfFloat ? GL_RGBA16F : GL_RGBA8;
+      bayer = true;
+      bayerPattern = image.pixelType == Pylon::PixelType_BayerRG12p
+                         ? BayerPattern::RG
+                         : BayerPattern::GB;
+      break;
+    default:
+      std::cerr << "[ERROR] Unsupported pixel format: "
+                << Pylon::CPixelTypeMapper::GetNameByPixelType(image.pixelType)
+                << std::endl;
+      return false;
+  }
+
+  // Mono and Bayer frames upload a third of the bytes of RGB8, packed ones
+  // a half (12-bit) or 5/8 (10-bit) more: size the ring to the format.
+  const size_t rowSize = UnpackPass::GetRowSize(width, bitsPerPixel);
+  const size_t frameSize = rowSize * height;
+  if (!m_upload_ring || m_upload_ring->GetSlotSize() != frameSize) {
+    m_upload_ring =
+        std::make_unique<PboUploadRing>(m_upload_ring_depth, frameSize);
+    std::cout << "[DEBUG] Sized PBO upload ring for " << bitsPerPixel
+              << " bits per pixel." << std::endl;
+  }
+
+  m_hdr_fusion_pass->Resize(static_cast<GLsizei>(bracketSize), width,
+                            height, exposureFormat);
+  // Gain is in dB; the motion mask compares exposure x linear gain.
+  m_hdr_fusion_pass->SetLayerExposure(
+      static_cast<GLsizei>(bracketSlot),
+      static_cast<float>(exposureUs *
+                         std::pow(10.0, gainDb / 20.0)));
+  if (bayer) {
+    m_demosaic_pass->Resize(width, height,
+                            packed && halfFloat ? GL_R16F : GL_R8);
+  }
+  if (packed) {
+    m_unpack_pass->Resize(width, height, bitsPerPixel);
+  }
+
+  // Rows arrive paddingX bytes apart; the slot holds them back to back.
+  const size_t sourceStride = rowSize + image.paddingX;
+  if (height <= 0 ||
+      image.size < sourceStride * static_cast<size_t>(height - 1) + rowSize) {
+    std::cerr << "[ERROR] Frame of " << image.size << " bytes is too small for "
+              << width << "x" << height << " pixels." << std::endl;
+    return false;
+  }
+
+  // MapSlot() logs its failure; the slot is left as it was.
+  uint8_t* slot = m_upload_ring->MapSlot();
+  if (!slot) {
+    return false;
+  }
+  if (image.paddingX == 0) {
+    std::memcpy(slot, data, frameSize);
+  } else {
+    for (int y = 0; y < height; ++y) {
+      std::memcpy(slot + y * rowSize, data + y * sourceStride, rowSize);
+    }
+  }
+  m_upload_ring->UnmapSlot();
+
+  // Upload from PBO to the bracket slot's layer, or to the packed bytes or
+  // mosaic that earlier passes turn into it
+  timer.Begin("upload");
+  if (packed) {
+    glBindTexture(GL_TEXTURE_2D, m_unpack_pass->GetPackedTexture());
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(rowSize),
+                    height, GL_RED_INTEGER, GL_UNSIGNED_BYTE,
+                    m_upload_ring->GetSlotOffset());
+    glBindTexture(GL_TEXTURE_2D, 0);
+  } else if (bayer) {
+    glBindTexture(GL_TEXTURE_2D, m_demosaic_pass->GetMosaicTexture());
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RED,
+                    GL_UNSIGNED_BYTE, m_upload_ring->GetSlotOffset());
+    glBindTexture(GL_TEXTURE_2D, 0);
+  } else {
+    glBindTexture(GL_TEXTURE_2D_ARRAY,
+                  m_hdr_fusion_pass->GetExposureTextureArray());
+    glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0,
+                    static_cast<GLint>(bracketSlot), width, height, 1,
+                    m_hdr_fusion_pass->GetExposureFormat(), GL_UNSIGNED_BYTE,
+                    m_upload_ring->GetSlotOffset());
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+  }
+  m_upload_ring->SubmitSlot();
+  timer.End();
+
+  if (packed && bayer) {
+    m_unpack_pass->Render(m_demosaic_pass->GetMosaicTexture(), -1,
+                          timer);
+  } else if (packed) {
+    m_unpack_pass->Render(m_hdr_fusion_pass->GetExposureTextureArray(),
+                          static_cast<GLint>(bracketSlot), timer);
+  }
+  if (bayer) {
+    m_demosaic_pass->SetAlgorithm(algorithm);
+    m_demosaic_pass->Render(m_hdr_fusion_pass->GetExposureTextureArray(),
+                            static_cast<GLint>(bracketSlot), bayerPattern,
+                            timer);
+  }
+
+  return true;
+}
+
+void FrameProcessor::Render(GLuint target, int width, int height,
+                            ToneMappingOperator toneOperator, float key,
+                            float adaptationSeconds, float elapsedSeconds,
+                            GpuTimer& timer) {
+  if (toneOperator == ToneMappingOperator::None) {
+    m_hdr_fusion_pass->Render(target, timer);
+    return;
+  }
+  m_tone_mapping_pass->Resize(width, height);
+  m_hdr_fusion_pass->Render(m_tone_mapping_pass->GetInputTexture(), timer);
+  m_tone_mapping_pass->SetOperator(toneOperator);
+  m_tone_mapping_pass->SetKey(key);
+  m_tone_mapping_pass->SetAdaptationTime(adaptationSeconds);
+  m_tone_mapping_pass->Render(target, elapsedSeconds, timer);
+}
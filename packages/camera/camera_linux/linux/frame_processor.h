@@ -0,0 +1,71 @@
+#ifndef FRAME_PROCESSOR_H_
+#define FRAME_PROCESSOR_H_
+
+#include <GLES3/gl3.h>
+
+#include <cstddef>
+#include <memory>
+
+#include "demosaic_pass.h"
+#include "exposure_fusion_pass.h"
+#include "frame_source.h"
+#include "gpu_timer.h"
+#include "pbo_upload_ring.h"
+#include "tone_mapping_pass.h"
+#include "unpack_pass.h"
+
+// The capture pipeline's per-frame GPU chain: uploads each frame of a bracket
+// through the PBO ring, unpacks and demosaics it into its layer of the
+// exposure array, and fuses and tone maps the bracket into a target texture.
+//
+// It holds no window-system state, so it runs on any GLES 3 context: the
+// preview's GDK context, or a headless EGL one in the benchmark.
+//
+// All methods must be called with the rendering GL context current.
+class FrameProcessor {
+ public:
+  // `intermediateFormat` is the fusion's output, as resolved by
+  // ResolveRenderFormat(). Frames are uploaded through `uploadRingDepth`
+  // PBO slots.
+  FrameProcessor(GLenum intermediateFormat, size_t uploadRingDepth);
+
+  FrameProcessor(const FrameProcessor&) = delete;
+  FrameProcessor& operator=(const FrameProcessor&) = delete;
+
+  // Uploads `image` to layer `bracketSlot` of a `bracketSize` exposure
+  // array. Returns false for a pixel format it cannot take, or a frame
+  // too small for its size.
+  bool Upload(const SourceFrame& image, size_t bracketSlot, size_t bracketSize,
+              double exposureUs, double gainDb, DemosaicAlgorithm algorithm,
+              GpuTimer& timer);
+
+  // Fuses the exposure array into `target`, tone mapping it unless
+  // `toneOperator` is None. `elapsedSeconds` since the previous frame
+  // drives the key's adaptation.
+  void Render(GLuint target, int width, int height,
+              ToneMappingOperator toneOperator, float key,
+              float adaptationSeconds, float elapsedSeconds, GpuTimer& timer);
+
+  ExposureFusionPass& GetFusionPass() { return *m_hdr_fusion_pass; }
+
+ private:
+  // sized by the first frame's pixel format
+  std::unique_ptr<PboUploadRing> m_upload_ring;
+  size_t m_upload_ring_depth;
+
+  // hdr fusion GPU shader pass, owns the per-bracket exposure array
+  std::unique_ptr<ExposureFusionPass> m_hdr_fusion_pass;
+
+  // unpack GPU shader pass for 10/12-bit packed frames, owns their raw bytes
+  std::unique_ptr<UnpackPass> m_unpack_pass;
+  // whether unpacked frames can be kept in half floats
+  bool m_can_render_half_float = false;
+
+  // demosaic GPU shader pass for Bayer frames, owns the raw mosaic texture
+  std::unique_ptr<DemosaicPass> m_demosaic_pass;
+
+  // tone mapping GPU shader pass, owns the fusion's intermediate target
+  std::unique_ptr<ToneMappingPass> m_tone_mapping_pass;
+};
+
+#endif  // FRAME_PROCESSOR_H_
@@ -0,0 +1,183 @@
+#ifndef FRAME_QUEUE_H_
+#define FRAME_QUEUE_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#define FRAME_QUEUE_CAPACITY 4
+
+enum class FrameQueueOverflowPolicy {
+  // Evict the oldest queued frame to make room: lowest latency.
+  DropOldest,
+  // Discard the incoming frame: keeps the queued sequence intact.
+  DropNewest,
+  // Wait for the consumer: never drops, back-pressures the producer.
+  Block,
+};
+
+// Bounded lock-free queue handing frames from the acquisition thread to the
+// GL thread.
+//
+// There is a single producer and a single consumer, but with DropOldest the
+// producer also pops, so each slot carries a sequence number that tells
+// whether it is free, filled, or still being read (Vyukov's bounded queue).
+template <typename T>
+class FrameQueue {
+ public:
+  FrameQueue(size_t capacity, FrameQueueOverflowPolicy policy)
+      : m_capacity(capacity),
+        m_policy(policy),
+        m_slots(new Slot[capacity]) {
+    for (size_t i = 0; i < capacity; ++i) {
+      m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  FrameQueue(const FrameQueue&) = delete;
+  FrameQueue& operator=(const FrameQueue&) = delete;
+
+  // Producer side. Returns false if the item was not queued, either because
+  // the queue is full under DropNewest or because it was closed.
+  bool Push(T&& item) {
+    const size_t pos = m_head.load(std::memory_order_relaxed);
+    Slot& slot = m_slots[pos % m_capacity];
+    for (unsigned int spins = 0;; ++spins) {
+      if (m_closed.load(std::memory_order_acquire)) {
+        return false;
+      }
+      const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+      if (sequence == pos) {
+        break;
+      }
+      // Full, or the consumer is still moving the oldest item out.
+      if (sequence == pos - m_capacity + 1) {
+        if (m_policy == FrameQueueOverflowPolicy::DropNewest) {
+          m_dropped.fetch_add(1, std::memory_order_relaxed);
+          return false;
+        }
+        if (m_policy == FrameQueueOverflowPolicy::DropOldest) {
+          // Only evict the item occupying this slot; if the consumer already
+          // claimed it, wait for it to finish reading instead.
+          T evicted;
+          if (TryPopAt(pos - m_capacity, evicted)) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            continue;
+          }
+        }
+      }
+      Backoff(spins);
+    }
+
+    slot.item = std::move(item);
+    slot.sequence.store(pos + 1, std::memory_order_release);
+    m_head.store(pos + 1, std::memory_order_release);
+    m_pushed.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  // Consumer side.
+  bool TryPop(T& item) {
+    for (;;) {
+      const size_t pos = m_tail.load(std::memory_order_relaxed);
+      const size_t sequence =
+          m_slots[pos % m_capacity].sequence.load(std::memory_order_acquire);
+      if (sequence != pos + 1) {
+        // Not written yet. Unless an eviction moved the tail, it is empty.
+        if (m_tail.load(std::memory_order_relaxed) == pos) {
+          return false;
+        }
+        continue;
+      }
+      if (TryPopAt(pos, item)) {
+        return true;
+      }
+      // Lost the slot to an eviction: retry from the new tail.
+    }
+  }
+
+  // Waits up to `timeout` for an item. Returns false on timeout, or once the
+  // queue is closed and drained.
+  bool Pop(T& item, std::chrono::milliseconds timeout) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    for (unsigned int spins = 0;; ++spins) {
+      if (TryPop(item)) {
+        return true;
+      }
+      if (m_closed.load(std::memory_order_acquire) ||
+          std::chrono::steady_clock::now() >= deadline) {
+        return false;
+      }
+      Backoff(spins);
+    }
+  }
+
+  // Wakes a producer blocked in Push(); further pushes are rejected.
+  void Close() { m_closed.store(true, std::memory_order_release); }
+  bool IsClosed() const { return m_closed.load(std::memory_order_acquire); }
+
+  size_t GetDepth() const {
+    const size_t head = m_head.load(std::memory_order_acquire);
+    const size_t tail = m_tail.load(std::memory_order_acquire);
+    return head > tail ? head - tail : 0;
+  }
+  size_t GetCapacity() const { return m_capacity; }
+  uint64_t GetPushedCount() const {
+    return m_pushed.load(std::memory_order_relaxed);
+  }
+  uint64_t GetDroppedCount() const {
+    return m_dropped.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct Slot {
+    std::atomic<size_t> sequence;
+    T item;
+  };
+
+  // Claims the item at `pos` if it is still the oldest one.
+  bool TryPopAt(size_t pos, T& item) {
+    Slot& slot = m_slots[pos % m_capacity];
+    if (slot.sequence.load(std::memory_order_acquire) != pos + 1) {
+      return false;
+    }
+    size_t expected = pos;
+    if (!m_tail.compare_exchange_strong(expected, pos + 1,
+                                        std::memory_order_acq_rel)) {
+      return false;
+    }
+    item = std::move(slot.item);
+    slot.item = T();
+    slot.sequence.store(pos + m_capacity, std::memory_order_release);
+    return true;
+  }
+
+  const size_t m_capacity;
+  const FrameQueueOverflowPolicy m_policy;
+  std::unique_ptr<Slot[]> m_slots;
+
+  // Kept on separate cache lines so the two threads do not false-share.
+  alignas(64) std::atomic<size_t> m_head{0};
+  alignas(64) std::atomic<size_t> m_tail{0};
+  alignas(64) std::atomic<bool> m_closed{false};
+  std::atomic<uint64_t> m_pushed{0};
+  std::atomic<uint64_t> m_dropped{0};
+
+  // Spin briefly, then yield, then sleep: frames arrive every few
+  // milliseconds, so a waiting side should not burn a core.
+  static void Backoff(unsigned int spins) {
+    if (spins < 64) {
+      return;
+    }
+    if (spins < 128) {
+      std::this_thread::yield();
+      return;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+  }
+};
+
+#endif  // FRAME_QUEUE_H_
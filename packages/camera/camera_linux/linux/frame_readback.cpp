@@ -0,0 +1,100 @@
+#include "frame_readback.h"
+
+FrameReadback::FrameReadback(size_t depth) : m_entries(depth) {
+  for (Entry& entry : m_entries) {
+    glGenBuffers(1, &entry.buffer);
+  }
+  glGenFramebuffers(1, &m_fbo);
+}
+
+FrameReadback::~FrameReadback() {
+  Unmap();
+  Discard();
+  for (Entry& entry : m_entries) {
+    glDeleteBuffers(1, &entry.buffer);
+  }
+  glDeleteFramebuffers(1, &m_fbo);
+}
+
+bool FrameReadback::Request(GLuint texture, GLsizei width, GLsizei height) {
+  if (m_in_flight == m_entries.size()) {
+    return false;
+  }
+
+  Entry& entry = m_entries[(m_head + m_in_flight) % m_entries.size()];
+  entry.width = width;
+  entry.height = height;
+
+  const size_t size = static_cast<size_t>(width) * height * 4;
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, entry.buffer);
+  if (entry.capacity < size) {
+    glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+    entry.capacity = size;
+  }
+
+  // RGBA rows of RGBA8 are always 4-byte aligned: the default pack
+  // alignment keeps them tightly packed.
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, m_fbo);
+  glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                         GL_TEXTURE_2D, texture, 0);
+  glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+  glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                         GL_TEXTURE_2D, 0, 0);
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+  entry.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  ++m_in_flight;
+  return true;
+}
+
+bool FrameReadback::Map(Frame& frame) {
+  if (m_in_flight == 0 || m_mapped) {
+    return false;
+  }
+  Entry& entry = m_entries[m_head];
+  const GLenum status = glClientWaitSync(entry.fence, 0, 0);
+  if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+    return false;
+  }
+  glDeleteSync(entry.fence);
+  entry.fence = nullptr;
+  m_head = (m_head + 1) % m_entries.size();
+  --m_in_flight;
+
+  const size_t bytesPerRow = static_cast<size_t>(entry.width) * 4;
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, entry.buffer);
+  const void* mapped = glMapBufferRange(
+      GL_PIXEL_PACK_BUFFER, 0, bytesPerRow * entry.height, GL_MAP_READ_BIT);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  if (!mapped) {
+    return false;
+  }
+  m_mapped = &entry;
+  frame.pixels = static_cast<const uint8_t*>(mapped);
+  frame.width = entry.width;
+  frame.height = entry.height;
+  frame.bytesPerRow = bytesPerRow;
+  return true;
+}
+
+void FrameReadback::Unmap() {
+  if (!m_mapped) {
+    return;
+  }
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, m_mapped->buffer);
+  glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  m_mapped = nullptr;
+}
+
+size_t FrameReadback::Discard() {
+  const size_t discarded = m_in_flight;
+  for (; m_in_flight > 0; --m_in_flight) {
+    Entry& entry = m_entries[m_head];
+    glDeleteSync(entry.fence);
+    entry.fence = nullptr;
+    m_head = (m_head + 1) % m_entries.size();
+  }
+  return discarded;
+}
@@ -0,0 +1,66 @@
+#ifndef FRAME_READBACK_H_
+#define FRAME_READBACK_H_
+
+#include <GLES3/gl3.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Asynchronous readback of RGBA8 textures to the CPU.
+//
+// Each request reads a texture into its own pack PBO behind a fence; the
+// pixels are mapped once the GPU is done, typically a frame later, so the
+// render loop never stalls on glReadPixels. Requests complete in order.
+//
+// All methods must be called with the rendering GL context current.
+class FrameReadback {
+ public:
+  struct Frame {
+    const uint8_t* pixels = nullptr;
+    GLsizei width = 0;
+    GLsizei height = 0;
+    // Rows are tightly packed RGBA, texture row 0 first.
+    size_t bytesPerRow = 0;
+  };
+
+  explicit FrameReadback(size_t depth);
+  ~FrameReadback();
+
+  FrameReadback(const FrameReadback&) = delete;
+  FrameReadback& operator=(const FrameReadback&) = delete;
+
+  // Queues a read of level 0 of a `width` x `height` RGBA8 2D texture.
+  // Returns false when every buffer is still in flight.
+  bool Request(GLuint texture, GLsizei width, GLsizei height);
+
+  // Maps the oldest finished read, if any, without blocking. The pixels stay
+  // valid until Unmap(), which must be called before the next Map().
+  bool Map(Frame& frame);
+  void Unmap();
+
+  // Drops every read in flight without mapping it. Returns how many were
+  // dropped.
+  size_t Discard();
+
+  size_t GetInFlightCount() const { return m_in_flight; }
+
+ private:
+  struct Entry {
+    GLuint buffer = 0;
+    size_t capacity = 0;
+    GLsync fence = nullptr;
+    GLsizei width = 0;
+    GLsizei height = 0;
+  };
+
+  std::vector<Entry> m_entries;
+  // Oldest entry in flight and number in flight
+  size_t m_head = 0;
+  size_t m_in_flight = 0;
+  // Entry mapped by Map(), if any
+  Entry* m_mapped = nullptr;
+  GLuint m_fbo = 0;
+};
+
+#endif  // FRAME_READBACK_H_
@@ -0,0 +1,75 @@
+#ifndef FRAME_SOURCE_H_
+#define FRAME_SOURCE_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Woverloaded-virtual"
+#pragma clang diagnostic ignored "-Wunused-variable"
+
+#include <pylon/PylonIncludes.h>
+
+#pragma clang diagnostic pop
+
+// A frame as a FrameSource delivers it, in one of the camera's pixel
+// formats. `pixels` stays valid while `owner` (a grab result, a replayed
+// file's mapping, a generated frame) is held.
+struct SourceFrame {
+  std::shared_ptr<const void> owner;
+  const uint8_t* pixels = nullptr;
+  size_t size = 0;
+  Pylon::EPixelType pixelType = Pylon::PixelType_Undefined;
+  int width = 0;
+  int height = 0;
+  size_t paddingX = 0;
+  // Increments by one per frame the camera sent, including frames lost
+  // before they reached the host
+  int64_t frameId = 0;
+  // Sequencer set the frame was exposed with, -1 if unknown
+  int sequencerSet = -1;
+  // Exposure the frame was taken with, 0 if the source does not know it
+  double exposureUs = 0.0;
+  double gainDb = 0.0;
+};
+
+// Where the capture pipeline gets its frames: a Pylon camera (or Pylon's
+// camera emulator), generated patterns, or a recorded raw sequence.
+//
+// Start(), Stop() and the size queries are called from the main thread;
+// Trigger() and Retrieve() from the pipeline's acquisition thread only.
+class FrameSource {
+ public:
+  virtual ~FrameSource() = default;
+
+  // The Pylon camera behind the source, for the sequencer, trigger and
+  // buffer setup only cameras have. nullptr for other sources.
+  virtual Pylon::CInstantCamera* GetCamera() { return nullptr; }
+
+  virtual void Start() = 0;
+  virtual void Stop() = 0;
+  virtual bool IsGrabbing() const = 0;
+
+  // Size and format of the frames delivered next. 0 if not known yet.
+  virtual int GetWidth() = 0;
+  virtual int GetHeight() = 0;
+  // Bytes of the largest frame delivered next
+  virtual size_t GetPayloadSize() = 0;
+  // Frames per second, 0 if as fast as they are retrieved
+  virtual double GetFrameRate() = 0;
+  // Returns false when the source cannot deliver `pixelType`.
+  virtual bool SetPixelType(Pylon::EPixelType pixelType) = 0;
+
+  // Requests a frame at `exposureUs` and `gainDb` (NAN to keep the gain),
+  // for sources exposed one trigger at a time. Others ignore it.
+  virtual void Trigger(double exposureUs, double gainDb) {}
+
+  // Waits up to `timeout` for the next frame. Returns false on timeout,
+  // once stopped, or for a frame that failed.
+  virtual bool Retrieve(SourceFrame& frame,
+                        std::chrono::milliseconds timeout) = 0;
+};
+
+#endif  // FRAME_SOURCE_H_
@@ -0,0 +1,158 @@
+#include "gl_utils.h"
+
+#include <dlfcn.h>
+
+#include <cstring>
+#include <iostream>
+
+const char* const kFullscreenVertexShader = R"(
+  #version 300 es
+  precision highp float;
+  out vec2 TexCoords;
+  void main() {
+    // One triangle covering the viewport: (-1,-1), (3,-1), (-1,3).
+    vec2 position = vec2(gl_VertexID == 1 ? 3.0 : -1.0,
+                         gl_VertexID == 2 ? 3.0 : -1.0);
+    TexCoords = position * 0.5 + 0.5;
+    gl_Position = vec4(position, 0.0, 1.0);
+  }
+)";
+
+void* GetGLProcAddress(const char* name) {
+  using GetProcAddressFunc = void* (*)(const char*);
+  // Looked up at runtime so the plugin links against neither libEGL nor
+  // libGLX directly.
+  static const GetProcAddressFunc eglGetProcAddress =
+      reinterpret_cast<GetProcAddressFunc>(
+          dlsym(RTLD_DEFAULT, "eglGetProcAddress"));
+  static const GetProcAddressFunc glXGetProcAddressARB =
+      reinterpret_cast<GetProcAddressFunc>(
+          dlsym(RTLD_DEFAULT, "glXGetProcAddressARB"));
+
+  void* proc = nullptr;
+  if (eglGetProcAddress) {
+    proc = eglGetProcAddress(name);
+  }
+  if (!proc && glXGetProcAddressARB) {
+    proc = glXGetProcAddressARB(name);
+  }
+  if (!proc) {
+    proc = dlsym(RTLD_DEFAULT, name);
+  }
+  return proc;
+}
+
+bool HasGLExtension(const char* name) {
+  GLint count = 0;
+  glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+  for (GLint i = 0; i < count; ++i) {
+    const char* extension =
+        reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+    if (extension && std::strcmp(extension, name) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool CanRenderToHalfFloat() {
+  // Desktop GL renders to float formats unconditionally.
+  return HasGLExtension("GL_EXT_color_buffer_half_float") ||
+         HasGLExtension("GL_EXT_color_buffer_float") ||
+         HasGLExtension("GL_ARB_color_buffer_float");
+}
+
+bool CanRenderTo(GLenum internalFormat) {
+  GLint previousFramebuffer = 0;
+  glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previousFramebuffer);
+  while (glGetError() != GL_NO_ERROR) {
+  }
+
+  GLuint texture = 0;
+  GLuint framebuffer = 0;
+  glGenTextures(1, &texture);
+  glBindTexture(GL_TEXTURE_2D, texture);
+  glTexStorage2D(GL_TEXTURE_2D, 1, internalFormat, 1, 1);
+  glGenFramebuffers(1, &framebuffer);
+  glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                         texture, 0);
+  // An unknown format fails glTexStorage2D and leaves the attachment
+  // incomplete.
+  const bool renderable =
+      glGetError() == GL_NO_ERROR &&
+      glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+
+  glBindFramebuffer(GL_FRAMEBUFFER, previousFramebuffer);
+  glDeleteFramebuffers(1, &framebuffer);
+  glBindTexture(GL_TEXTURE_2D, 0);
+  glDeleteTextures(1, &texture);
+  return renderable;
+}
+
+GLenum ResolveRenderFormat(GLenum internalFormat) {
+  if (CanRenderTo(internalFormat)) {
+    return internalFormat;
+  }
+  const GLenum fallback = internalFormat == GL_R16F ? GL_R8 : GL_RGB10_A2;
+  std::cout << "[DEBUG] Cannot render to " << GetFormatName(internalFormat)
+            << ", falling back to " << GetFormatName(fallback) << "."
+            << std::endl;
+  return fallback;
+}
+
+const char* GetFormatName(GLenum internalFormat) {
+  switch (internalFormat) {
+    case GL_R8:
+      return "R8";
+    case GL_RGB8:
+      return "RGB8";
+    case GL_RGBA8:
+      return "RGBA8";
+    case GL_RGB10_A2:
+      return "RGB10_A2";
+    case GL_R16F:
+      return "R16F";
+    case GL_RGBA16F:
+      return "RGBA16F";
+    default:
+      return "unknown";
+  }
+}
+
+static GLuint CompileShader(GLenum type, const char* src) {
+  GLuint shader = glCreateShader(type);
+  glShaderSource(shader, 1, &src, nullptr);
+  glCompileShader(shader);
+  GLint success;
+  glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+  if (!success) {
+    char log[512];
+    glGetShaderInfoLog(shader, 512, nullptr, log);
+    std::cerr << "Shader compile error: " << log << std::endl;
+  }
+  return shader;
+}
+
+GLuint CreateShaderProgram(const char* vertexSrc, const char* fragmentSrc) {
+  GLuint vs = CompileShader(GL_VERTEX_SHADER, vertexSrc);
+  GLuint fs = CompileShader(GL_FRAGMENT_SHADER, fragmentSrc);
+
+  GLuint program = glCreateProgram();
+  glAttachShader(program, vs);
+  glAttachShader(program, fs);
+  glLinkProgram(program);
+  glDeleteShader(vs);
+  glDeleteShader(fs);
+
+  GLint success;
+  glGetProgramiv(program, GL_LINK_STATUS, &success);
+  if (!success) {
+    char log[512];
+    glGetProgramInfoLog(program, 512, nullptr, log);
+    std::cerr << "Shader program link error: " << log << std::endl;
+    glDeleteProgram(program);
+    return 0;
+  }
+  return program;
+}
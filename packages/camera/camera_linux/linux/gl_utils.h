@@ -0,0 +1,37 @@
+#ifndef GL_UTILS_H_
+#define GL_UTILS_H_
+
+#include <GLES3/gl3.h>
+
+// Vertex shader for attribute-less full-screen passes: draw 3 vertices with
+// an empty VAO bound. Outputs TexCoords in [0, 1], origin bottom-left.
+extern const char* const kFullscreenVertexShader;
+
+// Resolves a GL entry point that is not part of the GLES 3.0 core through the
+// loader of whichever window system (EGL or GLX) GDK created the context on.
+// Returns nullptr when the entry point is unavailable.
+void* GetGLProcAddress(const char* name);
+
+// True if the current context advertises the given extension.
+bool HasGLExtension(const char* name);
+
+// True if half-float textures can be rendered to.
+bool CanRenderToHalfFloat();
+
+// True if a texture of `internalFormat` is a complete colour attachment on
+// the current context. Probes with a 1x1 texture and framebuffer.
+bool CanRenderTo(GLenum internalFormat);
+
+// `internalFormat` if the current context can render to it, otherwise the
+// closest format it can: float formats fall back to RGB10_A2 (colour) or R8
+// (single channel).
+GLenum ResolveRenderFormat(GLenum internalFormat);
+
+// Short name of a sized internal format, for logs
+const char* GetFormatName(GLenum internalFormat);
+
+// Compiles and links a program, logging errors to stderr. Returns 0 on
+// failure.
+GLuint CreateShaderProgram(const char* vertexSrc, const char* fragmentSrc);
+
+#endif  // GL_UTILS_H_
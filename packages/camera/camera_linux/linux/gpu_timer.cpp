@@ -0,0 +1,123 @@
+#include "gpu_timer.h"
+
+#include <GLES2/gl2ext.h>
+
+#include <iomanip>
+#include <sstream>
+
+#include "gl_utils.h"
+
+// Weight of the newest sample in the smoothed stage time.
+static constexpr double kSmoothing = 0.1;
+
+GpuTimer::GpuTimer() {
+  m_has_disjoint = HasGLExtension("GL_EXT_disjoint_timer_query");
+  m_supported = m_has_disjoint || HasGLExtension("GL_ARB_timer_query");
+}
+
+GpuTimer::~GpuTimer() {
+  for (Stage& stage : m_stages) {
+    glDeleteQueries(GPU_TIMER_LATENCY, stage.queries);
+  }
+}
+
+GpuTimer::Stage& GpuTimer::GetStage(const char* name) {
+  for (Stage& stage : m_stages) {
+    if (stage.name == name) {
+      return stage;
+    }
+  }
+  m_stages.emplace_back();
+  Stage& stage = m_stages.back();
+  stage.name = name;
+  glGenQueries(GPU_TIMER_LATENCY, stage.queries);
+  return stage;
+}
+
+void GpuTimer::Begin(const char* stage) {
+  if (!m_supported || m_active) {
+    return;
+  }
+  m_active = &GetStage(stage);
+  const size_t slot = m_frame % GPU_TIMER_LATENCY;
+  glBeginQuery(GL_TIME_ELAPSED_EXT, m_active->queries[slot]);
+}
+
+void GpuTimer::End() {
+  if (!m_active) {
+    return;
+  }
+  glEndQuery(GL_TIME_ELAPSED_EXT);
+  m_active->pending[m_frame % GPU_TIMER_LATENCY] = true;
+  m_active = nullptr;
+}
+
+void GpuTimer::EndFrame() {
+  if (!m_supported) {
+    return;
+  }
+  ++m_frame;
+
+  // A disjoint event (frequency change, context loss) voids every query in
+  // flight.
+  GLint disjoint = 0;
+  if (m_has_disjoint) {
+    glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+  }
+
+  // The slot about to be reused was issued GPU_TIMER_LATENCY frames ago and
+  // is normally long done; if not, waiting here is still cheaper than
+  // overwriting it.
+  const size_t slot = m_frame % GPU_TIMER_LATENCY;
+  for (Stage& stage : m_stages) {
+    if (!stage.pending[slot]) {
+      continue;
+    }
+    stage.pending[slot] = false;
+    if (disjoint) {
+      continue;
+    }
+    GLuint elapsedNs = 0;
+    glGetQueryObjectuiv(stage.queries[slot], GL_QUERY_RESULT, &elapsedNs);
+    const double ms = elapsedNs / 1e6;
+    stage.ms = stage.ms == 0.0 ? ms : stage.ms + kSmoothing * (ms - stage.ms);
+    stage.totalMs += ms;
+    ++stage.samples;
+  }
+}
+
+double GpuTimer::GetStageMs(const char* stage) const {
+  for (const Stage& s : m_stages) {
+    if (s.name == stage) {
+      return s.ms;
+    }
+  }
+  return 0.0;
+}
+
+double GpuTimer::GetStageMeanMs(const char* stage) const {
+  for (const Stage& s : m_stages) {
+    if (s.name == stage) {
+      return s.samples ? s.totalMs / s.samples : 0.0;
+    }
+  }
+  return 0.0;
+}
+
+std::vector<std::string> GpuTimer::GetStageNames() const {
+  std::vector<std::string> names;
+  for (const Stage& stage : m_stages) {
+    names.push_back(stage.name);
+  }
+  return names;
+}
+
+std::string GpuTimer::Report() const {
+  std::ostringstream report;
+  report << std::fixed << std::setprecision(2);
+  for (size_t i = 0; i < m_stages.size(); ++i) {
+    report << (i ? ", " : "") << m_stages[i].name << " " << m_stages[i].ms
+           << " ms";
+  }
+  return report.str();
+}
@@ -0,0 +1,61 @@
+#ifndef GPU_TIMER_H_
+#define GPU_TIMER_H_
+
+#include <GLES3/gl3.h>
+
+#include <string>
+#include <vector>
+
+#define GPU_TIMER_LATENCY 4
+
+// Per-stage GPU timings from GL_TIME_ELAPSED queries.
+//
+// Each stage keeps GPU_TIMER_LATENCY queries in flight and reads them back
+// that many frames later, so measuring never stalls the pipeline. Stages must
+// not nest. Without EXT_disjoint_timer_query / ARB_timer_query every call is
+// a no-op.
+//
+// All methods must be called with the rendering GL context current.
+class GpuTimer {
+ public:
+  GpuTimer();
+  ~GpuTimer();
+
+  GpuTimer(const GpuTimer&) = delete;
+  GpuTimer& operator=(const GpuTimer&) = delete;
+
+  void Begin(const char* stage);
+  void End();
+  // Collects the results that came back and moves to the next frame.
+  void EndFrame();
+
+  bool IsSupported() const { return m_supported; }
+  // Smoothed duration of a stage in milliseconds, 0 if never measured.
+  double GetStageMs(const char* stage) const;
+  // Mean duration of a stage over every frame measured, for benchmarks.
+  double GetStageMeanMs(const char* stage) const;
+  // Stages in first-measured order
+  std::vector<std::string> GetStageNames() const;
+  // "stage 1.23 ms, stage 0.45 ms, ..." in first-measured order.
+  std::string Report() const;
+
+ private:
+  struct Stage {
+    std::string name;
+    GLuint queries[GPU_TIMER_LATENCY] = {0};
+    bool pending[GPU_TIMER_LATENCY] = {false};
+    double ms = 0.0;
+    double totalMs = 0.0;
+    size_t samples = 0;
+  };
+
+  bool m_supported = false;
+  bool m_has_disjoint = false;
+  size_t m_frame = 0;
+  Stage* m_active = nullptr;
+  std::vector<Stage> m_stages;
+
+  Stage& GetStage(const char* name);
+};
+
+#endif  // GPU_TIMER_H_
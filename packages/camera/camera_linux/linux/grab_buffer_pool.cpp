@@ -0,0 +1,81 @@
+#include "grab_buffer_pool.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+size_t GrabBufferPool::AlignToPage(size_t size) {
+  const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  return (size + pageSize - 1) / pageSize * pageSize;
+}
+
+GrabBufferPool::GrabBufferPool(size_t bufferCount, size_t bufferSize)
+    : m_arena(nullptr),
+      m_arena_size(0),
+      m_buffer_stride(AlignToPage(bufferSize)) {
+  m_arena_size = m_buffer_stride * bufferCount;
+  void* arena = mmap(nullptr, m_arena_size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+  if (arena == MAP_FAILED) {
+    throw std::bad_alloc();
+  }
+  // Best effort: keep the arena resident so DMA never waits on a page fault.
+  mlock(arena, m_arena_size);
+  m_arena = static_cast<uint8_t*>(arena);
+  m_free.assign(bufferCount, true);
+}
+
+GrabBufferPool::~GrabBufferPool() {
+  if (m_arena) {
+    munlock(m_arena, m_arena_size);
+    munmap(m_arena, m_arena_size);
+  }
+}
+
+void GrabBufferPool::AllocateBuffer(size_t bufferSize, void** pCreatedBuffer,
+                                    intptr_t& bufferContext) {
+  if (bufferSize <= m_buffer_stride) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (size_t i = 0; i < m_free.size(); ++i) {
+      if (m_free[i]) {
+        m_free[i] = false;
+        *pCreatedBuffer = m_arena + i * m_buffer_stride;
+        bufferContext = static_cast<intptr_t>(i);
+        return;
+      }
+    }
+  }
+
+  // The payload grew (e.g. chunks enabled) or MaxNumBuffer exceeds the pool:
+  // keep grabbing from the heap rather than failing StartGrabbing.
+  std::cerr << "[WARN] Grab buffer pool exhausted, allocating " << bufferSize
+            << " bytes from the heap." << std::endl;
+  void* buffer = nullptr;
+  if (posix_memalign(&buffer, static_cast<size_t>(sysconf(_SC_PAGESIZE)),
+                     bufferSize) != 0) {
+    throw std::bad_alloc();
+  }
+  *pCreatedBuffer = buffer;
+  bufferContext = kSpilledBufferContext;
+}
+
+void GrabBufferPool::FreeBuffer(void* pCreatedBuffer, intptr_t bufferContext) {
+  if (!IsPooled(bufferContext)) {
+    free(pCreatedBuffer);
+    return;
+  }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_free[static_cast<size_t>(bufferContext)] = true;
+}
+
+void GrabBufferPool::DestroyBufferFactory() {
+  // Registered with Cleanup_None: the capture pipeline owns the pool.
+}
+
+bool GrabBufferPool::IsPooled(intptr_t bufferContext) const {
+  return bufferContext >= 0 &&
+         static_cast<size_t>(bufferContext) < m_free.size();
+}
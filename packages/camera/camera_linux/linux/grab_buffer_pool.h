@@ -0,0 +1,58 @@
+#ifndef GRAB_BUFFER_POOL_H_
+#define GRAB_BUFFER_POOL_H_
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Woverloaded-virtual"
+#pragma clang diagnostic ignored "-Wunused-variable"
+
+#include <pylon/PylonIncludes.h>
+
+#pragma clang diagnostic pop
+
+#include <mutex>
+#include <vector>
+
+#define GRAB_BUFFER_POOL_SIZE 10
+#define GRAB_BUFFER_POOL_MAX_SIZE 64
+
+// Pylon buffer factory handing out fixed-size, page-aligned slices of a
+// single preallocated, locked arena, so starting a grab never hits the
+// allocator and the camera never waits on a page fault.
+//
+// The pipeline still copies each frame into a slot of the PBO upload ring
+// on the GL thread. The pool is registered before grabbing starts, ahead of
+// the GL thread and its context, and a buffer goes back to the camera as
+// soon as its frame is released, not once the GPU is done reading it.
+class GrabBufferPool : public Pylon::IBufferFactory {
+ public:
+  static constexpr intptr_t kSpilledBufferContext = -1;
+
+  GrabBufferPool(size_t bufferCount, size_t bufferSize);
+  ~GrabBufferPool() override;
+
+  GrabBufferPool(const GrabBufferPool&) = delete;
+  GrabBufferPool& operator=(const GrabBufferPool&) = delete;
+
+  void AllocateBuffer(size_t bufferSize, void** pCreatedBuffer,
+                      intptr_t& bufferContext) override;
+  void FreeBuffer(void* pCreatedBuffer, intptr_t bufferContext) override;
+  void DestroyBufferFactory() override;
+
+  size_t GetBufferCount() const { return m_free.size(); }
+  size_t GetBufferStride() const { return m_buffer_stride; }
+
+  static size_t AlignToPage(size_t size);
+
+ private:
+  // Whether the buffer behind a grab result was carved from the arena.
+  bool IsPooled(intptr_t bufferContext) const;
+
+  uint8_t* m_arena;
+  size_t m_arena_size;
+  size_t m_buffer_stride;
+
+  std::mutex m_mutex;
+  std::vector<bool> m_free;
+};
+
+#endif  // GRAB_BUFFER_POOL_H_
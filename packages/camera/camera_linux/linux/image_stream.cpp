@@ -0,0 +1,142 @@
+#include "image_stream.h"
+
+#include <cstring>
+#include <iostream>
+
+#include "downscale_pass.h"
+
+struct ImageStream::PostedFrame {
+  std::shared_ptr<ImageStream> stream;
+  std::vector<uint8_t> pixels;
+  int width = 0;
+  int height = 0;
+  size_t bytesPerRow = 0;
+};
+
+// Completes the send. Dart only returns the credit of a frame it received:
+// return it here when the send failed.
+static void OnFrameSent(GObject* object, GAsyncResult* result,
+                        gpointer user_data) {
+  std::unique_ptr<std::shared_ptr<ImageStream>> stream(
+      static_cast<std::shared_ptr<ImageStream>*>(user_data));
+  g_autoptr(CameraLinuxCameraEventApiImageStreamFrameResponse) response =
+      camera_linux_camera_event_api_image_stream_frame_finish(
+          CAMERA_LINUX_CAMERA_EVENT_API(object), result, nullptr);
+  if (!response ||
+      camera_linux_camera_event_api_image_stream_frame_response_is_error(
+          response)) {
+    std::cerr << "[WARN] Failed to send an image stream frame." << std::endl;
+    (*stream)->ReleaseCredit();
+  }
+}
+
+ImageStream::ImageStream(CameraLinuxCameraEventApi* eventApi,
+                         const ImageStreamOptions& options)
+    : m_event_api(eventApi), m_options(options) {
+  if (m_event_api) g_object_ref(m_event_api);
+}
+
+ImageStream::~ImageStream() {
+  if (m_event_api) g_object_unref(m_event_api);
+}
+
+void ImageStream::GetFrameSize(int sourceWidth, int sourceHeight, int& width,
+                               int& height) const {
+  width = m_options.width;
+  height = m_options.height;
+  GetDownscaledSize(sourceWidth, sourceHeight, width, height);
+}
+
+bool ImageStream::TryAcquireCredit(
+    std::chrono::steady_clock::time_point time) {
+  if (m_closed.load()) {
+    return false;
+  }
+  if (m_options.maxFrameRate > 0.0) {
+    if (time < m_next_frame_time) {
+      return false;
+    }
+    const auto interval =
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(1.0 / m_options.maxFrameRate));
+    // Keep the cadence through jitter, resync after a stall.
+    m_next_frame_time = time - m_next_frame_time < interval
+                            ? m_next_frame_time + interval
+                            : time + interval;
+  }
+
+  int credits = m_credits.load();
+  while (credits > 0 &&
+         !m_credits.compare_exchange_weak(credits, credits - 1)) {
+  }
+  if (credits <= 0) {
+    ++m_dropped_frames;
+    return false;
+  }
+  return true;
+}
+
+void ImageStream::CancelCredit() {
+  ReleaseCredit();
+}
+
+void ImageStream::ReleaseCredit() {
+  // Acks of frames sent before a restart may arrive after it: never exceed
+  // the initial credits.
+  int credits = m_credits.load();
+  while (credits < IMAGE_STREAM_CREDITS &&
+         !m_credits.compare_exchange_weak(credits, credits + 1)) {
+  }
+}
+
+void ImageStream::Deliver(const uint8_t* pixels, int width, int height,
+                          size_t bytesPerRow) {
+  if (m_closed.load()) {
+    CancelCredit();
+    return;
+  }
+  auto* frame = new PostedFrame();
+  {
+    std::lock_guard<std::mutex> lock(m_pool_mutex);
+    if (!m_free_buffers.empty()) {
+      frame->pixels = std::move(m_free_buffers.back());
+      m_free_buffers.pop_back();
+    }
+  }
+  // Keeps its capacity across frames of the same size.
+  frame->pixels.resize(bytesPerRow * height);
+  std::memcpy(frame->pixels.data(), pixels, frame->pixels.size());
+  frame->stream = shared_from_this();
+  frame->width = width;
+  frame->height = height;
+  frame->bytesPerRow = bytesPerRow;
+  g_idle_add(SendFrame, frame);
+}
+
+gboolean ImageStream::SendFrame(gpointer data) {
+  std::unique_ptr<PostedFrame> frame(static_cast<PostedFrame*>(data));
+  ImageStream& stream = *frame->stream;
+  if (stream.m_closed.load() || !stream.m_event_api) {
+    stream.CancelCredit();
+  } else {
+    // The message copies the pixels: the buffer goes straight back to the
+    // pool, while the credit waits for Dart.
+    camera_linux_camera_event_api_image_stream_frame(
+        stream.m_event_api, frame->width, frame->height, frame->bytesPerRow,
+        frame->pixels.data(), frame->pixels.size(),
+        static_cast<int64_t>(stream.GetDroppedFrameCount()), nullptr,
+        OnFrameSent, new std::shared_ptr<ImageStream>(frame->stream));
+  }
+  std::lock_guard<std::mutex> lock(stream.m_pool_mutex);
+  if (stream.m_free_buffers.size() < IMAGE_STREAM_CREDITS) {
+    stream.m_free_buffers.push_back(std::move(frame->pixels));
+  }
+  return G_SOURCE_REMOVE;
+}
+
+void ImageStream::Close() {
+  if (!m_closed.exchange(true)) {
+    std::cout << "[DEBUG] Image stream closed, " << GetDroppedFrameCount()
+              << " frames dropped." << std::endl;
+  }
+}
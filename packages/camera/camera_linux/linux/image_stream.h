@@ -0,0 +1,89 @@
+#ifndef IMAGE_STREAM_H_
+#define IMAGE_STREAM_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "messages.g.h"
+
+// Frames Dart may hold at once; frames rendered while all are out are
+// dropped
+#define IMAGE_STREAM_CREDITS 2
+
+struct ImageStreamOptions {
+  // Size of the streamed frames; 0 keeps the source's, or its aspect ratio
+  // when only one of them is 0.
+  int width = 0;
+  int height = 0;
+  // 0 streams every rendered frame.
+  double maxFrameRate = 0.0;
+};
+
+// Streams rendered frames to Dart through CameraEventApi.imageStreamFrame.
+//
+// Back pressure is credit based: each frame takes one of
+// IMAGE_STREAM_CREDITS credits, and Dart returns it through
+// CameraApi.receivedImageStreamData once done with the frame. While every
+// credit is out, new frames are dropped, and counted, instead of queueing
+// up behind a slow isolate. Credits also bound the pixel buffers in flight,
+// which are recycled through a pool.
+//
+// The GL thread captures frames; delivery and credit returns happen on the
+// main loop. Held through a shared_ptr so posted frames keep it alive.
+class ImageStream : public std::enable_shared_from_this<ImageStream> {
+ public:
+  ImageStream(CameraLinuxCameraEventApi* eventApi,
+              const ImageStreamOptions& options);
+  ~ImageStream();
+
+  ImageStream(const ImageStream&) = delete;
+  ImageStream& operator=(const ImageStream&) = delete;
+
+  // Size of the frames streamed from a `sourceWidth` x `sourceHeight`
+  // source.
+  void GetFrameSize(int sourceWidth, int sourceHeight, int& width,
+                    int& height) const;
+
+  // GL thread: whether to capture the frame rendered at `time`. False when
+  // the rate limit skips it, or when no credit is left, which counts as a
+  // drop. A true return holds a credit until Dart returns it, or until
+  // CancelCredit() when the capture fails.
+  bool TryAcquireCredit(std::chrono::steady_clock::time_point time);
+  void CancelCredit();
+
+  // GL thread: copies a captured frame into a pooled buffer and posts it to
+  // Dart.
+  void Deliver(const uint8_t* pixels, int width, int height,
+               size_t bytesPerRow);
+
+  // Main thread: Dart is done with a frame.
+  void ReleaseCredit();
+
+  // Stops delivery; frames already posted are recycled unsent.
+  void Close();
+
+  uint64_t GetDroppedFrameCount() const { return m_dropped_frames.load(); }
+
+ private:
+  struct PostedFrame;
+
+  CameraLinuxCameraEventApi* m_event_api;
+  ImageStreamOptions m_options;
+  std::atomic<bool> m_closed{false};
+  std::atomic<int> m_credits{IMAGE_STREAM_CREDITS};
+  std::atomic<uint64_t> m_dropped_frames{0};
+  // Due time of the next frame under the rate limit (GL thread only)
+  std::chrono::steady_clock::time_point m_next_frame_time;
+
+  std::mutex m_pool_mutex;
+  std::vector<std::vector<uint8_t>> m_free_buffers;
+
+  static gboolean SendFrame(gpointer data);
+};
+
+#endif  // IMAGE_STREAM_H_
@@ -0,0 +1,222 @@
+#include "jpeg_encoder.h"
+
+#include <algorithm>
+#include <csetjmp>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <jpeglib.h>
+
+struct JpegErrorManager {
+  jpeg_error_mgr base;
+  jmp_buf jump;
+};
+
+static void OnJpegError(j_common_ptr cinfo) {
+  char message[JMSG_LENGTH_MAX];
+  cinfo->err->format_message(cinfo, message);
+  std::cerr << "JPEG encoding failed: " << message << std::endl;
+  longjmp(reinterpret_cast<JpegErrorManager*>(cinfo->err)->jump, 1);
+}
+
+static int GetMcuHeight(JpegPixelFormat format,
+                        const JpegSettings& settings) {
+  return format != JpegPixelFormat::Gray &&
+                 settings.subsampling == JpegSubsampling::Yuv420
+             ? 16
+             : 8;
+}
+
+static int GetMcuWidth(JpegPixelFormat format,
+                       const JpegSettings& settings) {
+  return format != JpegPixelFormat::Gray &&
+                 settings.subsampling != JpegSubsampling::Yuv444
+             ? 16
+             : 8;
+}
+
+// Encodes `rows` rows as a complete JPEG in `jpeg`, with a restart marker
+// every `restartRows` rows of blocks.
+static bool EncodeStrip(const uint8_t* pixels, int width, int rows,
+                        size_t bytesPerRow, JpegPixelFormat format,
+                        const JpegSettings& settings, int restartRows,
+                        std::vector<uint8_t>& jpeg) {
+  jpeg_compress_struct cinfo;
+  JpegErrorManager error;
+  cinfo.err = jpeg_std_error(&error.base);
+  error.base.error_exit = OnJpegError;
+  unsigned char* buffer = nullptr;
+  unsigned long size = 0;
+  if (setjmp(error.jump)) {
+    jpeg_destroy_compress(&cinfo);
+    free(buffer);
+    return false;
+  }
+  jpeg_create_compress(&cinfo);
+  jpeg_mem_dest(&cinfo, &buffer, &size);
+
+  cinfo.image_width = static_cast<JDIMENSION>(width);
+  cinfo.image_height = static_cast<JDIMENSION>(rows);
+  switch (format) {
+    case JpegPixelFormat::Gray:
+      cinfo.input_components = 1;
+      cinfo.in_color_space = JCS_GRAYSCALE;
+      break;
+    case JpegPixelFormat::Rgb:
+      cinfo.input_components = 3;
+      cinfo.in_color_space = JCS_EXT_RGB;
+      break;
+    case JpegPixelFormat::Rgba:
+      cinfo.input_components = 4;
+      cinfo.in_color_space = JCS_EXT_RGBA;
+      break;
+  }
+  jpeg_set_defaults(&cinfo);
+  jpeg_set_quality(&cinfo, settings.quality, TRUE);
+  if (format != JpegPixelFormat::Gray) {
+    cinfo.comp_info[0].h_samp_factor = GetMcuWidth(format, settings) / 8;
+    cinfo.comp_info[0].v_samp_factor = GetMcuHeight(format, settings) / 8;
+  }
+  // Strips are joined as they are: every one must use the standard
+  // Huffman tables rather than ones fitted to its own content.
+  cinfo.optimize_coding = FALSE;
+  cinfo.restart_in_rows = restartRows;
+
+  jpeg_start_compress(&cinfo, TRUE);
+  while (cinfo.next_scanline < cinfo.image_height) {
+    JSAMPROW row = const_cast<JSAMPROW>(pixels + cinfo.next_scanline *
+                                                     bytesPerRow);
+    jpeg_write_scanlines(&cinfo, &row, 1);
+  }
+  jpeg_finish_compress(&cinfo);
+  jpeg.assign(buffer, buffer + size);
+  jpeg_destroy_compress(&cinfo);
+  free(buffer);
+  return true;
+}
+
+// Offset of the entropy-coded data of a JPEG written by EncodeStrip(), and
+// of the frame height in its SOF marker. Returns false when either is
+// missing.
+static bool FindScan(const std::vector<uint8_t>& jpeg, size_t& scanOffset,
+                     size_t& heightOffset) {
+  heightOffset = 0;
+  // Markers after SOI each carry their length, SOS included.
+  size_t offset = 2;
+  while (offset + 4 <= jpeg.size() && jpeg[offset] == 0xFF) {
+    const uint8_t marker = jpeg[offset + 1];
+    const size_t length = (jpeg[offset + 2] << 8) | jpeg[offset + 3];
+    if (marker == 0xC0) {
+      heightOffset = offset + 5;
+    } else if (marker == 0xDA) {
+      scanOffset = offset + 2 + length;
+      return heightOffset != 0 && scanOffset + 2 <= jpeg.size();
+    }
+    offset += 2 + length;
+  }
+  return false;
+}
+
+// Appends the entropy-coded data of `jpeg`, renumbering its restart
+// markers to follow `nextRestart`.
+static void AppendScan(const std::vector<uint8_t>& jpeg, size_t scanOffset,
+                       unsigned& nextRestart, std::vector<uint8_t>& output) {
+  // Data bytes of 0xFF are stuffed with 0x00: any other byte after one is
+  // a marker.
+  const size_t end = jpeg.size() - 2;
+  for (size_t i = scanOffset; i < end; ++i) {
+    output.push_back(jpeg[i]);
+    if (jpeg[i] == 0xFF && i + 1 < end && (jpeg[i + 1] & 0xF8) == 0xD0) {
+      output.push_back(static_cast<uint8_t>(0xD0 | (nextRestart++ & 7)));
+      ++i;
+    }
+  }
+}
+
+bool WriteJpeg(const uint8_t* pixels, int width, int height,
+               size_t bytesPerRow, JpegPixelFormat format,
+               const JpegSettings& settings, size_t stripCount,
+               const std::string& filePath) {
+  const int mcuHeight = GetMcuHeight(format, settings);
+  const int mcuWidth = GetMcuWidth(format, settings);
+  const int mcuRows = (height + mcuHeight - 1) / mcuHeight;
+  const int mcusPerRow = (width + mcuWidth - 1) / mcuWidth;
+  const int maxRestartRows =
+      std::max(1, JPEG_MAX_RESTART_INTERVAL / std::max(1, mcusPerRow));
+
+  int restartRows = std::min(settings.restartInterval, maxRestartRows);
+  int stripRows = mcuRows;
+  if (stripCount > 1 && height >= JPEG_PARALLEL_MIN_ROWS) {
+    stripRows = (mcuRows + static_cast<int>(stripCount) - 1) /
+                static_cast<int>(stripCount);
+    // Strips are whole restart intervals: the markers between them reset
+    // the DC predictors each one starts from.
+    if (restartRows == 0) {
+      restartRows = std::min(stripRows, maxRestartRows);
+    }
+    stripRows = (stripRows + restartRows - 1) / restartRows * restartRows;
+  }
+  const int strips = (mcuRows + stripRows - 1) / stripRows;
+
+  std::vector<std::vector<uint8_t>> jpegs(strips);
+  std::vector<char> encoded(strips, 0);
+  auto encode = [&](int strip) {
+    const int firstRow = strip * stripRows * mcuHeight;
+    const int rows = std::min(stripRows * mcuHeight, height - firstRow);
+    encoded[strip] = EncodeStrip(pixels + firstRow * bytesPerRow, width, rows,
+                                 bytesPerRow, format, settings, restartRows,
+                                 jpegs[strip]);
+  };
+  std::vector<std::thread> workers;
+  for (int strip = 1; strip < strips; ++strip) {
+    workers.emplace_back(encode, strip);
+  }
+  encode(0);
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+  for (char ok : encoded) {
+    if (!ok) return false;
+  }
+
+  std::vector<uint8_t> output;
+  if (strips == 1) {
+    output = std::move(jpegs[0]);
+  } else {
+    // Headers of the first strip, grown to the full height, then every
+    // strip's scan with a restart marker between them.
+    size_t scanOffset = 0;
+    size_t heightOffset = 0;
+    if (!FindScan(jpegs[0], scanOffset, heightOffset)) {
+      std::cerr << "JPEG encoding failed: no scan in strip" << std::endl;
+      return false;
+    }
+    output.assign(jpegs[0].begin(), jpegs[0].begin() + scanOffset);
+    output[heightOffset] = static_cast<uint8_t>(height >> 8);
+    output[heightOffset + 1] = static_cast<uint8_t>(height);
+    unsigned nextRestart = 0;
+    for (int strip = 0; strip < strips; ++strip) {
+      if (strip > 0) {
+        output.push_back(0xFF);
+        output.push_back(static_cast<uint8_t>(0xD0 | (nextRestart++ & 7)));
+        if (!FindScan(jpegs[strip], scanOffset, heightOffset)) {
+          std::cerr << "JPEG encoding failed: no scan in strip" << std::endl;
+          return false;
+        }
+      }
+      AppendScan(jpegs[strip], scanOffset, nextRestart, output);
+      std::vector<uint8_t>().swap(jpegs[strip]);
+    }
+    output.push_back(0xFF);
+    output.push_back(0xD9);
+  }
+
+  std::ofstream file(filePath, std::ios::binary);
+  file.write(reinterpret_cast<const char*>(output.data()),
+             static_cast<std::streamsize>(output.size()));
+  return static_cast<bool>(file);
+}
@@ -0,0 +1,47 @@
+#ifndef JPEG_ENCODER_H_
+#define JPEG_ENCODER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Frames shorter than this are encoded in one strip
+#define JPEG_PARALLEL_MIN_ROWS 1080
+// Largest restart interval a DRI marker can hold, in blocks
+#define JPEG_MAX_RESTART_INTERVAL 65535
+
+enum class JpegSubsampling {
+  Yuv420,
+  Yuv422,
+  Yuv444,
+};
+
+struct JpegSettings {
+  // 1 to 100
+  int quality = 90;
+  JpegSubsampling subsampling = JpegSubsampling::Yuv420;
+  // Rows of blocks between restart markers, 0 for none (strips encoded in
+  // parallel are always separated by one)
+  int restartInterval = 0;
+};
+
+enum class JpegPixelFormat {
+  Gray,
+  Rgb,
+  Rgba,
+};
+
+// Writes `height` rows of `width` pixels, `bytesPerRow` apart, as a
+// baseline JPEG with libjpeg-turbo. The rows go straight to the encoder,
+// which converts them to YCbCr itself.
+//
+// With `stripCount` above 1, tall frames are cut into horizontal strips
+// encoded on their own threads and joined at restart markers, giving the
+// same file a single encode with those markers would. Returns false when
+// it cannot.
+bool WriteJpeg(const uint8_t* pixels, int width, int height,
+               size_t bytesPerRow, JpegPixelFormat format,
+               const JpegSettings& settings, size_t stripCount,
+               const std::string& filePath);
+
+#endif  // JPEG_ENCODER_H_
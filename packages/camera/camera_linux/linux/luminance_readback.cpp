@@ -0,0 +1,112 @@
+#include "luminance_readback.h"
+
+#include <algorithm>
+
+LuminanceReadback::LuminanceReadback(size_t depth) : m_entries(depth) {
+  for (Entry& entry : m_entries) {
+    glGenBuffers(1, &entry.buffer);
+  }
+  glGenFramebuffers(1, &m_fbo);
+}
+
+LuminanceReadback::~LuminanceReadback() {
+  for (Entry& entry : m_entries) {
+    if (entry.fence) {
+      glDeleteSync(entry.fence);
+    }
+    glDeleteBuffers(1, &entry.buffer);
+  }
+  glDeleteFramebuffers(1, &m_fbo);
+}
+
+bool LuminanceReadback::Request(GLuint textureArray, GLint layer,
+                                GLsizei width, GLsizei height,
+                                GLsizei levelCount, GLenum format,
+                                size_t slot, double exposureUs) {
+  if (m_in_flight == m_entries.size() || levelCount < 1) {
+    return false;
+  }
+
+  GLint level = 0;
+  while (level + 1 < levelCount &&
+         std::max(width >> level, height >> level) >
+             LUMINANCE_READBACK_MAX_SIZE) {
+    ++level;
+  }
+
+  Entry& entry = m_entries[(m_head + m_in_flight) % m_entries.size()];
+  entry.width = std::max(1, width >> level);
+  entry.height = std::max(1, height >> level);
+  entry.mono = format == GL_R8 || format == GL_R16F;
+  entry.floatingPoint = format == GL_R16F || format == GL_RGBA16F;
+  entry.slot = slot;
+  entry.exposureUs = exposureUs;
+
+  // RGBA / UNSIGNED_BYTE is the one read format every ES 3 context takes
+  // for normalized attachments, RGBA / FLOAT for floating-point ones.
+  const size_t size = static_cast<size_t>(entry.width) * entry.height * 4 *
+                      (entry.floatingPoint ? sizeof(float) : 1);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, entry.buffer);
+  if (entry.capacity < size) {
+    glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+    entry.capacity = size;
+  }
+
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, m_fbo);
+  glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                            textureArray, level, layer);
+  glReadPixels(0, 0, entry.width, entry.height, GL_RGBA,
+               entry.floatingPoint ? GL_FLOAT : GL_UNSIGNED_BYTE, nullptr);
+  glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, 0, 0,
+                            0);
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+  entry.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  ++m_in_flight;
+  return true;
+}
+
+bool LuminanceReadback::Poll(Result& result) {
+  if (m_in_flight == 0) {
+    return false;
+  }
+  Entry& entry = m_entries[m_head];
+  const GLenum status = glClientWaitSync(entry.fence, 0, 0);
+  if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+    return false;
+  }
+  glDeleteSync(entry.fence);
+  entry.fence = nullptr;
+  m_head = (m_head + 1) % m_entries.size();
+  --m_in_flight;
+
+  const size_t count = static_cast<size_t>(entry.width) * entry.height * 4;
+  const size_t size = count * (entry.floatingPoint ? sizeof(float) : 1);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, entry.buffer);
+  const void* mapped =
+      glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+  if (!mapped) {
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    return false;
+  }
+  const uint8_t* pixels = static_cast<const uint8_t*>(mapped);
+  if (entry.floatingPoint) {
+    const float* values = static_cast<const float*>(mapped);
+    m_converted.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+      m_converted[i] = static_cast<uint8_t>(
+          std::clamp(values[i], 0.0f, 1.0f) * 255.0f + 0.5f);
+    }
+    pixels = m_converted.data();
+  }
+  result.histogram = LuminanceHistogram();
+  result.histogram.Accumulate(pixels, entry.width, entry.height,
+                              static_cast<size_t>(entry.width) * 4,
+                              entry.mono);
+  result.slot = entry.slot;
+  result.exposureUs = entry.exposureUs;
+  glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  return true;
+}
@@ -0,0 +1,71 @@
+#ifndef LUMINANCE_READBACK_H_
+#define LUMINANCE_READBACK_H_
+
+#include <GLES3/gl3.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "auto_exposure_controller.h"
+
+#define LUMINANCE_READBACK_DEPTH 3
+// Largest side of the mip level that is read back
+#define LUMINANCE_READBACK_MAX_SIZE 256
+
+// Asynchronous luminance metering of exposure array layers.
+//
+// Reads a small mip level of a layer into a pack PBO behind a fence and
+// builds its histogram once the GPU is done, a frame or two later, so
+// metering never waits on the GPU. The mips must be current when Request()
+// is called.
+//
+// All methods must be called with the rendering GL context current.
+class LuminanceReadback {
+ public:
+  struct Result {
+    LuminanceHistogram histogram;
+    size_t slot = 0;
+    double exposureUs = 0.0;
+  };
+
+  explicit LuminanceReadback(size_t depth);
+  ~LuminanceReadback();
+
+  LuminanceReadback(const LuminanceReadback&) = delete;
+  LuminanceReadback& operator=(const LuminanceReadback&) = delete;
+
+  // Queues a read of `layer` of an array of internal `format`, tagged with
+  // the bracket slot and exposure it was shot at. Returns false when every
+  // buffer is still in flight.
+  bool Request(GLuint textureArray, GLint layer, GLsizei width,
+               GLsizei height, GLsizei levelCount, GLenum format, size_t slot,
+               double exposureUs);
+
+  // Returns the oldest finished read, if any, without blocking.
+  bool Poll(Result& result);
+
+ private:
+  struct Entry {
+    GLuint buffer = 0;
+    size_t capacity = 0;
+    GLsync fence = nullptr;
+    GLsizei width = 0;
+    GLsizei height = 0;
+    bool mono = false;
+    // Half-float layers are read back as floats.
+    bool floatingPoint = false;
+    size_t slot = 0;
+    double exposureUs = 0.0;
+  };
+
+  std::vector<Entry> m_entries;
+  // Oldest entry in flight and number in flight
+  size_t m_head = 0;
+  size_t m_in_flight = 0;
+  GLuint m_fbo = 0;
+  // 8-bit copy of a floating-point read
+  std::vector<uint8_t> m_converted;
+};
+
+#endif  // LUMINANCE_READBACK_H_
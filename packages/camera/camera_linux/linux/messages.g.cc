@@ -120,7 +120,7 @@ gboolean camera_linux_platform_camera_state_get_focus_point_supported(CameraLinu
 
 static FlValue* camera_linux_platform_camera_state_to_list(CameraLinuxPlatformCameraState* self) {
   FlValue* values = fl_value_new_list();
-  fl_value_append_take(values, fl_value_new_custom_object(135, G_OBJECT(self->preview_size)));
+  fl_value_append_take(values, fl_value_new_custom_object(140, G_OBJECT(self->preview_size)));
   fl_value_append_take(values, fl_value_new_custom(130, fl_value_new_int(self->exposure_mode), (GDestroyNotify)fl_value_unref));
   fl_value_append_take(values, fl_value_new_custom(132, fl_value_new_int(self->focus_mode), (GDestroyNotify)fl_value_unref));
   fl_value_append_take(values, fl_value_new_bool(self->exposure_point_supported));
@@ -194,6 +194,61 @@ static CameraLinuxPlatformPoint* camera_linux_platform_point_new_from_list(FlVal
   return camera_linux_platform_point_new(x, y);
 }
 
+struct _CameraLinuxPlatformBurstResult {
+  GObject parent_instance;
+
+  FlValue* paths;
+  FlValue* timestamps_us;
+};
+
+G_DEFINE_TYPE(CameraLinuxPlatformBurstResult, camera_linux_platform_burst_result, G_TYPE_OBJECT)
+
+static void camera_linux_platform_burst_result_dispose(GObject* object) {
+  CameraLinuxPlatformBurstResult* self = CAMERA_LINUX_PLATFORM_BURST_RESULT(object);
+  g_clear_pointer(&self->paths, fl_value_unref);
+  g_clear_pointer(&self->timestamps_us, fl_value_unref);
+  G_OBJECT_CLASS(camera_linux_platform_burst_result_parent_class)->dispose(object);
+}
+
+static void camera_linux_platform_burst_result_init(CameraLinuxPlatformBurstResult* self) {
+}
+
+static void camera_linux_platform_burst_result_class_init(CameraLinuxPlatformBurstResultClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_platform_burst_result_dispose;
+}
+
+CameraLinuxPlatformBurstResult* camera_linux_platform_burst_result_new(FlValue* paths, FlValue* timestamps_us) {
+  CameraLinuxPlatformBurstResult* self = CAMERA_LINUX_PLATFORM_BURST_RESULT(g_object_new(camera_linux_platform_burst_result_get_type(), nullptr));
+  self->paths = fl_value_ref(paths);
+  self->timestamps_us = fl_value_ref(timestamps_us);
+  return self;
+}
+
+FlValue* camera_linux_platform_burst_result_get_paths(CameraLinuxPlatformBurstResult* self) {
+  g_return_val_if_fail(CAMERA_LINUX_IS_PLATFORM_BURST_RESULT(self), nullptr);
+  return self->paths;
+}
+
+FlValue* camera_linux_platform_burst_result_get_timestamps_us(CameraLinuxPlatformBurstResult* self) {
+  g_return_val_if_fail(CAMERA_LINUX_IS_PLATFORM_BURST_RESULT(self), nullptr);
+  return self->timestamps_us;
+}
+
+static FlValue* camera_linux_platform_burst_result_to_list(CameraLinuxPlatformBurstResult* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, fl_value_ref(self->paths));
+  fl_value_append_take(values, fl_value_ref(self->timestamps_us));
+  return values;
+}
+
+static CameraLinuxPlatformBurstResult* camera_linux_platform_burst_result_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  FlValue* paths = value0;
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  FlValue* timestamps_us = value1;
+  return camera_linux_platform_burst_result_new(paths, timestamps_us);
+}
+
 struct _CameraLinuxMessageCodec {
   FlStandardMessageCodec parent_instance;
 
@@ -237,27 +292,64 @@ static gboolean camera_linux_message_codec_write_camera_linux_platform_resolutio
   return fl_standard_message_codec_write_value(codec, buffer, value, error);
 }
 
-static gboolean camera_linux_message_codec_write_camera_linux_platform_size(FlStandardMessageCodec* codec, GByteArray* buffer, CameraLinuxPlatformSize* value, GError** error) {
+static gboolean camera_linux_message_codec_write_camera_linux_platform_frame_queue_policy(FlStandardMessageCodec* codec, GByteArray* buffer, FlValue* value, GError** error) {
   uint8_t type = 135;
   g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  return fl_standard_message_codec_write_value(codec, buffer, value, error);
+}
+
+static gboolean camera_linux_message_codec_write_camera_linux_platform_tone_mapping_operator(FlStandardMessageCodec* codec, GByteArray* buffer, FlValue* value, GError** error) {
+  uint8_t type = 136;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  return fl_standard_message_codec_write_value(codec, buffer, value, error);
+}
+
+static gboolean camera_linux_message_codec_write_camera_linux_platform_demosaic_algorithm(FlStandardMessageCodec* codec, GByteArray* buffer, FlValue* value, GError** error) {
+  uint8_t type = 137;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  return fl_standard_message_codec_write_value(codec, buffer, value, error);
+}
+
+static gboolean camera_linux_message_codec_write_camera_linux_platform_render_format(FlStandardMessageCodec* codec, GByteArray* buffer, FlValue* value, GError** error) {
+  uint8_t type = 138;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  return fl_standard_message_codec_write_value(codec, buffer, value, error);
+}
+
+static gboolean camera_linux_message_codec_write_camera_linux_platform_jpeg_subsampling(FlStandardMessageCodec* codec, GByteArray* buffer, FlValue* value, GError** error) {
+  uint8_t type = 139;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  return fl_standard_message_codec_write_value(codec, buffer, value, error);
+}
+
+static gboolean camera_linux_message_codec_write_camera_linux_platform_size(FlStandardMessageCodec* codec, GByteArray* buffer, CameraLinuxPlatformSize* value, GError** error) {
+  uint8_t type = 140;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
   g_autoptr(FlValue) values = camera_linux_platform_size_to_list(value);
   return fl_standard_message_codec_write_value(codec, buffer, values, error);
 }
 
 static gboolean camera_linux_message_codec_write_camera_linux_platform_camera_state(FlStandardMessageCodec* codec, GByteArray* buffer, CameraLinuxPlatformCameraState* value, GError** error) {
-  uint8_t type = 136;
+  uint8_t type = 141;
   g_byte_array_append(buffer, &type, sizeof(uint8_t));
   g_autoptr(FlValue) values = camera_linux_platform_camera_state_to_list(value);
   return fl_standard_message_codec_write_value(codec, buffer, values, error);
 }
 
 static gboolean camera_linux_message_codec_write_camera_linux_platform_point(FlStandardMessageCodec* codec, GByteArray* buffer, CameraLinuxPlatformPoint* value, GError** error) {
-  uint8_t type = 137;
+  uint8_t type = 142;
   g_byte_array_append(buffer, &type, sizeof(uint8_t));
   g_autoptr(FlValue) values = camera_linux_platform_point_to_list(value);
   return fl_standard_message_codec_write_value(codec, buffer, values, error);
 }
 
+static gboolean camera_linux_message_codec_write_camera_linux_platform_burst_result(FlStandardMessageCodec* codec, GByteArray* buffer, CameraLinuxPlatformBurstResult* value, GError** error) {
+  uint8_t type = 142;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = camera_linux_platform_burst_result_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
 static gboolean camera_linux_message_codec_write_value(FlStandardMessageCodec* codec, GByteArray* buffer, FlValue* value, GError** error) {
   if (fl_value_get_type(value) == FL_VALUE_TYPE_CUSTOM) {
     switch (fl_value_get_custom_type(value)) {
@@ -274,11 +366,23 @@ static gboolean camera_linux_message_codec_write_value(FlStandardMessageCodec* c
       case 134:
         return camera_linux_message_codec_write_camera_linux_platform_resolution_preset(codec, buffer, reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value))), error);
       case 135:
-        return camera_linux_message_codec_write_camera_linux_platform_size(codec, buffer, CAMERA_LINUX_PLATFORM_SIZE(fl_value_get_custom_value_object(value)), error);
+        return camera_linux_message_codec_write_camera_linux_platform_frame_queue_policy(codec, buffer, reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value))), error);
       case 136:
-        return camera_linux_message_codec_write_camera_linux_platform_camera_state(codec, buffer, CAMERA_LINUX_PLATFORM_CAMERA_STATE(fl_value_get_custom_value_object(value)), error);
+        return camera_linux_message_codec_write_camera_linux_platform_tone_mapping_operator(codec, buffer, reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value))), error);
       case 137:
+        return camera_linux_message_codec_write_camera_linux_platform_demosaic_algorithm(codec, buffer, reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value))), error);
+      case 138:
+        return camera_linux_message_codec_write_camera_linux_platform_render_format(codec, buffer, reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value))), error);
+      case 139:
+        return camera_linux_message_codec_write_camera_linux_platform_jpeg_subsampling(codec, buffer, reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value))), error);
+      case 140:
+        return camera_linux_message_codec_write_camera_linux_platform_size(codec, buffer, CAMERA_LINUX_PLATFORM_SIZE(fl_value_get_custom_value_object(value)), error);
+      case 141:
+        return camera_linux_message_codec_write_camera_linux_platform_camera_state(codec, buffer, CAMERA_LINUX_PLATFORM_CAMERA_STATE(fl_value_get_custom_value_object(value)), error);
+      case 142:
         return camera_linux_message_codec_write_camera_linux_platform_point(codec, buffer, CAMERA_LINUX_PLATFORM_POINT(fl_value_get_custom_value_object(value)), error);
+      case 142:
+        return camera_linux_message_codec_write_camera_linux_platform_burst_result(codec, buffer, CAMERA_LINUX_PLATFORM_BURST_RESULT(fl_value_get_custom_value_object(value)), error);
     }
   }
 
@@ -309,6 +413,26 @@ static FlValue* camera_linux_message_codec_read_camera_linux_platform_resolution
   return fl_value_new_custom(134, fl_standard_message_codec_read_value(codec, buffer, offset, error), (GDestroyNotify)fl_value_unref);
 }
 
+static FlValue* camera_linux_message_codec_read_camera_linux_platform_frame_queue_policy(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  return fl_value_new_custom(135, fl_standard_message_codec_read_value(codec, buffer, offset, error), (GDestroyNotify)fl_value_unref);
+}
+
+static FlValue* camera_linux_message_codec_read_camera_linux_platform_tone_mapping_operator(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  return fl_value_new_custom(136, fl_standard_message_codec_read_value(codec, buffer, offset, error), (GDestroyNotify)fl_value_unref);
+}
+
+static FlValue* camera_linux_message_codec_read_camera_linux_platform_demosaic_algorithm(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  return fl_value_new_custom(137, fl_standard_message_codec_read_value(codec, buffer, offset, error), (GDestroyNotify)fl_value_unref);
+}
+
+static FlValue* camera_linux_message_codec_read_camera_linux_platform_render_format(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  return fl_value_new_custom(138, fl_standard_message_codec_read_value(codec, buffer, offset, error), (GDestroyNotify)fl_value_unref);
+}
+
+static FlValue* camera_linux_message_codec_read_camera_linux_platform_jpeg_subsampling(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  return fl_value_new_custom(139, fl_standard_message_codec_read_value(codec, buffer, offset, error), (GDestroyNotify)fl_value_unref);
+}
+
 static FlValue* camera_linux_message_codec_read_camera_linux_platform_size(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
   g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
   if (values == nullptr) {
@@ -321,7 +445,7 @@ static FlValue* camera_linux_message_codec_read_camera_linux_platform_size(FlSta
     return nullptr;
   }
 
-  return fl_value_new_custom_object(135, G_OBJECT(value));
+  return fl_value_new_custom_object(140, G_OBJECT(value));
 }
 
 static FlValue* camera_linux_message_codec_read_camera_linux_platform_camera_state(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
@@ -336,7 +460,7 @@ static FlValue* camera_linux_message_codec_read_camera_linux_platform_camera_sta
     return nullptr;
   }
 
-  return fl_value_new_custom_object(136, G_OBJECT(value));
+  return fl_value_new_custom_object(141, G_OBJECT(value));
 }
 
 static FlValue* camera_linux_message_codec_read_camera_linux_platform_point(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
@@ -351,7 +475,22 @@ static FlValue* camera_linux_message_codec_read_camera_linux_platform_point(FlSt
     return nullptr;
   }
 
-  return fl_value_new_custom_object(137, G_OBJECT(value));
+  return fl_value_new_custom_object(142, G_OBJECT(value));
+}
+
+static FlValue* camera_linux_message_codec_read_camera_linux_platform_burst_result(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(CameraLinuxPlatformBurstResult) value = camera_linux_platform_burst_result_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(142, G_OBJECT(value));
 }
 
 static FlValue* camera_linux_message_codec_read_value_of_type(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, int type, GError** error) {
@@ -369,11 +508,23 @@ static FlValue* camera_linux_message_codec_read_value_of_type(FlStandardMessageC
     case 134:
       return camera_linux_message_codec_read_camera_linux_platform_resolution_preset(codec, buffer, offset, error);
     case 135:
-      return camera_linux_message_codec_read_camera_linux_platform_size(codec, buffer, offset, error);
+      return camera_linux_message_codec_read_camera_linux_platform_frame_queue_policy(codec, buffer, offset, error);
     case 136:
-      return camera_linux_message_codec_read_camera_linux_platform_camera_state(codec, buffer, offset, error);
+      return camera_linux_message_codec_read_camera_linux_platform_tone_mapping_operator(codec, buffer, offset, error);
     case 137:
+      return camera_linux_message_codec_read_camera_linux_platform_demosaic_algorithm(codec, buffer, offset, error);
+    case 138:
+      return camera_linux_message_codec_read_camera_linux_platform_render_format(codec, buffer, offset, error);
+    case 139:
+      return camera_linux_message_codec_read_camera_linux_platform_jpeg_subsampling(codec, buffer, offset, error);
+    case 140:
+      return camera_linux_message_codec_read_camera_linux_platform_size(codec, buffer, offset, error);
+    case 141:
+      return camera_linux_message_codec_read_camera_linux_platform_camera_state(codec, buffer, offset, error);
+    case 142:
       return camera_linux_message_codec_read_camera_linux_platform_point(codec, buffer, offset, error);
+    case 142:
+      return camera_linux_message_codec_read_camera_linux_platform_burst_result(codec, buffer, offset, error);
     default:
       return FL_STANDARD_MESSAGE_CODEC_CLASS(camera_linux_message_codec_parent_class)->read_value_of_type(codec, buffer, offset, type, error);
   }
@@ -851,167 +1002,908 @@ static CameraLinuxCameraApiSetImageFormatGroupResponse* camera_linux_camera_api_
   return self;
 }
 
-struct _CameraLinuxCameraApi {
+G_DECLARE_FINAL_TYPE(CameraLinuxCameraApiSetGrabBufferCountResponse, camera_linux_camera_api_set_grab_buffer_count_response, CAMERA_LINUX, CAMERA_API_SET_GRAB_BUFFER_COUNT_RESPONSE, GObject)
+
+struct _CameraLinuxCameraApiSetGrabBufferCountResponse {
   GObject parent_instance;
 
-  const CameraLinuxCameraApiVTable* vtable;
-  gpointer user_data;
-  GDestroyNotify user_data_free_func;
+  FlValue* value;
 };
 
-G_DEFINE_TYPE(CameraLinuxCameraApi, camera_linux_camera_api, G_TYPE_OBJECT)
+G_DEFINE_TYPE(CameraLinuxCameraApiSetGrabBufferCountResponse, camera_linux_camera_api_set_grab_buffer_count_response, G_TYPE_OBJECT)
 
-static void camera_linux_camera_api_dispose(GObject* object) {
-  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(object);
-  if (self->user_data != nullptr) {
-    self->user_data_free_func(self->user_data);
-  }
-  self->user_data = nullptr;
-  G_OBJECT_CLASS(camera_linux_camera_api_parent_class)->dispose(object);
+static void camera_linux_camera_api_set_grab_buffer_count_response_dispose(GObject* object) {
+  CameraLinuxCameraApiSetGrabBufferCountResponse* self = CAMERA_LINUX_CAMERA_API_SET_GRAB_BUFFER_COUNT_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(camera_linux_camera_api_set_grab_buffer_count_response_parent_class)->dispose(object);
 }
 
-static void camera_linux_camera_api_init(CameraLinuxCameraApi* self) {
+static void camera_linux_camera_api_set_grab_buffer_count_response_init(CameraLinuxCameraApiSetGrabBufferCountResponse* self) {
 }
 
-static void camera_linux_camera_api_class_init(CameraLinuxCameraApiClass* klass) {
-  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_api_dispose;
+static void camera_linux_camera_api_set_grab_buffer_count_response_class_init(CameraLinuxCameraApiSetGrabBufferCountResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_api_set_grab_buffer_count_response_dispose;
 }
 
-static CameraLinuxCameraApi* camera_linux_camera_api_new(const CameraLinuxCameraApiVTable* vtable, gpointer user_data, GDestroyNotify user_data_free_func) {
-  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(g_object_new(camera_linux_camera_api_get_type(), nullptr));
-  self->vtable = vtable;
-  self->user_data = user_data;
-  self->user_data_free_func = user_data_free_func;
+static CameraLinuxCameraApiSetGrabBufferCountResponse* camera_linux_camera_api_set_grab_buffer_count_response_new() {
+  CameraLinuxCameraApiSetGrabBufferCountResponse* self = CAMERA_LINUX_CAMERA_API_SET_GRAB_BUFFER_COUNT_RESPONSE(g_object_new(camera_linux_camera_api_set_grab_buffer_count_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
   return self;
 }
 
-static void camera_linux_camera_api_get_available_cameras_names_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
-  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+static CameraLinuxCameraApiSetGrabBufferCountResponse* camera_linux_camera_api_set_grab_buffer_count_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  CameraLinuxCameraApiSetGrabBufferCountResponse* self = CAMERA_LINUX_CAMERA_API_SET_GRAB_BUFFER_COUNT_RESPONSE(g_object_new(camera_linux_camera_api_set_grab_buffer_count_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
 
-  if (self->vtable == nullptr || self->vtable->get_available_cameras_names == nullptr) {
-    return;
-  }
+G_DECLARE_FINAL_TYPE(CameraLinuxCameraApiSetUploadRingDepthResponse, camera_linux_camera_api_set_upload_ring_depth_response, CAMERA_LINUX, CAMERA_API_SET_UPLOAD_RING_DEPTH_RESPONSE, GObject)
 
-  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
-  self->vtable->get_available_cameras_names(handle, self->user_data);
-}
+struct _CameraLinuxCameraApiSetUploadRingDepthResponse {
+  GObject parent_instance;
 
-static void camera_linux_camera_api_create_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
-  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+  FlValue* value;
+};
 
-  if (self->vtable == nullptr || self->vtable->create == nullptr) {
-    return;
-  }
+G_DEFINE_TYPE(CameraLinuxCameraApiSetUploadRingDepthResponse, camera_linux_camera_api_set_upload_ring_depth_response, G_TYPE_OBJECT)
 
-  FlValue* value0 = fl_value_get_list_value(message_, 0);
-  const gchar* camera_name = fl_value_get_string(value0);
-  FlValue* value1 = fl_value_get_list_value(message_, 1);
-  CameraLinuxPlatformResolutionPreset resolution_preset = static_cast<CameraLinuxPlatformResolutionPreset>(fl_value_get_int(reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value1)))));
-  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
-  self->vtable->create(camera_name, resolution_preset, handle, self->user_data);
+static void camera_linux_camera_api_set_upload_ring_depth_response_dispose(GObject* object) {
+  CameraLinuxCameraApiSetUploadRingDepthResponse* self = CAMERA_LINUX_CAMERA_API_SET_UPLOAD_RING_DEPTH_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(camera_linux_camera_api_set_upload_ring_depth_response_parent_class)->dispose(object);
 }
 
-static void camera_linux_camera_api_initialize_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
-  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+static void camera_linux_camera_api_set_upload_ring_depth_response_init(CameraLinuxCameraApiSetUploadRingDepthResponse* self) {
+}
 
-  if (self->vtable == nullptr || self->vtable->initialize == nullptr) {
-    return;
-  }
+static void camera_linux_camera_api_set_upload_ring_depth_response_class_init(CameraLinuxCameraApiSetUploadRingDepthResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_api_set_upload_ring_depth_response_dispose;
+}
 
-  FlValue* value0 = fl_value_get_list_value(message_, 0);
-  int64_t camera_id = fl_value_get_int(value0);
-  FlValue* value1 = fl_value_get_list_value(message_, 1);
-  CameraLinuxPlatformImageFormatGroup image_format = static_cast<CameraLinuxPlatformImageFormatGroup>(fl_value_get_int(reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value1)))));
-  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
-  self->vtable->initialize(camera_id, image_format, handle, self->user_data);
+static CameraLinuxCameraApiSetUploadRingDepthResponse* camera_linux_camera_api_set_upload_ring_depth_response_new() {
+  CameraLinuxCameraApiSetUploadRingDepthResponse* self = CAMERA_LINUX_CAMERA_API_SET_UPLOAD_RING_DEPTH_RESPONSE(g_object_new(camera_linux_camera_api_set_upload_ring_depth_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
 }
 
-static void camera_linux_camera_api_get_texture_id_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
-  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+static CameraLinuxCameraApiSetUploadRingDepthResponse* camera_linux_camera_api_set_upload_ring_depth_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  CameraLinuxCameraApiSetUploadRingDepthResponse* self = CAMERA_LINUX_CAMERA_API_SET_UPLOAD_RING_DEPTH_RESPONSE(g_object_new(camera_linux_camera_api_set_upload_ring_depth_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
 
-  if (self->vtable == nullptr || self->vtable->get_texture_id == nullptr) {
-    return;
-  }
+G_DECLARE_FINAL_TYPE(CameraLinuxCameraApiSetFrameQueuePolicyResponse, camera_linux_camera_api_set_frame_queue_policy_response, CAMERA_LINUX, CAMERA_API_SET_FRAME_QUEUE_POLICY_RESPONSE, GObject)
 
-  FlValue* value0 = fl_value_get_list_value(message_, 0);
-  int64_t camera_id = fl_value_get_int(value0);
-  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
-  self->vtable->get_texture_id(camera_id, handle, self->user_data);
-}
+struct _CameraLinuxCameraApiSetFrameQueuePolicyResponse {
+  GObject parent_instance;
 
-static void camera_linux_camera_api_dispose_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
-  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+  FlValue* value;
+};
 
-  if (self->vtable == nullptr || self->vtable->dispose == nullptr) {
-    return;
-  }
+G_DEFINE_TYPE(CameraLinuxCameraApiSetFrameQueuePolicyResponse, camera_linux_camera_api_set_frame_queue_policy_response, G_TYPE_OBJECT)
 
-  FlValue* value0 = fl_value_get_list_value(message_, 0);
-  int64_t camera_id = fl_value_get_int(value0);
-  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
-  self->vtable->dispose(camera_id, handle, self->user_data);
+static void camera_linux_camera_api_set_frame_queue_policy_response_dispose(GObject* object) {
+  CameraLinuxCameraApiSetFrameQueuePolicyResponse* self = CAMERA_LINUX_CAMERA_API_SET_FRAME_QUEUE_POLICY_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(camera_linux_camera_api_set_frame_queue_policy_response_parent_class)->dispose(object);
 }
 
-static void camera_linux_camera_api_take_picture_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
-  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+static void camera_linux_camera_api_set_frame_queue_policy_response_init(CameraLinuxCameraApiSetFrameQueuePolicyResponse* self) {
+}
 
-  if (self->vtable == nullptr || self->vtable->take_picture == nullptr) {
-    return;
-  }
+static void camera_linux_camera_api_set_frame_queue_policy_response_class_init(CameraLinuxCameraApiSetFrameQueuePolicyResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_api_set_frame_queue_policy_response_dispose;
+}
 
-  FlValue* value0 = fl_value_get_list_value(message_, 0);
-  int64_t camera_id = fl_value_get_int(value0);
-  FlValue* value1 = fl_value_get_list_value(message_, 1);
-  const gchar* path = fl_value_get_string(value1);
-  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
-  self->vtable->take_picture(camera_id, path, handle, self->user_data);
+static CameraLinuxCameraApiSetFrameQueuePolicyResponse* camera_linux_camera_api_set_frame_queue_policy_response_new() {
+  CameraLinuxCameraApiSetFrameQueuePolicyResponse* self = CAMERA_LINUX_CAMERA_API_SET_FRAME_QUEUE_POLICY_RESPONSE(g_object_new(camera_linux_camera_api_set_frame_queue_policy_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
 }
 
-static void camera_linux_camera_api_start_video_recording_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
-  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+static CameraLinuxCameraApiSetFrameQueuePolicyResponse* camera_linux_camera_api_set_frame_queue_policy_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  CameraLinuxCameraApiSetFrameQueuePolicyResponse* self = CAMERA_LINUX_CAMERA_API_SET_FRAME_QUEUE_POLICY_RESPONSE(g_object_new(camera_linux_camera_api_set_frame_queue_policy_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
 
-  if (self->vtable == nullptr || self->vtable->start_video_recording == nullptr) {
-    return;
-  }
+G_DECLARE_FINAL_TYPE(CameraLinuxCameraApiSetExposureBracketResponse, camera_linux_camera_api_set_exposure_bracket_response, CAMERA_LINUX, CAMERA_API_SET_EXPOSURE_BRACKET_RESPONSE, GObject)
 
-  FlValue* value0 = fl_value_get_list_value(message_, 0);
-  int64_t camera_id = fl_value_get_int(value0);
-  FlValue* value1 = fl_value_get_list_value(message_, 1);
-  const gchar* path = fl_value_get_string(value1);
-  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
-  self->vtable->start_video_recording(camera_id, path, handle, self->user_data);
-}
+struct _CameraLinuxCameraApiSetExposureBracketResponse {
+  GObject parent_instance;
 
-static void camera_linux_camera_api_stop_video_recording_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
-  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+  FlValue* value;
+};
 
-  if (self->vtable == nullptr || self->vtable->stop_video_recording == nullptr) {
-    return;
-  }
+G_DEFINE_TYPE(CameraLinuxCameraApiSetExposureBracketResponse, camera_linux_camera_api_set_exposure_bracket_response, G_TYPE_OBJECT)
 
-  FlValue* value0 = fl_value_get_list_value(message_, 0);
-  int64_t camera_id = fl_value_get_int(value0);
-  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
-  self->vtable->stop_video_recording(camera_id, handle, self->user_data);
+static void camera_linux_camera_api_set_exposure_bracket_response_dispose(GObject* object) {
+  CameraLinuxCameraApiSetExposureBracketResponse* self = CAMERA_LINUX_CAMERA_API_SET_EXPOSURE_BRACKET_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(camera_linux_camera_api_set_exposure_bracket_response_parent_class)->dispose(object);
 }
 
-static void camera_linux_camera_api_set_exposure_mode_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
-  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+static void camera_linux_camera_api_set_exposure_bracket_response_init(CameraLinuxCameraApiSetExposureBracketResponse* self) {
+}
 
-  if (self->vtable == nullptr || self->vtable->set_exposure_mode == nullptr) {
-    return;
-  }
+static void camera_linux_camera_api_set_exposure_bracket_response_class_init(CameraLinuxCameraApiSetExposureBracketResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_api_set_exposure_bracket_response_dispose;
+}
 
-  FlValue* value0 = fl_value_get_list_value(message_, 0);
-  int64_t camera_id = fl_value_get_int(value0);
-  FlValue* value1 = fl_value_get_list_value(message_, 1);
-  CameraLinuxPlatformExposureMode mode = static_cast<CameraLinuxPlatformExposureMode>(fl_value_get_int(reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value1)))));
-  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
-  self->vtable->set_exposure_mode(camera_id, mode, handle, self->user_data);
+static CameraLinuxCameraApiSetExposureBracketResponse* camera_linux_camera_api_set_exposure_bracket_response_new() {
+  CameraLinuxCameraApiSetExposureBracketResponse* self = CAMERA_LINUX_CAMERA_API_SET_EXPOSURE_BRACKET_RESPONSE(g_object_new(camera_linux_camera_api_set_exposure_bracket_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
 }
 
-static void camera_linux_camera_api_set_focus_mode_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
-  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+static CameraLinuxCameraApiSetExposureBracketResponse* camera_linux_camera_api_set_exposure_bracket_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  CameraLinuxCameraApiSetExposureBracketResponse* self = CAMERA_LINUX_CAMERA_API_SET_EXPOSURE_BRACKET_RESPONSE(g_object_new(camera_linux_camera_api_set_exposure_bracket_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(CameraLinuxCameraApiSetToneMappingResponse, camera_linux_camera_api_set_tone_mapping_response, CAMERA_LINUX, CAMERA_API_SET_TONE_MAPPING_RESPONSE, GObject)
+
+struct _CameraLinuxCameraApiSetToneMappingResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(CameraLinuxCameraApiSetToneMappingResponse, camera_linux_camera_api_set_tone_mapping_response, G_TYPE_OBJECT)
+
+static void camera_linux_camera_api_set_tone_mapping_response_dispose(GObject* object) {
+  CameraLinuxCameraApiSetToneMappingResponse* self = CAMERA_LINUX_CAMERA_API_SET_TONE_MAPPING_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(camera_linux_camera_api_set_tone_mapping_response_parent_class)->dispose(object);
+}
+
+static void camera_linux_camera_api_set_tone_mapping_response_init(CameraLinuxCameraApiSetToneMappingResponse* self) {
+}
+
+static void camera_linux_camera_api_set_tone_mapping_response_class_init(CameraLinuxCameraApiSetToneMappingResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_api_set_tone_mapping_response_dispose;
+}
+
+static CameraLinuxCameraApiSetToneMappingResponse* camera_linux_camera_api_set_tone_mapping_response_new() {
+  CameraLinuxCameraApiSetToneMappingResponse* self = CAMERA_LINUX_CAMERA_API_SET_TONE_MAPPING_RESPONSE(g_object_new(camera_linux_camera_api_set_tone_mapping_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static CameraLinuxCameraApiSetToneMappingResponse* camera_linux_camera_api_set_tone_mapping_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  CameraLinuxCameraApiSetToneMappingResponse* self = CAMERA_LINUX_CAMERA_API_SET_TONE_MAPPING_RESPONSE(g_object_new(camera_linux_camera_api_set_tone_mapping_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(CameraLinuxCameraApiSetAutoExposureResponse, camera_linux_camera_api_set_auto_exposure_response, CAMERA_LINUX, CAMERA_API_SET_AUTO_EXPOSURE_RESPONSE, GObject)
+
+struct _CameraLinuxCameraApiSetAutoExposureResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(CameraLinuxCameraApiSetAutoExposureResponse, camera_linux_camera_api_set_auto_exposure_response, G_TYPE_OBJECT)
+
+static void camera_linux_camera_api_set_auto_exposure_response_dispose(GObject* object) {
+  CameraLinuxCameraApiSetAutoExposureResponse* self = CAMERA_LINUX_CAMERA_API_SET_AUTO_EXPOSURE_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(camera_linux_camera_api_set_auto_exposure_response_parent_class)->dispose(object);
+}
+
+static void camera_linux_camera_api_set_auto_exposure_response_init(CameraLinuxCameraApiSetAutoExposureResponse* self) {
+}
+
+static void camera_linux_camera_api_set_auto_exposure_response_class_init(CameraLinuxCameraApiSetAutoExposureResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_api_set_auto_exposure_response_dispose;
+}
+
+static CameraLinuxCameraApiSetAutoExposureResponse* camera_linux_camera_api_set_auto_exposure_response_new() {
+  CameraLinuxCameraApiSetAutoExposureResponse* self = CAMERA_LINUX_CAMERA_API_SET_AUTO_EXPOSURE_RESPONSE(g_object_new(camera_linux_camera_api_set_auto_exposure_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static CameraLinuxCameraApiSetAutoExposureResponse* camera_linux_camera_api_set_auto_exposure_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  CameraLinuxCameraApiSetAutoExposureResponse* self = CAMERA_LINUX_CAMERA_API_SET_AUTO_EXPOSURE_RESPONSE(g_object_new(camera_linux_camera_api_set_auto_exposure_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(CameraLinuxCameraApiSetDemosaicAlgorithmResponse, camera_linux_camera_api_set_demosaic_algorithm_response, CAMERA_LINUX, CAMERA_API_SET_DEMOSAIC_ALGORITHM_RESPONSE, GObject)
+
+struct _CameraLinuxCameraApiSetDemosaicAlgorithmResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(CameraLinuxCameraApiSetDemosaicAlgorithmResponse, camera_linux_camera_api_set_demosaic_algorithm_response, G_TYPE_OBJECT)
+
+static void camera_linux_camera_api_set_demosaic_algorithm_response_dispose(GObject* object) {
+  CameraLinuxCameraApiSetDemosaicAlgorithmResponse* self = CAMERA_LINUX_CAMERA_API_SET_DEMOSAIC_ALGORITHM_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(camera_linux_camera_api_set_demosaic_algorithm_response_parent_class)->dispose(object);
+}
+
+static void camera_linux_camera_api_set_demosaic_algorithm_response_init(CameraLinuxCameraApiSetDemosaicAlgorithmResponse* self) {
+}
+
+static void camera_linux_camera_api_set_demosaic_algorithm_response_class_init(CameraLinuxCameraApiSetDemosaicAlgorithmResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_api_set_demosaic_algorithm_response_dispose;
+}
+
+static CameraLinuxCameraApiSetDemosaicAlgorithmResponse* camera_linux_camera_api_set_demosaic_algorithm_response_new() {
+  CameraLinuxCameraApiSetDemosaicAlgorithmResponse* self = CAMERA_LINUX_CAMERA_API_SET_DEMOSAIC_ALGORITHM_RESPONSE(g_object_new(camera_linux_camera_api_set_demosaic_algorithm_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static CameraLinuxCameraApiSetDemosaicAlgorithmResponse* camera_linux_camera_api_set_demosaic_algorithm_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  CameraLinuxCameraApiSetDemosaicAlgorithmResponse* self = CAMERA_LINUX_CAMERA_API_SET_DEMOSAIC_ALGORITHM_RESPONSE(g_object_new(camera_linux_camera_api_set_demosaic_algorithm_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(CameraLinuxCameraApiSetRenderFormatsResponse, camera_linux_camera_api_set_render_formats_response, CAMERA_LINUX, CAMERA_API_SET_RENDER_FORMATS_RESPONSE, GObject)
+
+struct _CameraLinuxCameraApiSetRenderFormatsResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(CameraLinuxCameraApiSetRenderFormatsResponse, camera_linux_camera_api_set_render_formats_response, G_TYPE_OBJECT)
+
+static void camera_linux_camera_api_set_render_formats_response_dispose(GObject* object) {
+  CameraLinuxCameraApiSetRenderFormatsResponse* self = CAMERA_LINUX_CAMERA_API_SET_RENDER_FORMATS_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(camera_linux_camera_api_set_render_formats_response_parent_class)->dispose(object);
+}
+
+static void camera_linux_camera_api_set_render_formats_response_init(CameraLinuxCameraApiSetRenderFormatsResponse* self) {
+}
+
+static void camera_linux_camera_api_set_render_formats_response_class_init(CameraLinuxCameraApiSetRenderFormatsResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_api_set_render_formats_response_dispose;
+}
+
+static CameraLinuxCameraApiSetRenderFormatsResponse* camera_linux_camera_api_set_render_formats_response_new() {
+  CameraLinuxCameraApiSetRenderFormatsResponse* self = CAMERA_LINUX_CAMERA_API_SET_RENDER_FORMATS_RESPONSE(g_object_new(camera_linux_camera_api_set_render_formats_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static CameraLinuxCameraApiSetRenderFormatsResponse* camera_linux_camera_api_set_render_formats_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  CameraLinuxCameraApiSetRenderFormatsResponse* self = CAMERA_LINUX_CAMERA_API_SET_RENDER_FORMATS_RESPONSE(g_object_new(camera_linux_camera_api_set_render_formats_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(CameraLinuxCameraApiStartImageStreamResponse, camera_linux_camera_api_start_image_stream_response, CAMERA_LINUX, CAMERA_API_START_IMAGE_STREAM_RESPONSE, GObject)
+
+struct _CameraLinuxCameraApiStartImageStreamResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(CameraLinuxCameraApiStartImageStreamResponse, camera_linux_camera_api_start_image_stream_response, G_TYPE_OBJECT)
+
+static void camera_linux_camera_api_start_image_stream_response_dispose(GObject* object) {
+  CameraLinuxCameraApiStartImageStreamResponse* self = CAMERA_LINUX_CAMERA_API_START_IMAGE_STREAM_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(camera_linux_camera_api_start_image_stream_response_parent_class)->dispose(object);
+}
+
+static void camera_linux_camera_api_start_image_stream_response_init(CameraLinuxCameraApiStartImageStreamResponse* self) {
+}
+
+static void camera_linux_camera_api_start_image_stream_response_class_init(CameraLinuxCameraApiStartImageStreamResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_api_start_image_stream_response_dispose;
+}
+
+static CameraLinuxCameraApiStartImageStreamResponse* camera_linux_camera_api_start_image_stream_response_new() {
+  CameraLinuxCameraApiStartImageStreamResponse* self = CAMERA_LINUX_CAMERA_API_START_IMAGE_STREAM_RESPONSE(g_object_new(camera_linux_camera_api_start_image_stream_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static CameraLinuxCameraApiStartImageStreamResponse* camera_linux_camera_api_start_image_stream_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  CameraLinuxCameraApiStartImageStreamResponse* self = CAMERA_LINUX_CAMERA_API_START_IMAGE_STREAM_RESPONSE(g_object_new(camera_linux_camera_api_start_image_stream_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(CameraLinuxCameraApiStopImageStreamResponse, camera_linux_camera_api_stop_image_stream_response, CAMERA_LINUX, CAMERA_API_STOP_IMAGE_STREAM_RESPONSE, GObject)
+
+struct _CameraLinuxCameraApiStopImageStreamResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(CameraLinuxCameraApiStopImageStreamResponse, camera_linux_camera_api_stop_image_stream_response, G_TYPE_OBJECT)
+
+static void camera_linux_camera_api_stop_image_stream_response_dispose(GObject* object) {
+  CameraLinuxCameraApiStopImageStreamResponse* self = CAMERA_LINUX_CAMERA_API_STOP_IMAGE_STREAM_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(camera_linux_camera_api_stop_image_stream_response_parent_class)->dispose(object);
+}
+
+static void camera_linux_camera_api_stop_image_stream_response_init(CameraLinuxCameraApiStopImageStreamResponse* self) {
+}
+
+static void camera_linux_camera_api_stop_image_stream_response_class_init(CameraLinuxCameraApiStopImageStreamResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_api_stop_image_stream_response_dispose;
+}
+
+static CameraLinuxCameraApiStopImageStreamResponse* camera_linux_camera_api_stop_image_stream_response_new() {
+  CameraLinuxCameraApiStopImageStreamResponse* self = CAMERA_LINUX_CAMERA_API_STOP_IMAGE_STREAM_RESPONSE(g_object_new(camera_linux_camera_api_stop_image_stream_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static CameraLinuxCameraApiStopImageStreamResponse* camera_linux_camera_api_stop_image_stream_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  CameraLinuxCameraApiStopImageStreamResponse* self = CAMERA_LINUX_CAMERA_API_STOP_IMAGE_STREAM_RESPONSE(g_object_new(camera_linux_camera_api_stop_image_stream_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(CameraLinuxCameraApiReceivedImageStreamDataResponse, camera_linux_camera_api_received_image_stream_data_response, CAMERA_LINUX, CAMERA_API_RECEIVED_IMAGE_STREAM_DATA_RESPONSE, GObject)
+
+struct _CameraLinuxCameraApiReceivedImageStreamDataResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(CameraLinuxCameraApiReceivedImageStreamDataResponse, camera_linux_camera_api_received_image_stream_data_response, G_TYPE_OBJECT)
+
+static void camera_linux_camera_api_received_image_stream_data_response_dispose(GObject* object) {
+  CameraLinuxCameraApiReceivedImageStreamDataResponse* self = CAMERA_LINUX_CAMERA_API_RECEIVED_IMAGE_STREAM_DATA_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(camera_linux_camera_api_received_image_stream_data_response_parent_class)->dispose(object);
+}
+
+static void camera_linux_camera_api_received_image_stream_data_response_init(CameraLinuxCameraApiReceivedImageStreamDataResponse* self) {
+}
+
+static void camera_linux_camera_api_received_image_stream_data_response_class_init(CameraLinuxCameraApiReceivedImageStreamDataResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_api_received_image_stream_data_response_dispose;
+}
+
+static CameraLinuxCameraApiReceivedImageStreamDataResponse* camera_linux_camera_api_received_image_stream_data_response_new() {
+  CameraLinuxCameraApiReceivedImageStreamDataResponse* self = CAMERA_LINUX_CAMERA_API_RECEIVED_IMAGE_STREAM_DATA_RESPONSE(g_object_new(camera_linux_camera_api_received_image_stream_data_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static CameraLinuxCameraApiReceivedImageStreamDataResponse* camera_linux_camera_api_received_image_stream_data_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  CameraLinuxCameraApiReceivedImageStreamDataResponse* self = CAMERA_LINUX_CAMERA_API_RECEIVED_IMAGE_STREAM_DATA_RESPONSE(g_object_new(camera_linux_camera_api_received_image_stream_data_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(CameraLinuxCameraApiSetPreviewSizeResponse, camera_linux_camera_api_set_preview_size_response, CAMERA_LINUX, CAMERA_API_SET_PREVIEW_SIZE_RESPONSE, GObject)
+
+struct _CameraLinuxCameraApiSetPreviewSizeResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(CameraLinuxCameraApiSetPreviewSizeResponse, camera_linux_camera_api_set_preview_size_response, G_TYPE_OBJECT)
+
+static void camera_linux_camera_api_set_preview_size_response_dispose(GObject* object) {
+  CameraLinuxCameraApiSetPreviewSizeResponse* self = CAMERA_LINUX_CAMERA_API_SET_PREVIEW_SIZE_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(camera_linux_camera_api_set_preview_size_response_parent_class)->dispose(object);
+}
+
+static void camera_linux_camera_api_set_preview_size_response_init(CameraLinuxCameraApiSetPreviewSizeResponse* self) {
+}
+
+static void camera_linux_camera_api_set_preview_size_response_class_init(CameraLinuxCameraApiSetPreviewSizeResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_api_set_preview_size_response_dispose;
+}
+
+static CameraLinuxCameraApiSetPreviewSizeResponse* camera_linux_camera_api_set_preview_size_response_new() {
+  CameraLinuxCameraApiSetPreviewSizeResponse* self = CAMERA_LINUX_CAMERA_API_SET_PREVIEW_SIZE_RESPONSE(g_object_new(camera_linux_camera_api_set_preview_size_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static CameraLinuxCameraApiSetPreviewSizeResponse* camera_linux_camera_api_set_preview_size_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  CameraLinuxCameraApiSetPreviewSizeResponse* self = CAMERA_LINUX_CAMERA_API_SET_PREVIEW_SIZE_RESPONSE(g_object_new(camera_linux_camera_api_set_preview_size_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(CameraLinuxCameraApiSetZeroShutterLagResponse, camera_linux_camera_api_set_zero_shutter_lag_response, CAMERA_LINUX, CAMERA_API_SET_ZERO_SHUTTER_LAG_RESPONSE, GObject)
+
+struct _CameraLinuxCameraApiSetZeroShutterLagResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(CameraLinuxCameraApiSetZeroShutterLagResponse, camera_linux_camera_api_set_zero_shutter_lag_response, G_TYPE_OBJECT)
+
+static void camera_linux_camera_api_set_zero_shutter_lag_response_dispose(GObject* object) {
+  CameraLinuxCameraApiSetZeroShutterLagResponse* self = CAMERA_LINUX_CAMERA_API_SET_ZERO_SHUTTER_LAG_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(camera_linux_camera_api_set_zero_shutter_lag_response_parent_class)->dispose(object);
+}
+
+static void camera_linux_camera_api_set_zero_shutter_lag_response_init(CameraLinuxCameraApiSetZeroShutterLagResponse* self) {
+}
+
+static void camera_linux_camera_api_set_zero_shutter_lag_response_class_init(CameraLinuxCameraApiSetZeroShutterLagResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_api_set_zero_shutter_lag_response_dispose;
+}
+
+static CameraLinuxCameraApiSetZeroShutterLagResponse* camera_linux_camera_api_set_zero_shutter_lag_response_new() {
+  CameraLinuxCameraApiSetZeroShutterLagResponse* self = CAMERA_LINUX_CAMERA_API_SET_ZERO_SHUTTER_LAG_RESPONSE(g_object_new(camera_linux_camera_api_set_zero_shutter_lag_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static CameraLinuxCameraApiSetZeroShutterLagResponse* camera_linux_camera_api_set_zero_shutter_lag_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  CameraLinuxCameraApiSetZeroShutterLagResponse* self = CAMERA_LINUX_CAMERA_API_SET_ZERO_SHUTTER_LAG_RESPONSE(g_object_new(camera_linux_camera_api_set_zero_shutter_lag_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(CameraLinuxCameraApiTakeBurstResponse, camera_linux_camera_api_take_burst_response, CAMERA_LINUX, CAMERA_API_TAKE_BURST_RESPONSE, GObject)
+
+struct _CameraLinuxCameraApiTakeBurstResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(CameraLinuxCameraApiTakeBurstResponse, camera_linux_camera_api_take_burst_response, G_TYPE_OBJECT)
+
+static void camera_linux_camera_api_take_burst_response_dispose(GObject* object) {
+  CameraLinuxCameraApiTakeBurstResponse* self = CAMERA_LINUX_CAMERA_API_TAKE_BURST_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(camera_linux_camera_api_take_burst_response_parent_class)->dispose(object);
+}
+
+static void camera_linux_camera_api_take_burst_response_init(CameraLinuxCameraApiTakeBurstResponse* self) {
+}
+
+static void camera_linux_camera_api_take_burst_response_class_init(CameraLinuxCameraApiTakeBurstResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_api_take_burst_response_dispose;
+}
+
+static CameraLinuxCameraApiTakeBurstResponse* camera_linux_camera_api_take_burst_response_new(CameraLinuxPlatformBurstResult* return_value) {
+  CameraLinuxCameraApiTakeBurstResponse* self = CAMERA_LINUX_CAMERA_API_TAKE_BURST_RESPONSE(g_object_new(camera_linux_camera_api_take_burst_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_custom_object(142, G_OBJECT(return_value)));
+  return self;
+}
+
+static CameraLinuxCameraApiTakeBurstResponse* camera_linux_camera_api_take_burst_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  CameraLinuxCameraApiTakeBurstResponse* self = CAMERA_LINUX_CAMERA_API_TAKE_BURST_RESPONSE(g_object_new(camera_linux_camera_api_take_burst_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(CameraLinuxCameraApiSetJpegSettingsResponse, camera_linux_camera_api_set_jpeg_settings_response, CAMERA_LINUX, CAMERA_API_SET_JPEG_SETTINGS_RESPONSE, GObject)
+
+struct _CameraLinuxCameraApiSetJpegSettingsResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(CameraLinuxCameraApiSetJpegSettingsResponse, camera_linux_camera_api_set_jpeg_settings_response, G_TYPE_OBJECT)
+
+static void camera_linux_camera_api_set_jpeg_settings_response_dispose(GObject* object) {
+  CameraLinuxCameraApiSetJpegSettingsResponse* self = CAMERA_LINUX_CAMERA_API_SET_JPEG_SETTINGS_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(camera_linux_camera_api_set_jpeg_settings_response_parent_class)->dispose(object);
+}
+
+static void camera_linux_camera_api_set_jpeg_settings_response_init(CameraLinuxCameraApiSetJpegSettingsResponse* self) {
+}
+
+static void camera_linux_camera_api_set_jpeg_settings_response_class_init(CameraLinuxCameraApiSetJpegSettingsResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_api_set_jpeg_settings_response_dispose;
+}
+
+static CameraLinuxCameraApiSetJpegSettingsResponse* camera_linux_camera_api_set_jpeg_settings_response_new() {
+  CameraLinuxCameraApiSetJpegSettingsResponse* self = CAMERA_LINUX_CAMERA_API_SET_JPEG_SETTINGS_RESPONSE(g_object_new(camera_linux_camera_api_set_jpeg_settings_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static CameraLinuxCameraApiSetJpegSettingsResponse* camera_linux_camera_api_set_jpeg_settings_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  CameraLinuxCameraApiSetJpegSettingsResponse* self = CAMERA_LINUX_CAMERA_API_SET_JPEG_SETTINGS_RESPONSE(g_object_new(camera_linux_camera_api_set_jpeg_settings_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(CameraLinuxCameraApiSetVideoRecordingSettingsResponse, camera_linux_camera_api_set_video_recording_settings_response, CAMERA_LINUX, CAMERA_API_SET_VIDEO_RECORDING_SETTINGS_RESPONSE, GObject)
+
+struct _CameraLinuxCameraApiSetVideoRecordingSettingsResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(CameraLinuxCameraApiSetVideoRecordingSettingsResponse, camera_linux_camera_api_set_video_recording_settings_response, G_TYPE_OBJECT)
+
+static void camera_linux_camera_api_set_video_recording_settings_response_dispose(GObject* object) {
+  CameraLinuxCameraApiSetVideoRecordingSettingsResponse* self = CAMERA_LINUX_CAMERA_API_SET_VIDEO_RECORDING_SETTINGS_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(camera_linux_camera_api_set_video_recording_settings_response_parent_class)->dispose(object);
+}
+
+static void camera_linux_camera_api_set_video_recording_settings_response_init(CameraLinuxCameraApiSetVideoRecordingSettingsResponse* self) {
+}
+
+static void camera_linux_camera_api_set_video_recording_settings_response_class_init(CameraLinuxCameraApiSetVideoRecordingSettingsResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_api_set_video_recording_settings_response_dispose;
+}
+
+static CameraLinuxCameraApiSetVideoRecordingSettingsResponse* camera_linux_camera_api_set_video_recording_settings_response_new() {
+  CameraLinuxCameraApiSetVideoRecordingSettingsResponse* self = CAMERA_LINUX_CAMERA_API_SET_VIDEO_RECORDING_SETTINGS_RESPONSE(g_object_new(camera_linux_camera_api_set_video_recording_settings_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static CameraLinuxCameraApiSetVideoRecordingSettingsResponse* camera_linux_camera_api_set_video_recording_settings_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  CameraLinuxCameraApiSetVideoRecordingSettingsResponse* self = CAMERA_LINUX_CAMERA_API_SET_VIDEO_RECORDING_SETTINGS_RESPONSE(g_object_new(camera_linux_camera_api_set_video_recording_settings_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(CameraLinuxCameraApiSetVideoRecordingSourceResponse, camera_linux_camera_api_set_video_recording_source_response, CAMERA_LINUX, CAMERA_API_SET_VIDEO_RECORDING_SOURCE_RESPONSE, GObject)
+
+struct _CameraLinuxCameraApiSetVideoRecordingSourceResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(CameraLinuxCameraApiSetVideoRecordingSourceResponse, camera_linux_camera_api_set_video_recording_source_response, G_TYPE_OBJECT)
+
+static void camera_linux_camera_api_set_video_recording_source_response_dispose(GObject* object) {
+  CameraLinuxCameraApiSetVideoRecordingSourceResponse* self = CAMERA_LINUX_CAMERA_API_SET_VIDEO_RECORDING_SOURCE_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(camera_linux_camera_api_set_video_recording_source_response_parent_class)->dispose(object);
+}
+
+static void camera_linux_camera_api_set_video_recording_source_response_init(CameraLinuxCameraApiSetVideoRecordingSourceResponse* self) {
+}
+
+static void camera_linux_camera_api_set_video_recording_source_response_class_init(CameraLinuxCameraApiSetVideoRecordingSourceResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_api_set_video_recording_source_response_dispose;
+}
+
+static CameraLinuxCameraApiSetVideoRecordingSourceResponse* camera_linux_camera_api_set_video_recording_source_response_new() {
+  CameraLinuxCameraApiSetVideoRecordingSourceResponse* self = CAMERA_LINUX_CAMERA_API_SET_VIDEO_RECORDING_SOURCE_RESPONSE(g_object_new(camera_linux_camera_api_set_video_recording_source_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static CameraLinuxCameraApiSetVideoRecordingSourceResponse* camera_linux_camera_api_set_video_recording_source_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  CameraLinuxCameraApiSetVideoRecordingSourceResponse* self = CAMERA_LINUX_CAMERA_API_SET_VIDEO_RECORDING_SOURCE_RESPONSE(g_object_new(camera_linux_camera_api_set_video_recording_source_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(CameraLinuxCameraApiStartRawRecordingResponse, camera_linux_camera_api_start_raw_recording_response, CAMERA_LINUX, CAMERA_API_START_RAW_RECORDING_RESPONSE, GObject)
+
+struct _CameraLinuxCameraApiStartRawRecordingResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(CameraLinuxCameraApiStartRawRecordingResponse, camera_linux_camera_api_start_raw_recording_response, G_TYPE_OBJECT)
+
+static void camera_linux_camera_api_start_raw_recording_response_dispose(GObject* object) {
+  CameraLinuxCameraApiStartRawRecordingResponse* self = CAMERA_LINUX_CAMERA_API_START_RAW_RECORDING_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(camera_linux_camera_api_start_raw_recording_response_parent_class)->dispose(object);
+}
+
+static void camera_linux_camera_api_start_raw_recording_response_init(CameraLinuxCameraApiStartRawRecordingResponse* self) {
+}
+
+static void camera_linux_camera_api_start_raw_recording_response_class_init(CameraLinuxCameraApiStartRawRecordingResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_api_start_raw_recording_response_dispose;
+}
+
+static CameraLinuxCameraApiStartRawRecordingResponse* camera_linux_camera_api_start_raw_recording_response_new() {
+  CameraLinuxCameraApiStartRawRecordingResponse* self = CAMERA_LINUX_CAMERA_API_START_RAW_RECORDING_RESPONSE(g_object_new(camera_linux_camera_api_start_raw_recording_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static CameraLinuxCameraApiStartRawRecordingResponse* camera_linux_camera_api_start_raw_recording_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  CameraLinuxCameraApiStartRawRecordingResponse* self = CAMERA_LINUX_CAMERA_API_START_RAW_RECORDING_RESPONSE(g_object_new(camera_linux_camera_api_start_raw_recording_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(CameraLinuxCameraApiStopRawRecordingResponse, camera_linux_camera_api_stop_raw_recording_response, CAMERA_LINUX, CAMERA_API_STOP_RAW_RECORDING_RESPONSE, GObject)
+
+struct _CameraLinuxCameraApiStopRawRecordingResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(CameraLinuxCameraApiStopRawRecordingResponse, camera_linux_camera_api_stop_raw_recording_response, G_TYPE_OBJECT)
+
+static void camera_linux_camera_api_stop_raw_recording_response_dispose(GObject* object) {
+  CameraLinuxCameraApiStopRawRecordingResponse* self = CAMERA_LINUX_CAMERA_API_STOP_RAW_RECORDING_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(camera_linux_camera_api_stop_raw_recording_response_parent_class)->dispose(object);
+}
+
+static void camera_linux_camera_api_stop_raw_recording_response_init(CameraLinuxCameraApiStopRawRecordingResponse* self) {
+}
+
+static void camera_linux_camera_api_stop_raw_recording_response_class_init(CameraLinuxCameraApiStopRawRecordingResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_api_stop_raw_recording_response_dispose;
+}
+
+static CameraLinuxCameraApiStopRawRecordingResponse* camera_linux_camera_api_stop_raw_recording_response_new(const gchar* return_value) {
+  CameraLinuxCameraApiStopRawRecordingResponse* self = CAMERA_LINUX_CAMERA_API_STOP_RAW_RECORDING_RESPONSE(g_object_new(camera_linux_camera_api_stop_raw_recording_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(return_value));
+  return self;
+}
+
+static CameraLinuxCameraApiStopRawRecordingResponse* camera_linux_camera_api_stop_raw_recording_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  CameraLinuxCameraApiStopRawRecordingResponse* self = CAMERA_LINUX_CAMERA_API_STOP_RAW_RECORDING_RESPONSE(g_object_new(camera_linux_camera_api_stop_raw_recording_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+struct _CameraLinuxCameraApi {
+  GObject parent_instance;
+
+  const CameraLinuxCameraApiVTable* vtable;
+  gpointer user_data;
+  GDestroyNotify user_data_free_func;
+};
+
+G_DEFINE_TYPE(CameraLinuxCameraApi, camera_linux_camera_api, G_TYPE_OBJECT)
+
+static void camera_linux_camera_api_dispose(GObject* object) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(object);
+  if (self->user_data != nullptr) {
+    self->user_data_free_func(self->user_data);
+  }
+  self->user_data = nullptr;
+  G_OBJECT_CLASS(camera_linux_camera_api_parent_class)->dispose(object);
+}
+
+static void camera_linux_camera_api_init(CameraLinuxCameraApi* self) {
+}
+
+static void camera_linux_camera_api_class_init(CameraLinuxCameraApiClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_api_dispose;
+}
+
+static CameraLinuxCameraApi* camera_linux_camera_api_new(const CameraLinuxCameraApiVTable* vtable, gpointer user_data, GDestroyNotify user_data_free_func) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(g_object_new(camera_linux_camera_api_get_type(), nullptr));
+  self->vtable = vtable;
+  self->user_data = user_data;
+  self->user_data_free_func = user_data_free_func;
+  return self;
+}
+
+static void camera_linux_camera_api_get_available_cameras_names_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->get_available_cameras_names == nullptr) {
+    return;
+  }
+
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->get_available_cameras_names(handle, self->user_data);
+}
+
+static void camera_linux_camera_api_create_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->create == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  const gchar* camera_name = fl_value_get_string(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  CameraLinuxPlatformResolutionPreset resolution_preset = static_cast<CameraLinuxPlatformResolutionPreset>(fl_value_get_int(reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value1)))));
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->create(camera_name, resolution_preset, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_initialize_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->initialize == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  CameraLinuxPlatformImageFormatGroup image_format = static_cast<CameraLinuxPlatformImageFormatGroup>(fl_value_get_int(reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value1)))));
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->initialize(camera_id, image_format, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_get_texture_id_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->get_texture_id == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->get_texture_id(camera_id, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_dispose_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->dispose == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->dispose(camera_id, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_take_picture_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->take_picture == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  const gchar* path = fl_value_get_string(value1);
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->take_picture(camera_id, path, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_start_video_recording_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->start_video_recording == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  const gchar* path = fl_value_get_string(value1);
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->start_video_recording(camera_id, path, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_stop_video_recording_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->stop_video_recording == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->stop_video_recording(camera_id, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_set_exposure_mode_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_exposure_mode == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  CameraLinuxPlatformExposureMode mode = static_cast<CameraLinuxPlatformExposureMode>(fl_value_get_int(reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value1)))));
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->set_exposure_mode(camera_id, mode, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_set_focus_mode_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
 
   if (self->vtable == nullptr || self->vtable->set_focus_mode == nullptr) {
     return;
@@ -1020,24 +1912,343 @@ static void camera_linux_camera_api_set_focus_mode_cb(FlBasicMessageChannel* cha
   FlValue* value0 = fl_value_get_list_value(message_, 0);
   int64_t camera_id = fl_value_get_int(value0);
   FlValue* value1 = fl_value_get_list_value(message_, 1);
-  CameraLinuxPlatformFocusMode mode = static_cast<CameraLinuxPlatformFocusMode>(fl_value_get_int(reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value1)))));
+  CameraLinuxPlatformFocusMode mode = static_cast<CameraLinuxPlatformFocusMode>(fl_value_get_int(reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value1)))));
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->set_focus_mode(camera_id, mode, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_set_image_format_group_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_image_format_group == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  CameraLinuxPlatformImageFormatGroup image_format_group = static_cast<CameraLinuxPlatformImageFormatGroup>(fl_value_get_int(reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value1)))));
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->set_image_format_group(camera_id, image_format_group, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_set_grab_buffer_count_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_grab_buffer_count == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  int64_t count = fl_value_get_int(value1);
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->set_grab_buffer_count(camera_id, count, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_set_upload_ring_depth_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_upload_ring_depth == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  int64_t depth = fl_value_get_int(value1);
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->set_upload_ring_depth(camera_id, depth, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_set_frame_queue_policy_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_frame_queue_policy == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  CameraLinuxPlatformFrameQueuePolicy policy = static_cast<CameraLinuxPlatformFrameQueuePolicy>(fl_value_get_int(reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value1)))));
+  FlValue* value2 = fl_value_get_list_value(message_, 2);
+  int64_t capacity = fl_value_get_int(value2);
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->set_frame_queue_policy(camera_id, policy, capacity, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_set_exposure_bracket_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_exposure_bracket == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  FlValue* exposures_us = value1;
+  FlValue* value2 = fl_value_get_list_value(message_, 2);
+  FlValue* gains = value2;
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->set_exposure_bracket(camera_id, exposures_us, gains, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_set_tone_mapping_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_tone_mapping == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  CameraLinuxPlatformToneMappingOperator tone_mapping_operator = static_cast<CameraLinuxPlatformToneMappingOperator>(fl_value_get_int(reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value1)))));
+  FlValue* value2 = fl_value_get_list_value(message_, 2);
+  double key = fl_value_get_float(value2);
+  FlValue* value3 = fl_value_get_list_value(message_, 3);
+  double adaptation_seconds = fl_value_get_float(value3);
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->set_tone_mapping(camera_id, tone_mapping_operator, key, adaptation_seconds, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_set_auto_exposure_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_auto_exposure == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  gboolean enabled = fl_value_get_bool(value1);
+  FlValue* value2 = fl_value_get_list_value(message_, 2);
+  double target_brightness = fl_value_get_float(value2);
+  FlValue* value3 = fl_value_get_list_value(message_, 3);
+  double overblown_threshold = fl_value_get_float(value3);
+  FlValue* value4 = fl_value_get_list_value(message_, 4);
+  double overblown_target_ratio = fl_value_get_float(value4);
+  FlValue* value5 = fl_value_get_list_value(message_, 5);
+  double controller_gain = fl_value_get_float(value5);
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->set_auto_exposure(camera_id, enabled, target_brightness, overblown_threshold, overblown_target_ratio, controller_gain, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_set_demosaic_algorithm_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_demosaic_algorithm == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  CameraLinuxPlatformDemosaicAlgorithm algorithm = static_cast<CameraLinuxPlatformDemosaicAlgorithm>(fl_value_get_int(reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value1)))));
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->set_demosaic_algorithm(camera_id, algorithm, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_set_render_formats_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_render_formats == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  CameraLinuxPlatformRenderFormat intermediate_format = static_cast<CameraLinuxPlatformRenderFormat>(fl_value_get_int(reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value1)))));
+  FlValue* value2 = fl_value_get_list_value(message_, 2);
+  CameraLinuxPlatformRenderFormat display_format = static_cast<CameraLinuxPlatformRenderFormat>(fl_value_get_int(reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value2)))));
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->set_render_formats(camera_id, intermediate_format, display_format, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_start_image_stream_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->start_image_stream == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  int64_t width = fl_value_get_int(value1);
+  FlValue* value2 = fl_value_get_list_value(message_, 2);
+  int64_t height = fl_value_get_int(value2);
+  FlValue* value3 = fl_value_get_list_value(message_, 3);
+  double max_frame_rate = fl_value_get_float(value3);
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->start_image_stream(camera_id, width, height, max_frame_rate, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_stop_image_stream_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->stop_image_stream == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->stop_image_stream(camera_id, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_received_image_stream_data_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->received_image_stream_data == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->received_image_stream_data(camera_id, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_set_preview_size_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_preview_size == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  int64_t width = fl_value_get_int(value1);
+  FlValue* value2 = fl_value_get_list_value(message_, 2);
+  int64_t height = fl_value_get_int(value2);
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->set_preview_size(camera_id, width, height, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_set_zero_shutter_lag_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_zero_shutter_lag == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  int64_t frame_count = fl_value_get_int(value1);
+  FlValue* value2 = fl_value_get_list_value(message_, 2);
+  gboolean raw_frames = fl_value_get_bool(value2);
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->set_zero_shutter_lag(camera_id, frame_count, raw_frames, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_take_burst_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->take_burst == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  int64_t count = fl_value_get_int(value1);
+  FlValue* value2 = fl_value_get_list_value(message_, 2);
+  const gchar* directory = fl_value_get_string(value2);
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->take_burst(camera_id, count, directory, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_set_jpeg_settings_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_jpeg_settings == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  int64_t quality = fl_value_get_int(value1);
+  FlValue* value2 = fl_value_get_list_value(message_, 2);
+  CameraLinuxPlatformJpegSubsampling subsampling = static_cast<CameraLinuxPlatformJpegSubsampling>(fl_value_get_int(reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value2)))));
+  FlValue* value3 = fl_value_get_list_value(message_, 3);
+  int64_t restart_interval = fl_value_get_int(value3);
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->set_jpeg_settings(camera_id, quality, subsampling, restart_interval, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_set_video_recording_settings_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_video_recording_settings == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  int64_t bitrate = fl_value_get_int(value1);
+  FlValue* value2 = fl_value_get_list_value(message_, 2);
+  int64_t key_frame_interval = fl_value_get_int(value2);
+  FlValue* value3 = fl_value_get_list_value(message_, 3);
+  const gchar* container = fl_value_get_string(value3);
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->set_video_recording_settings(camera_id, bitrate, key_frame_interval, container, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_set_video_recording_source_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_video_recording_source == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  gboolean processed_frames = fl_value_get_bool(value1);
+  FlValue* value2 = fl_value_get_list_value(message_, 2);
+  gboolean gpu_nv12 = fl_value_get_bool(value2);
+  g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
+  self->vtable->set_video_recording_source(camera_id, processed_frames, gpu_nv12, handle, self->user_data);
+}
+
+static void camera_linux_camera_api_start_raw_recording_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->start_raw_recording == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t camera_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  const gchar* file_path = fl_value_get_string(value1);
+  FlValue* value2 = fl_value_get_list_value(message_, 2);
+  int64_t max_frames = fl_value_get_int(value2);
   g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
-  self->vtable->set_focus_mode(camera_id, mode, handle, self->user_data);
+  self->vtable->start_raw_recording(camera_id, file_path, max_frames, handle, self->user_data);
 }
 
-static void camera_linux_camera_api_set_image_format_group_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+static void camera_linux_camera_api_stop_raw_recording_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
   CameraLinuxCameraApi* self = CAMERA_LINUX_CAMERA_API(user_data);
 
-  if (self->vtable == nullptr || self->vtable->set_image_format_group == nullptr) {
+  if (self->vtable == nullptr || self->vtable->stop_raw_recording == nullptr) {
     return;
   }
 
   FlValue* value0 = fl_value_get_list_value(message_, 0);
   int64_t camera_id = fl_value_get_int(value0);
-  FlValue* value1 = fl_value_get_list_value(message_, 1);
-  CameraLinuxPlatformImageFormatGroup image_format_group = static_cast<CameraLinuxPlatformImageFormatGroup>(fl_value_get_int(reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value1)))));
   g_autoptr(CameraLinuxCameraApiResponseHandle) handle = camera_linux_camera_api_response_handle_new(channel, response_handle);
-  self->vtable->set_image_format_group(camera_id, image_format_group, handle, self->user_data);
+  self->vtable->stop_raw_recording(camera_id, handle, self->user_data);
 }
 
 void camera_linux_camera_api_set_method_handlers(FlBinaryMessenger* messenger, const gchar* suffix, const CameraLinuxCameraApiVTable* vtable, gpointer user_data, GDestroyNotify user_data_free_func) {
@@ -1078,6 +2289,63 @@ void camera_linux_camera_api_set_method_handlers(FlBinaryMessenger* messenger, c
   g_autofree gchar* set_image_format_group_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setImageFormatGroup%s", dot_suffix);
   g_autoptr(FlBasicMessageChannel) set_image_format_group_channel = fl_basic_message_channel_new(messenger, set_image_format_group_channel_name, FL_MESSAGE_CODEC(codec));
   fl_basic_message_channel_set_message_handler(set_image_format_group_channel, camera_linux_camera_api_set_image_format_group_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* set_grab_buffer_count_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setGrabBufferCount%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_grab_buffer_count_channel = fl_basic_message_channel_new(messenger, set_grab_buffer_count_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_grab_buffer_count_channel, camera_linux_camera_api_set_grab_buffer_count_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* set_upload_ring_depth_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setUploadRingDepth%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_upload_ring_depth_channel = fl_basic_message_channel_new(messenger, set_upload_ring_depth_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_upload_ring_depth_channel, camera_linux_camera_api_set_upload_ring_depth_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* set_frame_queue_policy_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setFrameQueuePolicy%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_frame_queue_policy_channel = fl_basic_message_channel_new(messenger, set_frame_queue_policy_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_frame_queue_policy_channel, camera_linux_camera_api_set_frame_queue_policy_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* set_exposure_bracket_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setExposureBracket%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_exposure_bracket_channel = fl_basic_message_channel_new(messenger, set_exposure_bracket_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_exposure_bracket_channel, camera_linux_camera_api_set_exposure_bracket_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* set_tone_mapping_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setToneMapping%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_tone_mapping_channel = fl_basic_message_channel_new(messenger, set_tone_mapping_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_tone_mapping_channel, camera_linux_camera_api_set_tone_mapping_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* set_auto_exposure_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setAutoExposure%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_auto_exposure_channel = fl_basic_message_channel_new(messenger, set_auto_exposure_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_auto_exposure_channel, camera_linux_camera_api_set_auto_exposure_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* set_demosaic_algorithm_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setDemosaicAlgorithm%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_demosaic_algorithm_channel = fl_basic_message_channel_new(messenger, set_demosaic_algorithm_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_demosaic_algorithm_channel, camera_linux_camera_api_set_demosaic_algorithm_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* set_render_formats_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setRenderFormats%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_render_formats_channel = fl_basic_message_channel_new(messenger, set_render_formats_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_render_formats_channel, camera_linux_camera_api_set_render_formats_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* start_image_stream_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.startImageStream%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) start_image_stream_channel = fl_basic_message_channel_new(messenger, start_image_stream_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(start_image_stream_channel, camera_linux_camera_api_start_image_stream_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* stop_image_stream_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.stopImageStream%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) stop_image_stream_channel = fl_basic_message_channel_new(messenger, stop_image_stream_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(stop_image_stream_channel, camera_linux_camera_api_stop_image_stream_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* received_image_stream_data_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.receivedImageStreamData%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) received_image_stream_data_channel = fl_basic_message_channel_new(messenger, received_image_stream_data_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(received_image_stream_data_channel, camera_linux_camera_api_received_image_stream_data_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* set_preview_size_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setPreviewSize%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_preview_size_channel = fl_basic_message_channel_new(messenger, set_preview_size_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_preview_size_channel, camera_linux_camera_api_set_preview_size_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* set_zero_shutter_lag_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setZeroShutterLag%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_zero_shutter_lag_channel = fl_basic_message_channel_new(messenger, set_zero_shutter_lag_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_zero_shutter_lag_channel, camera_linux_camera_api_set_zero_shutter_lag_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* take_burst_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.takeBurst%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) take_burst_channel = fl_basic_message_channel_new(messenger, take_burst_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(take_burst_channel, camera_linux_camera_api_take_burst_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* set_jpeg_settings_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setJpegSettings%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_jpeg_settings_channel = fl_basic_message_channel_new(messenger, set_jpeg_settings_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_jpeg_settings_channel, camera_linux_camera_api_set_jpeg_settings_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* set_video_recording_settings_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setVideoRecordingSettings%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_video_recording_settings_channel = fl_basic_message_channel_new(messenger, set_video_recording_settings_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_video_recording_settings_channel, camera_linux_camera_api_set_video_recording_settings_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* set_video_recording_source_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setVideoRecordingSource%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_video_recording_source_channel = fl_basic_message_channel_new(messenger, set_video_recording_source_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_video_recording_source_channel, camera_linux_camera_api_set_video_recording_source_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* start_raw_recording_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.startRawRecording%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) start_raw_recording_channel = fl_basic_message_channel_new(messenger, start_raw_recording_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(start_raw_recording_channel, camera_linux_camera_api_start_raw_recording_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* stop_raw_recording_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.stopRawRecording%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) stop_raw_recording_channel = fl_basic_message_channel_new(messenger, stop_raw_recording_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(stop_raw_recording_channel, camera_linux_camera_api_stop_raw_recording_cb, g_object_ref(api_data), g_object_unref);
 }
 
 void camera_linux_camera_api_clear_method_handlers(FlBinaryMessenger* messenger, const gchar* suffix) {
@@ -1117,6 +2385,63 @@ void camera_linux_camera_api_clear_method_handlers(FlBinaryMessenger* messenger,
   g_autofree gchar* set_image_format_group_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setImageFormatGroup%s", dot_suffix);
   g_autoptr(FlBasicMessageChannel) set_image_format_group_channel = fl_basic_message_channel_new(messenger, set_image_format_group_channel_name, FL_MESSAGE_CODEC(codec));
   fl_basic_message_channel_set_message_handler(set_image_format_group_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* set_grab_buffer_count_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setGrabBufferCount%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_grab_buffer_count_channel = fl_basic_message_channel_new(messenger, set_grab_buffer_count_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_grab_buffer_count_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* set_upload_ring_depth_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setUploadRingDepth%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_upload_ring_depth_channel = fl_basic_message_channel_new(messenger, set_upload_ring_depth_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_upload_ring_depth_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* set_frame_queue_policy_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setFrameQueuePolicy%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_frame_queue_policy_channel = fl_basic_message_channel_new(messenger, set_frame_queue_policy_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_frame_queue_policy_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* set_exposure_bracket_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setExposureBracket%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_exposure_bracket_channel = fl_basic_message_channel_new(messenger, set_exposure_bracket_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_exposure_bracket_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* set_tone_mapping_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setToneMapping%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_tone_mapping_channel = fl_basic_message_channel_new(messenger, set_tone_mapping_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_tone_mapping_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* set_auto_exposure_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setAutoExposure%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_auto_exposure_channel = fl_basic_message_channel_new(messenger, set_auto_exposure_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_auto_exposure_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* set_demosaic_algorithm_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setDemosaicAlgorithm%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_demosaic_algorithm_channel = fl_basic_message_channel_new(messenger, set_demosaic_algorithm_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_demosaic_algorithm_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* set_render_formats_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setRenderFormats%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_render_formats_channel = fl_basic_message_channel_new(messenger, set_render_formats_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_render_formats_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* start_image_stream_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.startImageStream%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) start_image_stream_channel = fl_basic_message_channel_new(messenger, start_image_stream_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(start_image_stream_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* stop_image_stream_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.stopImageStream%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) stop_image_stream_channel = fl_basic_message_channel_new(messenger, stop_image_stream_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(stop_image_stream_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* received_image_stream_data_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.receivedImageStreamData%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) received_image_stream_data_channel = fl_basic_message_channel_new(messenger, received_image_stream_data_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(received_image_stream_data_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* set_preview_size_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setPreviewSize%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_preview_size_channel = fl_basic_message_channel_new(messenger, set_preview_size_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_preview_size_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* set_zero_shutter_lag_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setZeroShutterLag%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_zero_shutter_lag_channel = fl_basic_message_channel_new(messenger, set_zero_shutter_lag_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_zero_shutter_lag_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* take_burst_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.takeBurst%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) take_burst_channel = fl_basic_message_channel_new(messenger, take_burst_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(take_burst_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* set_jpeg_settings_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setJpegSettings%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_jpeg_settings_channel = fl_basic_message_channel_new(messenger, set_jpeg_settings_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_jpeg_settings_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* set_video_recording_settings_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setVideoRecordingSettings%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_video_recording_settings_channel = fl_basic_message_channel_new(messenger, set_video_recording_settings_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_video_recording_settings_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* set_video_recording_source_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.setVideoRecordingSource%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_video_recording_source_channel = fl_basic_message_channel_new(messenger, set_video_recording_source_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_video_recording_source_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* start_raw_recording_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.startRawRecording%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) start_raw_recording_channel = fl_basic_message_channel_new(messenger, start_raw_recording_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(start_raw_recording_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* stop_raw_recording_channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraApi.stopRawRecording%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) stop_raw_recording_channel = fl_basic_message_channel_new(messenger, stop_raw_recording_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(stop_raw_recording_channel, nullptr, nullptr, nullptr);
 }
 
 void camera_linux_camera_api_respond_get_available_cameras_names(CameraLinuxCameraApiResponseHandle* response_handle, FlValue* return_value) {
@@ -1295,6 +2620,310 @@ void camera_linux_camera_api_respond_error_set_image_format_group(CameraLinuxCam
   }
 }
 
+void camera_linux_camera_api_respond_set_grab_buffer_count(CameraLinuxCameraApiResponseHandle* response_handle) {
+  g_autoptr(CameraLinuxCameraApiSetGrabBufferCountResponse) response = camera_linux_camera_api_set_grab_buffer_count_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setGrabBufferCount", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_error_set_grab_buffer_count(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(CameraLinuxCameraApiSetGrabBufferCountResponse) response = camera_linux_camera_api_set_grab_buffer_count_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setGrabBufferCount", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_set_upload_ring_depth(CameraLinuxCameraApiResponseHandle* response_handle) {
+  g_autoptr(CameraLinuxCameraApiSetUploadRingDepthResponse) response = camera_linux_camera_api_set_upload_ring_depth_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setUploadRingDepth", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_error_set_upload_ring_depth(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(CameraLinuxCameraApiSetUploadRingDepthResponse) response = camera_linux_camera_api_set_upload_ring_depth_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setUploadRingDepth", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_set_frame_queue_policy(CameraLinuxCameraApiResponseHandle* response_handle) {
+  g_autoptr(CameraLinuxCameraApiSetFrameQueuePolicyResponse) response = camera_linux_camera_api_set_frame_queue_policy_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setFrameQueuePolicy", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_error_set_frame_queue_policy(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(CameraLinuxCameraApiSetFrameQueuePolicyResponse) response = camera_linux_camera_api_set_frame_queue_policy_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setFrameQueuePolicy", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_set_exposure_bracket(CameraLinuxCameraApiResponseHandle* response_handle) {
+  g_autoptr(CameraLinuxCameraApiSetExposureBracketResponse) response = camera_linux_camera_api_set_exposure_bracket_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setExposureBracket", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_error_set_exposure_bracket(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(CameraLinuxCameraApiSetExposureBracketResponse) response = camera_linux_camera_api_set_exposure_bracket_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setExposureBracket", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_set_tone_mapping(CameraLinuxCameraApiResponseHandle* response_handle) {
+  g_autoptr(CameraLinuxCameraApiSetToneMappingResponse) response = camera_linux_camera_api_set_tone_mapping_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setToneMapping", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_error_set_tone_mapping(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(CameraLinuxCameraApiSetToneMappingResponse) response = camera_linux_camera_api_set_tone_mapping_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setToneMapping", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_set_auto_exposure(CameraLinuxCameraApiResponseHandle* response_handle) {
+  g_autoptr(CameraLinuxCameraApiSetAutoExposureResponse) response = camera_linux_camera_api_set_auto_exposure_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setAutoExposure", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_error_set_auto_exposure(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(CameraLinuxCameraApiSetAutoExposureResponse) response = camera_linux_camera_api_set_auto_exposure_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setAutoExposure", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_set_demosaic_algorithm(CameraLinuxCameraApiResponseHandle* response_handle) {
+  g_autoptr(CameraLinuxCameraApiSetDemosaicAlgorithmResponse) response = camera_linux_camera_api_set_demosaic_algorithm_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setDemosaicAlgorithm", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_error_set_demosaic_algorithm(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(CameraLinuxCameraApiSetDemosaicAlgorithmResponse) response = camera_linux_camera_api_set_demosaic_algorithm_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setDemosaicAlgorithm", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_set_render_formats(CameraLinuxCameraApiResponseHandle* response_handle) {
+  g_autoptr(CameraLinuxCameraApiSetRenderFormatsResponse) response = camera_linux_camera_api_set_render_formats_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setRenderFormats", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_error_set_render_formats(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(CameraLinuxCameraApiSetRenderFormatsResponse) response = camera_linux_camera_api_set_render_formats_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setRenderFormats", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_start_image_stream(CameraLinuxCameraApiResponseHandle* response_handle) {
+  g_autoptr(CameraLinuxCameraApiStartImageStreamResponse) response = camera_linux_camera_api_start_image_stream_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "startImageStream", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_error_start_image_stream(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(CameraLinuxCameraApiStartImageStreamResponse) response = camera_linux_camera_api_start_image_stream_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "startImageStream", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_stop_image_stream(CameraLinuxCameraApiResponseHandle* response_handle) {
+  g_autoptr(CameraLinuxCameraApiStopImageStreamResponse) response = camera_linux_camera_api_stop_image_stream_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "stopImageStream", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_error_stop_image_stream(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(CameraLinuxCameraApiStopImageStreamResponse) response = camera_linux_camera_api_stop_image_stream_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "stopImageStream", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_received_image_stream_data(CameraLinuxCameraApiResponseHandle* response_handle) {
+  g_autoptr(CameraLinuxCameraApiReceivedImageStreamDataResponse) response = camera_linux_camera_api_received_image_stream_data_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "receivedImageStreamData", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_error_received_image_stream_data(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(CameraLinuxCameraApiReceivedImageStreamDataResponse) response = camera_linux_camera_api_received_image_stream_data_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "receivedImageStreamData", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_set_preview_size(CameraLinuxCameraApiResponseHandle* response_handle) {
+  g_autoptr(CameraLinuxCameraApiSetPreviewSizeResponse) response = camera_linux_camera_api_set_preview_size_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setPreviewSize", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_error_set_preview_size(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(CameraLinuxCameraApiSetPreviewSizeResponse) response = camera_linux_camera_api_set_preview_size_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setPreviewSize", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_set_zero_shutter_lag(CameraLinuxCameraApiResponseHandle* response_handle) {
+  g_autoptr(CameraLinuxCameraApiSetZeroShutterLagResponse) response = camera_linux_camera_api_set_zero_shutter_lag_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setZeroShutterLag", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_error_set_zero_shutter_lag(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(CameraLinuxCameraApiSetZeroShutterLagResponse) response = camera_linux_camera_api_set_zero_shutter_lag_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setZeroShutterLag", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_take_burst(CameraLinuxCameraApiResponseHandle* response_handle, CameraLinuxPlatformBurstResult* return_value) {
+  g_autoptr(CameraLinuxCameraApiTakeBurstResponse) response = camera_linux_camera_api_take_burst_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "takeBurst", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_error_take_burst(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(CameraLinuxCameraApiTakeBurstResponse) response = camera_linux_camera_api_take_burst_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "takeBurst", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_set_jpeg_settings(CameraLinuxCameraApiResponseHandle* response_handle) {
+  g_autoptr(CameraLinuxCameraApiSetJpegSettingsResponse) response = camera_linux_camera_api_set_jpeg_settings_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setJpegSettings", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_error_set_jpeg_settings(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(CameraLinuxCameraApiSetJpegSettingsResponse) response = camera_linux_camera_api_set_jpeg_settings_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setJpegSettings", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_set_video_recording_settings(CameraLinuxCameraApiResponseHandle* response_handle) {
+  g_autoptr(CameraLinuxCameraApiSetVideoRecordingSettingsResponse) response = camera_linux_camera_api_set_video_recording_settings_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setVideoRecordingSettings", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_error_set_video_recording_settings(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(CameraLinuxCameraApiSetVideoRecordingSettingsResponse) response = camera_linux_camera_api_set_video_recording_settings_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setVideoRecordingSettings", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_set_video_recording_source(CameraLinuxCameraApiResponseHandle* response_handle) {
+  g_autoptr(CameraLinuxCameraApiSetVideoRecordingSourceResponse) response = camera_linux_camera_api_set_video_recording_source_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setVideoRecordingSource", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_error_set_video_recording_source(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(CameraLinuxCameraApiSetVideoRecordingSourceResponse) response = camera_linux_camera_api_set_video_recording_source_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "setVideoRecordingSource", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_start_raw_recording(CameraLinuxCameraApiResponseHandle* response_handle) {
+  g_autoptr(CameraLinuxCameraApiStartRawRecordingResponse) response = camera_linux_camera_api_start_raw_recording_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "startRawRecording", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_error_start_raw_recording(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(CameraLinuxCameraApiStartRawRecordingResponse) response = camera_linux_camera_api_start_raw_recording_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "startRawRecording", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_stop_raw_recording(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* return_value) {
+  g_autoptr(CameraLinuxCameraApiStopRawRecordingResponse) response = camera_linux_camera_api_stop_raw_recording_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "stopRawRecording", error->message);
+  }
+}
+
+void camera_linux_camera_api_respond_error_stop_raw_recording(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(CameraLinuxCameraApiStopRawRecordingResponse) response = camera_linux_camera_api_stop_raw_recording_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "CameraApi", "stopRawRecording", error->message);
+  }
+}
+
 struct _CameraLinuxCameraEventApi {
   GObject parent_instance;
 
@@ -1384,7 +3013,7 @@ static void camera_linux_camera_event_api_initialized_cb(GObject* object, GAsync
 
 void camera_linux_camera_event_api_initialized(CameraLinuxCameraEventApi* self, CameraLinuxPlatformCameraState* initial_state, GCancellable* cancellable, GAsyncReadyCallback callback, gpointer user_data) {
   g_autoptr(FlValue) args = fl_value_new_list();
-  fl_value_append_take(args, fl_value_new_custom_object(136, G_OBJECT(initial_state)));
+  fl_value_append_take(args, fl_value_new_custom_object(141, G_OBJECT(initial_state)));
   g_autofree gchar* channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraEventApi.initialized%s", self->suffix);
   g_autoptr(CameraLinuxMessageCodec) codec = camera_linux_message_codec_new();
   FlBasicMessageChannel* channel = fl_basic_message_channel_new(self->messenger, channel_name, FL_MESSAGE_CODEC(codec));
@@ -1483,6 +3112,89 @@ CameraLinuxCameraEventApiTextureIdResponse* camera_linux_camera_event_api_textur
   return camera_linux_camera_event_api_texture_id_response_new(response);
 }
 
+struct _CameraLinuxCameraEventApiImageStreamFrameResponse {
+  GObject parent_instance;
+
+  FlValue* error;
+};
+
+G_DEFINE_TYPE(CameraLinuxCameraEventApiImageStreamFrameResponse, camera_linux_camera_event_api_image_stream_frame_response, G_TYPE_OBJECT)
+
+static void camera_linux_camera_event_api_image_stream_frame_response_dispose(GObject* object) {
+  CameraLinuxCameraEventApiImageStreamFrameResponse* self = CAMERA_LINUX_CAMERA_EVENT_API_IMAGE_STREAM_FRAME_RESPONSE(object);
+  g_clear_pointer(&self->error, fl_value_unref);
+  G_OBJECT_CLASS(camera_linux_camera_event_api_image_stream_frame_response_parent_class)->dispose(object);
+}
+
+static void camera_linux_camera_event_api_image_stream_frame_response_init(CameraLinuxCameraEventApiImageStreamFrameResponse* self) {
+}
+
+static void camera_linux_camera_event_api_image_stream_frame_response_class_init(CameraLinuxCameraEventApiImageStreamFrameResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = camera_linux_camera_event_api_image_stream_frame_response_dispose;
+}
+
+static CameraLinuxCameraEventApiImageStreamFrameResponse* camera_linux_camera_event_api_image_stream_frame_response_new(FlValue* response) {
+  CameraLinuxCameraEventApiImageStreamFrameResponse* self = CAMERA_LINUX_CAMERA_EVENT_API_IMAGE_STREAM_FRAME_RESPONSE(g_object_new(camera_linux_camera_event_api_image_stream_frame_response_get_type(), nullptr));
+  if (fl_value_get_length(response) > 1) {
+    self->error = fl_value_ref(response);
+  }
+  return self;
+}
+
+gboolean camera_linux_camera_event_api_image_stream_frame_response_is_error(CameraLinuxCameraEventApiImageStreamFrameResponse* self) {
+  g_return_val_if_fail(CAMERA_LINUX_IS_CAMERA_EVENT_API_IMAGE_STREAM_FRAME_RESPONSE(self), FALSE);
+  return self->error != nullptr;
+}
+
+const gchar* camera_linux_camera_event_api_image_stream_frame_response_get_error_code(CameraLinuxCameraEventApiImageStreamFrameResponse* self) {
+  g_return_val_if_fail(CAMERA_LINUX_IS_CAMERA_EVENT_API_IMAGE_STREAM_FRAME_RESPONSE(self), nullptr);
+  g_assert(camera_linux_camera_event_api_image_stream_frame_response_is_error(self));
+  return fl_value_get_string(fl_value_get_list_value(self->error, 0));
+}
+
+const gchar* camera_linux_camera_event_api_image_stream_frame_response_get_error_message(CameraLinuxCameraEventApiImageStreamFrameResponse* self) {
+  g_return_val_if_fail(CAMERA_LINUX_IS_CAMERA_EVENT_API_IMAGE_STREAM_FRAME_RESPONSE(self), nullptr);
+  g_assert(camera_linux_camera_event_api_image_stream_frame_response_is_error(self));
+  return fl_value_get_string(fl_value_get_list_value(self->error, 1));
+}
+
+FlValue* camera_linux_camera_event_api_image_stream_frame_response_get_error_details(CameraLinuxCameraEventApiImageStreamFrameResponse* self) {
+  g_return_val_if_fail(CAMERA_LINUX_IS_CAMERA_EVENT_API_IMAGE_STREAM_FRAME_RESPONSE(self), nullptr);
+  g_assert(camera_linux_camera_event_api_image_stream_frame_response_is_error(self));
+  return fl_value_get_list_value(self->error, 2);
+}
+
+static void camera_linux_camera_event_api_image_stream_frame_cb(GObject* object, GAsyncResult* result, gpointer user_data) {
+  GTask* task = G_TASK(user_data);
+  g_task_return_pointer(task, result, g_object_unref);
+}
+
+void camera_linux_camera_event_api_image_stream_frame(CameraLinuxCameraEventApi* self, int64_t width, int64_t height, int64_t bytes_per_row, const uint8_t* bytes, size_t bytes_length, int64_t dropped_frame_count, GCancellable* cancellable, GAsyncReadyCallback callback, gpointer user_data) {
+  g_autoptr(FlValue) args = fl_value_new_list();
+  fl_value_append_take(args, fl_value_new_int(width));
+  fl_value_append_take(args, fl_value_new_int(height));
+  fl_value_append_take(args, fl_value_new_int(bytes_per_row));
+  fl_value_append_take(args, fl_value_new_uint8_list(bytes, bytes_length));
+  fl_value_append_take(args, fl_value_new_int(dropped_frame_count));
+  g_autofree gchar* channel_name = g_strdup_printf("dev.flutter.pigeon.camera_linux.CameraEventApi.imageStreamFrame%s", self->suffix);
+  g_autoptr(CameraLinuxMessageCodec) codec = camera_linux_message_codec_new();
+  FlBasicMessageChannel* channel = fl_basic_message_channel_new(self->messenger, channel_name, FL_MESSAGE_CODEC(codec));
+  GTask* task = g_task_new(self, cancellable, callback, user_data);
+  g_task_set_task_data(task, channel, g_object_unref);
+  fl_basic_message_channel_send(channel, args, cancellable, camera_linux_camera_event_api_image_stream_frame_cb, task);
+}
+
+CameraLinuxCameraEventApiImageStreamFrameResponse* camera_linux_camera_event_api_image_stream_frame_finish(CameraLinuxCameraEventApi* self, GAsyncResult* result, GError** error) {
+  g_autoptr(GTask) task = G_TASK(result);
+  GAsyncResult* r = G_ASYNC_RESULT(g_task_propagate_pointer(task, nullptr));
+  FlBasicMessageChannel* channel = FL_BASIC_MESSAGE_CHANNEL(g_task_get_task_data(task));
+  g_autoptr(FlValue) response = fl_basic_message_channel_send_finish(channel, r, error);
+  if (response == nullptr) { 
+    return nullptr;
+  }
+  return camera_linux_camera_event_api_image_stream_frame_response_new(response);
+}
+
 struct _CameraLinuxCameraEventApiErrorResponse {
   GObject parent_instance;
 
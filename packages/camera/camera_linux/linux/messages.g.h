@@ -67,11 +67,26 @@ typedef enum {
  * CameraLinuxPlatformImageFormatGroup:
  * CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_RGB8:
  * CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_MONO8:
+ * CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_BAYER_RG8:
+ * Raw sensor data, demosaiced on the GPU.
+ * CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_BAYER_GB8:
+ * Raw sensor data, demosaiced on the GPU.
+ * CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_MONO12P:
+ * 12-bit samples packed two to three bytes, unpacked on the GPU.
+ * CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_BAYER_RG12P:
+ * 12-bit samples packed two to three bytes, unpacked on the GPU.
+ * CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_BAYER_GB12P:
+ * 12-bit samples packed two to three bytes, unpacked on the GPU.
  *
  */
 typedef enum {
   CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_RGB8 = 0,
-  CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_MONO8 = 1
+  CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_MONO8 = 1,
+  CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_BAYER_RG8 = 2,
+  CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_BAYER_GB8 = 3,
+  CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_MONO12P = 4,
+  CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_BAYER_RG12P = 5,
+  CAMERA_LINUX_PLATFORM_IMAGE_FORMAT_GROUP_BAYER_GB12P = 6
 } CameraLinuxPlatformImageFormatGroup;
 
 /**
@@ -93,6 +108,71 @@ typedef enum {
   CAMERA_LINUX_PLATFORM_RESOLUTION_PRESET_MAX = 5
 } CameraLinuxPlatformResolutionPreset;
 
+/**
+ * CameraLinuxPlatformFrameQueuePolicy:
+ * CAMERA_LINUX_PLATFORM_FRAME_QUEUE_POLICY_DROP_OLDEST:
+ * CAMERA_LINUX_PLATFORM_FRAME_QUEUE_POLICY_DROP_NEWEST:
+ * CAMERA_LINUX_PLATFORM_FRAME_QUEUE_POLICY_BLOCK:
+ *
+ */
+typedef enum {
+  CAMERA_LINUX_PLATFORM_FRAME_QUEUE_POLICY_DROP_OLDEST = 0,
+  CAMERA_LINUX_PLATFORM_FRAME_QUEUE_POLICY_DROP_NEWEST = 1,
+  CAMERA_LINUX_PLATFORM_FRAME_QUEUE_POLICY_BLOCK = 2
+} CameraLinuxPlatformFrameQueuePolicy;
+
+/**
+ * CameraLinuxPlatformToneMappingOperator:
+ * CAMERA_LINUX_PLATFORM_TONE_MAPPING_OPERATOR_NONE:
+ * CAMERA_LINUX_PLATFORM_TONE_MAPPING_OPERATOR_REINHARD:
+ * CAMERA_LINUX_PLATFORM_TONE_MAPPING_OPERATOR_ACES_FILMIC:
+ *
+ */
+typedef enum {
+  CAMERA_LINUX_PLATFORM_TONE_MAPPING_OPERATOR_NONE = 0,
+  CAMERA_LINUX_PLATFORM_TONE_MAPPING_OPERATOR_REINHARD = 1,
+  CAMERA_LINUX_PLATFORM_TONE_MAPPING_OPERATOR_ACES_FILMIC = 2
+} CameraLinuxPlatformToneMappingOperator;
+
+/**
+ * CameraLinuxPlatformDemosaicAlgorithm:
+ * CAMERA_LINUX_PLATFORM_DEMOSAIC_ALGORITHM_BILINEAR:
+ * CAMERA_LINUX_PLATFORM_DEMOSAIC_ALGORITHM_MALVAR_HE_CUTLER:
+ *
+ */
+typedef enum {
+  CAMERA_LINUX_PLATFORM_DEMOSAIC_ALGORITHM_BILINEAR = 0,
+  CAMERA_LINUX_PLATFORM_DEMOSAIC_ALGORITHM_MALVAR_HE_CUTLER = 1
+} CameraLinuxPlatformDemosaicAlgorithm;
+
+/**
+ * CameraLinuxPlatformRenderFormat:
+ * CAMERA_LINUX_PLATFORM_RENDER_FORMAT_RGB8:
+ * CAMERA_LINUX_PLATFORM_RENDER_FORMAT_RGBA8:
+ * CAMERA_LINUX_PLATFORM_RENDER_FORMAT_RGB10A2:
+ * CAMERA_LINUX_PLATFORM_RENDER_FORMAT_RGBA16F:
+ *
+ */
+typedef enum {
+  CAMERA_LINUX_PLATFORM_RENDER_FORMAT_RGB8 = 0,
+  CAMERA_LINUX_PLATFORM_RENDER_FORMAT_RGBA8 = 1,
+  CAMERA_LINUX_PLATFORM_RENDER_FORMAT_RGB10A2 = 2,
+  CAMERA_LINUX_PLATFORM_RENDER_FORMAT_RGBA16F = 3
+} CameraLinuxPlatformRenderFormat;
+
+/**
+ * CameraLinuxPlatformJpegSubsampling:
+ * CAMERA_LINUX_PLATFORM_JPEG_SUBSAMPLING_YUV420:
+ * CAMERA_LINUX_PLATFORM_JPEG_SUBSAMPLING_YUV422:
+ * CAMERA_LINUX_PLATFORM_JPEG_SUBSAMPLING_YUV444:
+ *
+ */
+typedef enum {
+  CAMERA_LINUX_PLATFORM_JPEG_SUBSAMPLING_YUV420 = 0,
+  CAMERA_LINUX_PLATFORM_JPEG_SUBSAMPLING_YUV422 = 1,
+  CAMERA_LINUX_PLATFORM_JPEG_SUBSAMPLING_YUV444 = 2
+} CameraLinuxPlatformJpegSubsampling;
+
 /**
  * CameraLinuxPlatformSize:
  *
@@ -240,6 +320,46 @@ double camera_linux_platform_point_get_x(CameraLinuxPlatformPoint* object);
  */
 double camera_linux_platform_point_get_y(CameraLinuxPlatformPoint* object);
 
+/**
+ * CameraLinuxPlatformBurstResult:
+ *
+ * Pictures written by a burst.
+ */
+
+G_DECLARE_FINAL_TYPE(CameraLinuxPlatformBurstResult, camera_linux_platform_burst_result, CAMERA_LINUX, PLATFORM_BURST_RESULT, GObject)
+
+/**
+ * camera_linux_platform_burst_result_new:
+ * paths: field in this object.
+ * timestamps_us: field in this object.
+ *
+ * Creates a new #PlatformBurstResult object.
+ *
+ * Returns: a new #CameraLinuxPlatformBurstResult
+ */
+CameraLinuxPlatformBurstResult* camera_linux_platform_burst_result_new(FlValue* paths, FlValue* timestamps_us);
+
+/**
+ * camera_linux_platform_burst_result_get_paths
+ * @object: a #CameraLinuxPlatformBurstResult.
+ *
+ * The pictures' paths, in capture order.
+ *
+ * Returns: the field value.
+ */
+FlValue* camera_linux_platform_burst_result_get_paths(CameraLinuxPlatformBurstResult* object);
+
+/**
+ * camera_linux_platform_burst_result_get_timestamps_us
+ * @object: a #CameraLinuxPlatformBurstResult.
+ *
+ * When each frame was retrieved from the camera, in microseconds after the
+ * burst was requested.
+ *
+ * Returns: the field value.
+ */
+FlValue* camera_linux_platform_burst_result_get_timestamps_us(CameraLinuxPlatformBurstResult* object);
+
 G_DECLARE_FINAL_TYPE(CameraLinuxMessageCodec, camera_linux_message_codec, CAMERA_LINUX, MESSAGE_CODEC, FlStandardMessageCodec)
 
 G_DECLARE_FINAL_TYPE(CameraLinuxCameraApi, camera_linux_camera_api, CAMERA_LINUX, CAMERA_API, GObject)
@@ -263,6 +383,25 @@ typedef struct {
   void (*set_exposure_mode)(int64_t camera_id, CameraLinuxPlatformExposureMode mode, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
   void (*set_focus_mode)(int64_t camera_id, CameraLinuxPlatformFocusMode mode, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
   void (*set_image_format_group)(int64_t camera_id, CameraLinuxPlatformImageFormatGroup image_format_group, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+  void (*set_grab_buffer_count)(int64_t camera_id, int64_t count, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+  void (*set_upload_ring_depth)(int64_t camera_id, int64_t depth, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+  void (*set_frame_queue_policy)(int64_t camera_id, CameraLinuxPlatformFrameQueuePolicy policy, int64_t capacity, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+  void (*set_exposure_bracket)(int64_t camera_id, FlValue* exposures_us, FlValue* gains, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+  void (*set_tone_mapping)(int64_t camera_id, CameraLinuxPlatformToneMappingOperator tone_mapping_operator, double key, double adaptation_seconds, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+  void (*set_auto_exposure)(int64_t camera_id, gboolean enabled, double target_brightness, double overblown_threshold, double overblown_target_ratio, double controller_gain, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+  void (*set_demosaic_algorithm)(int64_t camera_id, CameraLinuxPlatformDemosaicAlgorithm algorithm, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+  void (*set_render_formats)(int64_t camera_id, CameraLinuxPlatformRenderFormat intermediate_format, CameraLinuxPlatformRenderFormat display_format, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+  void (*start_image_stream)(int64_t camera_id, int64_t width, int64_t height, double max_frame_rate, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+  void (*stop_image_stream)(int64_t camera_id, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+  void (*received_image_stream_data)(int64_t camera_id, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+  void (*set_preview_size)(int64_t camera_id, int64_t width, int64_t height, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+  void (*set_zero_shutter_lag)(int64_t camera_id, int64_t frame_count, gboolean raw_frames, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+  void (*take_burst)(int64_t camera_id, int64_t count, const gchar* directory, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+  void (*set_jpeg_settings)(int64_t camera_id, int64_t quality, CameraLinuxPlatformJpegSubsampling subsampling, int64_t restart_interval, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+  void (*set_video_recording_settings)(int64_t camera_id, int64_t bitrate, int64_t key_frame_interval, const gchar* container, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+  void (*set_video_recording_source)(int64_t camera_id, gboolean processed_frames, gboolean gpu_nv12, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+  void (*start_raw_recording)(int64_t camera_id, const gchar* file_path, int64_t max_frames, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
+  void (*stop_raw_recording)(int64_t camera_id, CameraLinuxCameraApiResponseHandle* response_handle, gpointer user_data);
 } CameraLinuxCameraApiVTable;
 
 /**
@@ -501,6 +640,369 @@ void camera_linux_camera_api_respond_set_image_format_group(CameraLinuxCameraApi
  */
 void camera_linux_camera_api_respond_error_set_image_format_group(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
 
+/**
+ * camera_linux_camera_api_respond_set_grab_buffer_count:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ *
+ * Responds to CameraApi.setGrabBufferCount. 
+ */
+void camera_linux_camera_api_respond_set_grab_buffer_count(CameraLinuxCameraApiResponseHandle* response_handle);
+
+/**
+ * camera_linux_camera_api_respond_error_set_grab_buffer_count:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to CameraApi.setGrabBufferCount. 
+ */
+void camera_linux_camera_api_respond_error_set_grab_buffer_count(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * camera_linux_camera_api_respond_set_upload_ring_depth:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ *
+ * Responds to CameraApi.setUploadRingDepth. 
+ */
+void camera_linux_camera_api_respond_set_upload_ring_depth(CameraLinuxCameraApiResponseHandle* response_handle);
+
+/**
+ * camera_linux_camera_api_respond_error_set_upload_ring_depth:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to CameraApi.setUploadRingDepth. 
+ */
+void camera_linux_camera_api_respond_error_set_upload_ring_depth(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * camera_linux_camera_api_respond_set_frame_queue_policy:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ *
+ * Responds to CameraApi.setFrameQueuePolicy. 
+ */
+void camera_linux_camera_api_respond_set_frame_queue_policy(CameraLinuxCameraApiResponseHandle* response_handle);
+
+/**
+ * camera_linux_camera_api_respond_error_set_frame_queue_policy:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to CameraApi.setFrameQueuePolicy. 
+ */
+void camera_linux_camera_api_respond_error_set_frame_queue_policy(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * camera_linux_camera_api_respond_set_exposure_bracket:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ *
+ * Responds to CameraApi.setExposureBracket. 
+ */
+void camera_linux_camera_api_respond_set_exposure_bracket(CameraLinuxCameraApiResponseHandle* response_handle);
+
+/**
+ * camera_linux_camera_api_respond_error_set_exposure_bracket:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to CameraApi.setExposureBracket. 
+ */
+void camera_linux_camera_api_respond_error_set_exposure_bracket(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * camera_linux_camera_api_respond_set_tone_mapping:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ *
+ * Responds to CameraApi.setToneMapping. 
+ */
+void camera_linux_camera_api_respond_set_tone_mapping(CameraLinuxCameraApiResponseHandle* response_handle);
+
+/**
+ * camera_linux_camera_api_respond_error_set_tone_mapping:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to CameraApi.setToneMapping. 
+ */
+void camera_linux_camera_api_respond_error_set_tone_mapping(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * camera_linux_camera_api_respond_set_auto_exposure:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ *
+ * Responds to CameraApi.setAutoExposure. 
+ */
+void camera_linux_camera_api_respond_set_auto_exposure(CameraLinuxCameraApiResponseHandle* response_handle);
+
+/**
+ * camera_linux_camera_api_respond_error_set_auto_exposure:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to CameraApi.setAutoExposure. 
+ */
+void camera_linux_camera_api_respond_error_set_auto_exposure(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * camera_linux_camera_api_respond_set_demosaic_algorithm:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ *
+ * Responds to CameraApi.setDemosaicAlgorithm. 
+ */
+void camera_linux_camera_api_respond_set_demosaic_algorithm(CameraLinuxCameraApiResponseHandle* response_handle);
+
+/**
+ * camera_linux_camera_api_respond_error_set_demosaic_algorithm:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to CameraApi.setDemosaicAlgorithm. 
+ */
+void camera_linux_camera_api_respond_error_set_demosaic_algorithm(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * camera_linux_camera_api_respond_set_render_formats:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ *
+ * Responds to CameraApi.setRenderFormats. 
+ */
+void camera_linux_camera_api_respond_set_render_formats(CameraLinuxCameraApiResponseHandle* response_handle);
+
+/**
+ * camera_linux_camera_api_respond_error_set_render_formats:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to CameraApi.setRenderFormats. 
+ */
+void camera_linux_camera_api_respond_error_set_render_formats(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * camera_linux_camera_api_respond_start_image_stream:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ *
+ * Responds to CameraApi.startImageStream. 
+ */
+void camera_linux_camera_api_respond_start_image_stream(CameraLinuxCameraApiResponseHandle* response_handle);
+
+/**
+ * camera_linux_camera_api_respond_error_start_image_stream:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to CameraApi.startImageStream. 
+ */
+void camera_linux_camera_api_respond_error_start_image_stream(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * camera_linux_camera_api_respond_stop_image_stream:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ *
+ * Responds to CameraApi.stopImageStream. 
+ */
+void camera_linux_camera_api_respond_stop_image_stream(CameraLinuxCameraApiResponseHandle* response_handle);
+
+/**
+ * camera_linux_camera_api_respond_error_stop_image_stream:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to CameraApi.stopImageStream. 
+ */
+void camera_linux_camera_api_respond_error_stop_image_stream(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * camera_linux_camera_api_respond_received_image_stream_data:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ *
+ * Responds to CameraApi.receivedImageStreamData. 
+ */
+void camera_linux_camera_api_respond_received_image_stream_data(CameraLinuxCameraApiResponseHandle* response_handle);
+
+/**
+ * camera_linux_camera_api_respond_error_received_image_stream_data:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to CameraApi.receivedImageStreamData. 
+ */
+void camera_linux_camera_api_respond_error_received_image_stream_data(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * camera_linux_camera_api_respond_set_preview_size:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ *
+ * Responds to CameraApi.setPreviewSize. 
+ */
+void camera_linux_camera_api_respond_set_preview_size(CameraLinuxCameraApiResponseHandle* response_handle);
+
+/**
+ * camera_linux_camera_api_respond_error_set_preview_size:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to CameraApi.setPreviewSize. 
+ */
+void camera_linux_camera_api_respond_error_set_preview_size(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * camera_linux_camera_api_respond_set_zero_shutter_lag:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ *
+ * Responds to CameraApi.setZeroShutterLag. 
+ */
+void camera_linux_camera_api_respond_set_zero_shutter_lag(CameraLinuxCameraApiResponseHandle* response_handle);
+
+/**
+ * camera_linux_camera_api_respond_error_set_zero_shutter_lag:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to CameraApi.setZeroShutterLag. 
+ */
+void camera_linux_camera_api_respond_error_set_zero_shutter_lag(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * camera_linux_camera_api_respond_take_burst:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to CameraApi.takeBurst. 
+ */
+void camera_linux_camera_api_respond_take_burst(CameraLinuxCameraApiResponseHandle* response_handle, CameraLinuxPlatformBurstResult* return_value);
+
+/**
+ * camera_linux_camera_api_respond_error_take_burst:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to CameraApi.takeBurst. 
+ */
+void camera_linux_camera_api_respond_error_take_burst(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * camera_linux_camera_api_respond_set_jpeg_settings:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ *
+ * Responds to CameraApi.setJpegSettings. 
+ */
+void camera_linux_camera_api_respond_set_jpeg_settings(CameraLinuxCameraApiResponseHandle* response_handle);
+
+/**
+ * camera_linux_camera_api_respond_error_set_jpeg_settings:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to CameraApi.setJpegSettings. 
+ */
+void camera_linux_camera_api_respond_error_set_jpeg_settings(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * camera_linux_camera_api_respond_set_video_recording_settings:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ *
+ * Responds to CameraApi.setVideoRecordingSettings. 
+ */
+void camera_linux_camera_api_respond_set_video_recording_settings(CameraLinuxCameraApiResponseHandle* response_handle);
+
+/**
+ * camera_linux_camera_api_respond_error_set_video_recording_settings:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to CameraApi.setVideoRecordingSettings. 
+ */
+void camera_linux_camera_api_respond_error_set_video_recording_settings(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * camera_linux_camera_api_respond_set_video_recording_source:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ *
+ * Responds to CameraApi.setVideoRecordingSource. 
+ */
+void camera_linux_camera_api_respond_set_video_recording_source(CameraLinuxCameraApiResponseHandle* response_handle);
+
+/**
+ * camera_linux_camera_api_respond_error_set_video_recording_source:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to CameraApi.setVideoRecordingSource. 
+ */
+void camera_linux_camera_api_respond_error_set_video_recording_source(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * camera_linux_camera_api_respond_start_raw_recording:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ *
+ * Responds to CameraApi.startRawRecording. 
+ */
+void camera_linux_camera_api_respond_start_raw_recording(CameraLinuxCameraApiResponseHandle* response_handle);
+
+/**
+ * camera_linux_camera_api_respond_error_start_raw_recording:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to CameraApi.startRawRecording. 
+ */
+void camera_linux_camera_api_respond_error_start_raw_recording(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * camera_linux_camera_api_respond_stop_raw_recording:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to CameraApi.stopRawRecording. 
+ */
+void camera_linux_camera_api_respond_stop_raw_recording(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* return_value);
+
+/**
+ * camera_linux_camera_api_respond_error_stop_raw_recording:
+ * @response_handle: a #CameraLinuxCameraApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to CameraApi.stopRawRecording. 
+ */
+void camera_linux_camera_api_respond_error_stop_raw_recording(CameraLinuxCameraApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
 G_DECLARE_FINAL_TYPE(CameraLinuxCameraEventApiInitializedResponse, camera_linux_camera_event_api_initialized_response, CAMERA_LINUX, CAMERA_EVENT_API_INITIALIZED_RESPONSE, GObject)
 
 /**
@@ -585,6 +1087,48 @@ const gchar* camera_linux_camera_event_api_texture_id_response_get_error_message
  */
 FlValue* camera_linux_camera_event_api_texture_id_response_get_error_details(CameraLinuxCameraEventApiTextureIdResponse* response);
 
+G_DECLARE_FINAL_TYPE(CameraLinuxCameraEventApiImageStreamFrameResponse, camera_linux_camera_event_api_image_stream_frame_response, CAMERA_LINUX, CAMERA_EVENT_API_IMAGE_STREAM_FRAME_RESPONSE, GObject)
+
+/**
+ * camera_linux_camera_event_api_image_stream_frame_response_is_error:
+ * @response: a #CameraLinuxCameraEventApiImageStreamFrameResponse.
+ *
+ * Checks if a response to CameraEventApi.imageStreamFrame is an error.
+ *
+ * Returns: a %TRUE if this response is an error.
+ */
+gboolean camera_linux_camera_event_api_image_stream_frame_response_is_error(CameraLinuxCameraEventApiImageStreamFrameResponse* response);
+
+/**
+ * camera_linux_camera_event_api_image_stream_frame_response_get_error_code:
+ * @response: a #CameraLinuxCameraEventApiImageStreamFrameResponse.
+ *
+ * Get the error code for this response.
+ *
+ * Returns: an error code or %NULL if not an error.
+ */
+const gchar* camera_linux_camera_event_api_image_stream_frame_response_get_error_code(CameraLinuxCameraEventApiImageStreamFrameResponse* response);
+
+/**
+ * camera_linux_camera_event_api_image_stream_frame_response_get_error_message:
+ * @response: a #CameraLinuxCameraEventApiImageStreamFrameResponse.
+ *
+ * Get the error message for this response.
+ *
+ * Returns: an error message.
+ */
+const gchar* camera_linux_camera_event_api_image_stream_frame_response_get_error_message(CameraLinuxCameraEventApiImageStreamFrameResponse* response);
+
+/**
+ * camera_linux_camera_event_api_image_stream_frame_response_get_error_details:
+ * @response: a #CameraLinuxCameraEventApiImageStreamFrameResponse.
+ *
+ * Get the error details for this response.
+ *
+ * Returns: (allow-none): an error details or %NULL.
+ */
+FlValue* camera_linux_camera_event_api_image_stream_frame_response_get_error_details(CameraLinuxCameraEventApiImageStreamFrameResponse* response);
+
 G_DECLARE_FINAL_TYPE(CameraLinuxCameraEventApiErrorResponse, camera_linux_camera_event_api_error_response, CAMERA_LINUX, CAMERA_EVENT_API_ERROR_RESPONSE, GObject)
 
 /**
@@ -695,6 +1239,34 @@ void camera_linux_camera_event_api_texture_id(CameraLinuxCameraEventApi* api, in
  */
 CameraLinuxCameraEventApiTextureIdResponse* camera_linux_camera_event_api_texture_id_finish(CameraLinuxCameraEventApi* api, GAsyncResult* result, GError** error);
 
+/**
+ * camera_linux_camera_event_api_image_stream_frame:
+ * @api: a #CameraLinuxCameraEventApi.
+ * @width: parameter for this method.
+ * @height: parameter for this method.
+ * @bytes_per_row: parameter for this method.
+ * @bytes: parameter for this method.
+ * @bytes_length: length of @bytes.
+ * @dropped_frame_count: parameter for this method.
+ * @cancellable: (allow-none): a #GCancellable or %NULL.
+ * @callback: (scope async): (allow-none): a #GAsyncReadyCallback to call when the call is complete or %NULL to ignore the response.
+ * @user_data: (closure): user data to pass to @callback.
+ *
+ */
+void camera_linux_camera_event_api_image_stream_frame(CameraLinuxCameraEventApi* api, int64_t width, int64_t height, int64_t bytes_per_row, const uint8_t* bytes, size_t bytes_length, int64_t dropped_frame_count, GCancellable* cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * camera_linux_camera_event_api_image_stream_frame_finish:
+ * @api: a #CameraLinuxCameraEventApi.
+ * @result: a #GAsyncResult.
+ * @error: (allow-none): #GError location to store the error occurring, or %NULL to ignore.
+ *
+ * Completes a camera_linux_camera_event_api_image_stream_frame() call.
+ *
+ * Returns: a #CameraLinuxCameraEventApiImageStreamFrameResponse or %NULL on error.
+ */
+CameraLinuxCameraEventApiImageStreamFrameResponse* camera_linux_camera_event_api_image_stream_frame_finish(CameraLinuxCameraEventApi* api, GAsyncResult* result, GError** error);
+
 /**
  * camera_linux_camera_event_api_error:
  * @api: a #CameraLinuxCameraEventApi.
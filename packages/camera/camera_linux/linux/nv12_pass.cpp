@@ -0,0 +1,109 @@
+#include "nv12_pass.h"
+
+#include <iostream>
+
+#include "gl_utils.h"
+
+static const char* const kNv12FragmentShader = R"(
+  #version 300 es
+  precision highp float;
+  out vec4 FragColor;
+
+  uniform sampler2D source;
+  // Frame size in pixels
+  uniform ivec2 size;
+
+  // BT.601, limited range
+  float Luma(vec3 c) {
+    return (16.0 + dot(c, vec3(65.481, 128.553, 24.966))) / 255.0;
+  }
+
+  vec2 Chroma(vec3 c) {
+    return (128.0 + vec2(dot(c, vec3(-37.797, -74.203, 112.0)),
+                         dot(c, vec3(112.0, -93.786, -18.214)))) / 255.0;
+  }
+
+  vec3 Fetch(int x, int y) {
+    vec3 c = texelFetch(source, min(ivec2(x, y), size - 1), 0).rgb;
+    return clamp(c, 0.0, 1.0);
+  }
+
+  // Average of the 2x2 pixels a chroma sample covers
+  vec3 Block(int x, int y) {
+    return 0.25 * (Fetch(x, y) + Fetch(x + 1, y) + Fetch(x, y + 1) +
+                   Fetch(x + 1, y + 1));
+  }
+
+  void main() {
+    ivec2 texel = ivec2(gl_FragCoord.xy);
+    int x = texel.x * 4;
+    if (texel.y < size.y) {
+      int y = texel.y;
+      FragColor = vec4(Luma(Fetch(x, y)), Luma(Fetch(x + 1, y)),
+                       Luma(Fetch(x + 2, y)), Luma(Fetch(x + 3, y)));
+    } else {
+      int y = (texel.y - size.y) * 2;
+      FragColor = vec4(Chroma(Block(x, y)), Chroma(Block(x + 2, y)));
+    }
+  }
+)";
+
+Nv12Pass::Nv12Pass() {
+  m_program = CreateShaderProgram(kFullscreenVertexShader, kNv12FragmentShader);
+  glGenVertexArrays(1, &m_vao);
+  glGenFramebuffers(1, &m_fbo);
+
+  glUseProgram(m_program);
+  glUniform1i(glGetUniformLocation(m_program, "source"), 0);
+  glUseProgram(0);
+
+  std::cout << "[DEBUG] Created NV12 program: " << m_program << std::endl;
+}
+
+Nv12Pass::~Nv12Pass() {
+  glDeleteTextures(1, &m_texture);
+  glDeleteFramebuffers(1, &m_fbo);
+  glDeleteVertexArrays(1, &m_vao);
+  glDeleteProgram(m_program);
+}
+
+bool Nv12Pass::CanConvert(int width, int height) {
+  return width > 0 && height > 0 && width % 4 == 0 && height % 2 == 0;
+}
+
+void Nv12Pass::Resize(GLsizei width, GLsizei height) {
+  if (m_texture && width == m_width && height == m_height) {
+    return;
+  }
+  m_width = width;
+  m_height = height;
+  glDeleteTextures(1, &m_texture);
+  glGenTextures(1, &m_texture);
+  glBindTexture(GL_TEXTURE_2D, m_texture);
+  glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, GetTextureWidth(),
+                 GetTextureHeight());
+  glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void Nv12Pass::Render(GLuint source, GpuTimer& timer) {
+  timer.Begin("record_nv12");
+  glBindVertexArray(m_vao);
+  glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                         m_texture, 0);
+  glViewport(0, 0, GetTextureWidth(), GetTextureHeight());
+  glUseProgram(m_program);
+  glUniform2i(glGetUniformLocation(m_program, "size"), m_width, m_height);
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, source);
+  glDrawArrays(GL_TRIANGLES, 0, 3);
+
+  // Cleanup
+  glBindTexture(GL_TEXTURE_2D, 0);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0,
+                         0);
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  glBindVertexArray(0);
+  glUseProgram(0);
+  timer.End();
+}
@@ -0,0 +1,50 @@
+#ifndef NV12_PASS_H_
+#define NV12_PASS_H_
+
+#include <GLES3/gl3.h>
+
+#include "gpu_timer.h"
+
+// Converts frames to NV12 on the GPU, so recordings read back 12 bits per
+// pixel instead of 32.
+//
+// The target is an RGBA8 texture whose bytes, read back row by row, are the
+// NV12 frame: each texel packs four luma samples of a row, or two chroma
+// pairs of a row of 2x2 blocks below them. FrameReadback reads it like any
+// other frame, a quarter of the frame's width wide and half again as tall.
+// Colours are converted with the BT.601 limited-range matrix FFmpeg assumes
+// for untagged video.
+//
+// All methods must be called with the rendering GL context current.
+class Nv12Pass {
+ public:
+  Nv12Pass();
+  ~Nv12Pass();
+
+  Nv12Pass(const Nv12Pass&) = delete;
+  Nv12Pass& operator=(const Nv12Pass&) = delete;
+
+  // True if `width` x `height` frames can be packed: the width a multiple
+  // of 4, the height even.
+  static bool CanConvert(int width, int height);
+
+  // Sizes the target for `width` x `height` frames, if it is not already.
+  void Resize(GLsizei width, GLsizei height);
+
+  // Converts `source`, a frame of the size given to Resize().
+  void Render(GLuint source, GpuTimer& timer);
+
+  GLuint GetTexture() const { return m_texture; }
+  GLsizei GetTextureWidth() const { return m_width / 4; }
+  GLsizei GetTextureHeight() const { return m_height * 3 / 2; }
+
+ private:
+  GLuint m_program = 0;
+  GLuint m_vao = 0;
+  GLuint m_fbo = 0;
+  GLuint m_texture = 0;
+  GLsizei m_width = 0;
+  GLsizei m_height = 0;
+};
+
+#endif  // NV12_PASS_H_
@@ -0,0 +1,139 @@
+#include "pbo_upload_ring.h"
+
+#include <GLES2/gl2ext.h>
+
+#include <iostream>
+
+#include "gl_utils.h"
+
+// Slots start on a page boundary so memcpy into them stays aligned.
+static constexpr size_t kSlotAlignment = 4096;
+static constexpr GLuint64 kFenceTimeoutNs = 1000000000;  // 1 s
+
+static PFNGLBUFFERSTORAGEEXTPROC LoadBufferStorage() {
+  // Desktop GL 4.4 exposes it as core, GLES only through the extension.
+  if (HasGLExtension("GL_EXT_buffer_storage")) {
+    return reinterpret_cast<PFNGLBUFFERSTORAGEEXTPROC>(
+        GetGLProcAddress("glBufferStorageEXT"));
+  }
+  if (HasGLExtension("GL_ARB_buffer_storage")) {
+    return reinterpret_cast<PFNGLBUFFERSTORAGEEXTPROC>(
+        GetGLProcAddress("glBufferStorage"));
+  }
+  return nullptr;
+}
+
+PboUploadRing::PboUploadRing(size_t depth, size_t slotSize)
+    : m_slot_size(slotSize),
+      m_slot_stride((slotSize + kSlotAlignment - 1) / kSlotAlignment *
+                    kSlotAlignment),
+      m_fences(depth, nullptr) {
+  const GLsizeiptr bufferSize = static_cast<GLsizeiptr>(m_slot_stride * depth);
+
+  glGenBuffers(1, &m_buffer);
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_buffer);
+
+  PFNGLBUFFERSTORAGEEXTPROC bufferStorage = LoadBufferStorage();
+  if (bufferStorage) {
+    const GLbitfield flags =
+        GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT_EXT | GL_MAP_COHERENT_BIT_EXT;
+    bufferStorage(GL_PIXEL_UNPACK_BUFFER, bufferSize, nullptr, flags);
+    m_persistent_ptr = static_cast<uint8_t*>(
+        glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, bufferSize, flags));
+    if (!m_persistent_ptr) {
+      // Immutable storage cannot be re-specified: start over on a new name.
+      std::cerr << "[WARN] Persistent PBO mapping failed, falling back to "
+                   "per-frame mapping."
+                << std::endl;
+      glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+      glDeleteBuffers(1, &m_buffer);
+      glGenBuffers(1, &m_buffer);
+      glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_buffer);
+    }
+  }
+  if (!m_persistent_ptr) {
+    // Specified once; MapSlot() never orphans it.
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, bufferSize, nullptr, GL_STREAM_DRAW);
+  }
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+  std::cout << "[DEBUG] Created " << depth << "-deep "
+            << (m_persistent_ptr ? "persistent" : "mapped")
+            << " PBO upload ring, buffer ID: " << m_buffer << std::endl;
+}
+
+PboUploadRing::~PboUploadRing() {
+  for (GLsync& fence : m_fences) {
+    if (fence) {
+      glDeleteSync(fence);
+      fence = nullptr;
+    }
+  }
+  if (m_persistent_ptr || m_mapped_ptr) {
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_buffer);
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+  }
+  glDeleteBuffers(1, &m_buffer);
+}
+
+void PboUploadRing::WaitForSlot(size_t index) {
+  GLsync& fence = m_fences[index];
+  if (!fence) {
+    return;
+  }
+  GLenum status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+                                   kFenceTimeoutNs);
+  while (status == GL_TIMEOUT_EXPIRED) {
+    std::cerr << "[WARN] Still waiting for the GPU to release PBO slot "
+              << index << std::endl;
+    status = glClientWaitSync(fence, 0, kFenceTimeoutNs);
+  }
+  if (status == GL_WAIT_FAILED) {
+    std::cerr << "[ERROR] glClientWaitSync failed on PBO slot " << index
+              << std::endl;
+  }
+  glDeleteSync(fence);
+  fence = nullptr;
+}
+
+uint8_t* PboUploadRing::MapSlot() {
+  WaitForSlot(m_index);
+
+  const size_t offset = m_index * m_slot_stride;
+  if (m_persistent_ptr) {
+    return m_persistent_ptr + offset;
+  }
+
+  // The fence already guarantees the GPU is done with this range, so the
+  // driver does not need to synchronize (or orphan) anything.
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_buffer);
+  m_mapped_ptr = static_cast<uint8_t*>(glMapBufferRange(
+      GL_PIXEL_UNPACK_BUFFER, static_cast<GLintptr>(offset),
+      static_cast<GLsizeiptr>(m_slot_size),
+      GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT |
+          GL_MAP_UNSYNCHRONIZED_BIT));
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+  if (!m_mapped_ptr) {
+    std::cerr << "[ERROR] Failed to map PBO slot " << m_index << std::endl;
+  }
+  return m_mapped_ptr;
+}
+
+void PboUploadRing::UnmapSlot() {
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_buffer);
+  if (m_mapped_ptr) {
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    m_mapped_ptr = nullptr;
+  }
+}
+
+const void* PboUploadRing::GetSlotOffset() const {
+  return reinterpret_cast<const void*>(m_index * m_slot_stride);
+}
+
+void PboUploadRing::SubmitSlot() {
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+  m_fences[m_index] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  m_index = (m_index + 1) % m_fences.size();
+}
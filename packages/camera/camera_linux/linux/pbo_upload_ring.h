@@ -0,0 +1,56 @@
+#ifndef PBO_UPLOAD_RING_H_
+#define PBO_UPLOAD_RING_H_
+
+#include <GLES3/gl3.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define PBO_UPLOAD_RING_DEPTH 3
+#define PBO_UPLOAD_RING_MAX_DEPTH 8
+
+// Ring of pixel-unpack slots carved out of a single buffer object.
+//
+// When buffer storage is available the buffer gets immutable storage and is
+// mapped once, persistently and coherently, and frames are written straight
+// into it. Otherwise each slot is mapped unsynchronized on demand. Either way
+// every slot carries a fence, so a slot is only rewritten once the GPU
+// finished reading it.
+//
+// All methods must be called with the uploading GL context current.
+class PboUploadRing {
+ public:
+  PboUploadRing(size_t depth, size_t slotSize);
+  ~PboUploadRing();
+
+  PboUploadRing(const PboUploadRing&) = delete;
+  PboUploadRing& operator=(const PboUploadRing&) = delete;
+
+  // Waits for the GPU to release the current slot and returns a pointer the
+  // CPU may fill with up to GetSlotSize() bytes.
+  uint8_t* MapSlot();
+  // Binds the slot to GL_PIXEL_UNPACK_BUFFER. Uploads issued until
+  // SubmitSlot() must pass GetSlotOffset() as their data pointer.
+  void UnmapSlot();
+  const void* GetSlotOffset() const;
+  // Fences the uploads read from the slot and advances the ring.
+  void SubmitSlot();
+
+  bool IsPersistent() const { return m_persistent_ptr != nullptr; }
+  size_t GetDepth() const { return m_fences.size(); }
+  size_t GetSlotSize() const { return m_slot_size; }
+
+ private:
+  GLuint m_buffer = 0;
+  size_t m_slot_size;
+  size_t m_slot_stride;
+  size_t m_index = 0;
+  uint8_t* m_persistent_ptr = nullptr;
+  uint8_t* m_mapped_ptr = nullptr;
+  std::vector<GLsync> m_fences;
+
+  void WaitForSlot(size_t index);
+};
+
+#endif  // PBO_UPLOAD_RING_H_
@@ -0,0 +1,125 @@
+#include "pylon_frame_source.h"
+
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+
+// Name of the camera's PixelFormat entry for `pixelType`, or nullptr.
+static const char* GetPixelFormatName(Pylon::EPixelType pixelType) {
+  switch (pixelType) {
+    case Pylon::PixelType_Mono8:
+      return "Mono8";
+    case Pylon::PixelType_Mono10p:
+      return "Mono10p";
+    case Pylon::PixelType_Mono12p:
+      return "Mono12p";
+    case Pylon::PixelType_RGB8packed:
+      return "RGB8";
+    case Pylon::PixelType_BayerRG8:
+      return "BayerRG8";
+    case Pylon::PixelType_BayerGB8:
+      return "BayerGB8";
+    case Pylon::PixelType_BayerRG12p:
+      return "BayerRG12p";
+    case Pylon::PixelType_BayerGB12p:
+      return "BayerGB12p";
+    default:
+      return nullptr;
+  }
+}
+
+PylonFrameSource::PylonFrameSource(Pylon::CInstantCamera& camera)
+    : m_camera(camera) {}
+
+void PylonFrameSource::Start() {
+  m_camera.StartGrabbing(Pylon::GrabStrategy_OneByOne,
+                         Pylon::EGrabLoop::GrabLoop_ProvidedByUser);
+}
+
+void PylonFrameSource::Stop() {
+  if (m_camera.IsGrabbing()) {
+    m_camera.StopGrabbing();
+  }
+}
+
+bool PylonFrameSource::IsGrabbing() const {
+  return m_camera.IsGrabbing();
+}
+
+int PylonFrameSource::GetWidth() {
+  Pylon::CIntegerParameter width(m_camera.GetNodeMap(), "Width");
+  return width.IsReadable() ? static_cast<int>(width.GetValue()) : 0;
+}
+
+int PylonFrameSource::GetHeight() {
+  Pylon::CIntegerParameter height(m_camera.GetNodeMap(), "Height");
+  return height.IsReadable() ? static_cast<int>(height.GetValue()) : 0;
+}
+
+size_t PylonFrameSource::GetPayloadSize() {
+  Pylon::CIntegerParameter payloadSize(m_camera.GetNodeMap(), "PayloadSize");
+  return payloadSize.IsReadable()
+             ? static_cast<size_t>(payloadSize.GetValue())
+             : 0;
+}
+
+double PylonFrameSource::GetFrameRate() {
+  Pylon::CFloatParameter frameRate(m_camera.GetNodeMap(),
+                                   "ResultingFrameRate");
+  return frameRate.IsReadable() ? frameRate.GetValue() : 0.0;
+}
+
+bool PylonFrameSource::SetPixelType(Pylon::EPixelType pixelType) {
+  const char* name = GetPixelFormatName(pixelType);
+  return name &&
+         Pylon::CEnumParameter(m_camera.GetNodeMap(), "PixelFormat")
+             .TrySetValue(name);
+}
+
+void PylonFrameSource::Trigger(double exposureUs, double gainDb) {
+  GenApi::INodeMap& nodemap = m_camera.GetNodeMap();
+  Pylon::CFloatParameter(nodemap, "ExposureTime").TrySetValue(exposureUs);
+  if (!std::isnan(gainDb)) {
+    Pylon::CFloatParameter(nodemap, "Gain").TrySetValue(gainDb);
+  }
+  m_camera.WaitForFrameTriggerReady(PYLON_TRIGGER_READY_TIMEOUT_MS,
+                                    Pylon::TimeoutHandling_Return);
+  m_camera.ExecuteSoftwareTrigger();
+}
+
+bool PylonFrameSource::Retrieve(SourceFrame& frame,
+                                std::chrono::milliseconds timeout) {
+  Pylon::CGrabResultPtr grabResult;
+  if (!m_camera.RetrieveResult(static_cast<unsigned int>(timeout.count()),
+                               grabResult, Pylon::TimeoutHandling_Return)) {
+    return false;
+  }
+  if (!grabResult->GrabSucceeded()) {
+    std::cerr << "Error grabbing image: " << grabResult->GetErrorDescription()
+              << std::endl;
+    return false;
+  }
+
+  frame.owner = std::make_shared<Pylon::CGrabResultPtr>(grabResult);
+  frame.pixels = static_cast<const uint8_t*>(grabResult->GetBuffer());
+  frame.size = grabResult->GetImageSize();
+  frame.pixelType = grabResult->GetPixelType();
+  frame.width = static_cast<int>(grabResult->GetWidth());
+  frame.height = static_cast<int>(grabResult->GetHeight());
+  frame.paddingX = grabResult->GetPaddingX();
+  // The block ID comes from the camera, so frames lost on the way still
+  // advance it; the host side ID only counts the ones delivered.
+  const uint64_t blockId = grabResult->GetBlockID();
+  frame.frameId = static_cast<int64_t>(
+      blockId != UINT64_MAX ? blockId : grabResult->GetID());
+  frame.sequencerSet = -1;
+  Pylon::CIntegerParameter sequencerSetActive(
+      grabResult->GetChunkDataNodeMap(), "ChunkSequencerSetActive");
+  if (sequencerSetActive.IsReadable()) {
+    frame.sequencerSet = static_cast<int>(sequencerSetActive.GetValue());
+  }
+  // The pipeline knows which exposure it triggered or programmed.
+  frame.exposureUs = 0.0;
+  frame.gainDb = 0.0;
+  return true;
+}
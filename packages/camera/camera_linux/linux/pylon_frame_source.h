@@ -0,0 +1,39 @@
+#ifndef PYLON_FRAME_SOURCE_H_
+#define PYLON_FRAME_SOURCE_H_
+
+#include "frame_source.h"
+
+// Longest wait for a camera to accept a software trigger
+#define PYLON_TRIGGER_READY_TIMEOUT_MS 5000
+
+// Frames grabbed from a Pylon camera, or from Pylon's camera emulator
+// (enumerated like a camera when PYLON_CAMEMU is set).
+//
+// Frames are handed over in the grab buffers themselves, which go back to
+// the camera once the last SourceFrame holding them is released. The
+// camera must be open and outlive the source.
+class PylonFrameSource : public FrameSource {
+ public:
+  explicit PylonFrameSource(Pylon::CInstantCamera& camera);
+
+  Pylon::CInstantCamera* GetCamera() override { return &m_camera; }
+
+  void Start() override;
+  void Stop() override;
+  bool IsGrabbing() const override;
+
+  int GetWidth() override;
+  int GetHeight() override;
+  size_t GetPayloadSize() override;
+  double GetFrameRate() override;
+  bool SetPixelType(Pylon::EPixelType pixelType) override;
+
+  void Trigger(double exposureUs, double gainDb) override;
+  bool Retrieve(SourceFrame& frame,
+                std::chrono::milliseconds timeout) override;
+
+ private:
+  Pylon::CInstantCamera& m_camera;
+};
+
+#endif  // PYLON_FRAME_SOURCE_H_
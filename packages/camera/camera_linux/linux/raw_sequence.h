@@ -0,0 +1,65 @@
+#ifndef RAW_SEQUENCE_H_
+#define RAW_SEQUENCE_H_
+
+#include <cstdint>
+
+// Raw sequence files hold frames exactly as the camera delivered them, for
+// offline tuning and replay. Every part starts on an alignment boundary, so
+// it can be written and read with O_DIRECT:
+//
+//   RawSequenceHeader, padded to RAW_SEQUENCE_ALIGNMENT
+//   frame table: `frameCapacity` RawSequenceFrameInfo entries, padded
+//   payloads, one per `slotSize` bytes, in capture order
+//
+// Fields are in the host's byte order.
+
+#define RAW_SEQUENCE_MAGIC "LXRAWSEQ"
+#define RAW_SEQUENCE_VERSION 1
+// Block size O_DIRECT transfers are aligned to, in bytes
+#define RAW_SEQUENCE_ALIGNMENT 4096
+
+struct RawSequenceHeader {
+  char magic[8];
+  uint32_t version;
+  // sizeof(RawSequenceHeader) and sizeof(RawSequenceFrameInfo) of the
+  // writer, so later versions can grow them
+  uint32_t headerSize;
+  uint32_t frameInfoSize;
+  // Pylon::EPixelType, shared by every frame
+  uint32_t pixelType;
+  uint32_t width;
+  uint32_t height;
+  uint32_t paddingX;
+  uint32_t reserved;
+  // Camera's frame rate when recording started, 0 if unknown
+  double frameRate;
+  uint64_t frameCapacity;
+  // Frames written; entries past it are zero
+  uint64_t frameCount;
+  uint64_t tableOffset;
+  uint64_t payloadOffset;
+  uint64_t slotSize;
+};
+
+struct RawSequenceFrameInfo {
+  // Of the payload, from the start of the file
+  uint64_t offset;
+  uint64_t size;
+  // When the frame was retrieved, from the first frame
+  int64_t timestampNs;
+  // Device tick count and block ID reported by the camera
+  uint64_t cameraTimestamp;
+  uint64_t blockId;
+  double exposureUs;
+  double gainDb;
+  // Sequencer set the frame was exposed with, -1 if unknown
+  int32_t sequencerSet;
+  uint32_t reserved;
+};
+
+static_assert(sizeof(RawSequenceHeader) <= RAW_SEQUENCE_ALIGNMENT,
+              "Raw sequence header must fit one block");
+static_assert(sizeof(RawSequenceFrameInfo) == 64,
+              "Raw sequence frame info is part of the file format");
+
+#endif  // RAW_SEQUENCE_H_
@@ -0,0 +1,76 @@
+#include "raw_sequence_reader.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+RawSequenceReader::RawSequenceReader(const std::string& filePath) {
+  const int fd = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    throw std::runtime_error("Failed to open " + filePath + ": " +
+                             std::strerror(errno));
+  }
+  struct stat status;
+  if (fstat(fd, &status) != 0 ||
+      static_cast<size_t>(status.st_size) < RAW_SEQUENCE_ALIGNMENT) {
+    close(fd);
+    throw std::runtime_error(filePath + " is not a raw sequence");
+  }
+  m_size = static_cast<size_t>(status.st_size);
+  void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping keeps the file open.
+  close(fd);
+  if (data == MAP_FAILED) {
+    throw std::runtime_error("Failed to map " + filePath + ": " +
+                             std::strerror(errno));
+  }
+  m_data = static_cast<const uint8_t*>(data);
+  madvise(data, m_size, MADV_SEQUENTIAL);
+
+  std::memcpy(&m_header, m_data, sizeof(m_header));
+  const RawSequenceHeader& h = m_header;
+  const bool valid =
+      std::memcmp(h.magic, RAW_SEQUENCE_MAGIC, sizeof(h.magic)) == 0 &&
+      h.version == RAW_SEQUENCE_VERSION &&
+      h.headerSize == sizeof(RawSequenceHeader) &&
+      h.frameInfoSize == sizeof(RawSequenceFrameInfo) &&
+      h.frameCount <= h.frameCapacity && h.tableOffset <= m_size &&
+      h.frameCount <= (m_size - h.tableOffset) / h.frameInfoSize &&
+      h.payloadOffset <= m_size && h.slotSize > 0 &&
+      h.frameCount <= (m_size - h.payloadOffset) / h.slotSize;
+  if (!valid) {
+    munmap(data, m_size);
+    throw std::runtime_error(filePath +
+                             " is not a complete raw sequence (version " +
+                             std::to_string(RAW_SEQUENCE_VERSION) + ")");
+  }
+  m_table = reinterpret_cast<const RawSequenceFrameInfo*>(m_data +
+                                                          h.tableOffset);
+  for (uint64_t i = 0; i < h.frameCount; ++i) {
+    const RawSequenceFrameInfo& info = m_table[i];
+    if (info.size > h.slotSize || info.offset < h.payloadOffset ||
+        info.offset > m_size - h.slotSize) {
+      munmap(data, m_size);
+      throw std::runtime_error(filePath + ": frame " + std::to_string(i) +
+                               " lies outside the file");
+    }
+  }
+}
+
+RawSequenceReader::~RawSequenceReader() {
+  munmap(const_cast<uint8_t*>(m_data), m_size);
+}
+
+const RawSequenceFrameInfo& RawSequenceReader::GetFrameInfo(
+    uint64_t index) const {
+  return m_table[index];
+}
+
+const uint8_t* RawSequenceReader::GetPayload(uint64_t index) const {
+  return m_data + m_table[index].offset;
+}
@@ -0,0 +1,37 @@
+#ifndef RAW_SEQUENCE_READER_H_
+#define RAW_SEQUENCE_READER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "raw_sequence.h"
+
+// Read access to a finished raw sequence file (see raw_sequence.h).
+//
+// The file is memory-mapped read-only, so payloads are handed out without
+// a copy and pages are read ahead as a replay walks through them. Throws
+// std::runtime_error when the file cannot be opened or is not a complete
+// raw sequence.
+class RawSequenceReader {
+ public:
+  explicit RawSequenceReader(const std::string& filePath);
+  ~RawSequenceReader();
+
+  RawSequenceReader(const RawSequenceReader&) = delete;
+  RawSequenceReader& operator=(const RawSequenceReader&) = delete;
+
+  const RawSequenceHeader& GetHeader() const { return m_header; }
+  uint64_t GetFrameCount() const { return m_header.frameCount; }
+  // `index` must be below GetFrameCount().
+  const RawSequenceFrameInfo& GetFrameInfo(uint64_t index) const;
+  const uint8_t* GetPayload(uint64_t index) const;
+
+ private:
+  const uint8_t* m_data = nullptr;
+  size_t m_size = 0;
+  RawSequenceHeader m_header = {};
+  const RawSequenceFrameInfo* m_table = nullptr;
+};
+
+#endif  // RAW_SEQUENCE_READER_H_
@@ -0,0 +1,239 @@
+#include "raw_sequence_writer.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+static uint64_t AlignUp(uint64_t size) {
+  return (size + RAW_SEQUENCE_ALIGNMENT - 1) / RAW_SEQUENCE_ALIGNMENT *
+         RAW_SEQUENCE_ALIGNMENT;
+}
+
+// `size` must be a multiple of RAW_SEQUENCE_ALIGNMENT.
+static RawSequenceBuffer AllocateBuffer(size_t size) {
+  return RawSequenceBuffer(
+      static_cast<uint8_t*>(std::aligned_alloc(RAW_SEQUENCE_ALIGNMENT, size)));
+}
+
+RawSequenceWriter::RawSequenceWriter(std::string filePath, double frameRate,
+                                     uint64_t maxFrames)
+    : m_file_path(std::move(filePath)),
+      m_frame_rate(frameRate),
+      m_max_frames(maxFrames > 0 ? maxFrames : RAW_SEQUENCE_DEFAULT_MAX_FRAMES),
+      m_queue(RAW_SEQUENCE_QUEUE_CAPACITY,
+              FrameQueueOverflowPolicy::DropNewest) {
+  // Started last: the thread uses every member.
+  m_thread = std::thread(&RawSequenceWriter::Run, this);
+}
+
+RawSequenceWriter::~RawSequenceWriter() {
+  Finish();
+}
+
+bool RawSequenceWriter::Push(const uint8_t* payload, size_t size,
+                             const RawSequenceFormat& format,
+                             const RawSequenceFrameInfo& info,
+                             std::chrono::steady_clock::time_point timestamp) {
+  if (m_queue.IsClosed()) {
+    return false;
+  }
+  if (m_pushed == 0) {
+    m_format = format;
+    m_slot_size = AlignUp(size);
+    m_first_timestamp = timestamp;
+  } else if (std::memcmp(&format, &m_format, sizeof(format)) != 0 ||
+             size > m_slot_size) {
+    m_dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  // A full queue or table would drop the frame anyway: skip the copy.
+  if (m_pushed >= m_max_frames ||
+      m_queue.GetDepth() >= m_queue.GetCapacity()) {
+    m_dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  RawSequenceFrame frame;
+  {
+    std::lock_guard<std::mutex> lock(m_free_mutex);
+    if (!m_free_buffers.empty()) {
+      frame.payload = std::move(m_free_buffers.back());
+      m_free_buffers.pop_back();
+    }
+  }
+  if (!frame.payload) {
+    frame.payload = AllocateBuffer(m_slot_size);
+  }
+  std::memcpy(frame.payload.get(), payload, size);
+  // Reused buffers hold an older frame past `size`.
+  std::memset(frame.payload.get() + size, 0, m_slot_size - size);
+  frame.info = info;
+  frame.info.size = size;
+  frame.info.timestampNs =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(timestamp -
+                                                           m_first_timestamp)
+          .count();
+  if (!m_queue.Push(std::move(frame))) {
+    m_dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  ++m_pushed;
+  return true;
+}
+
+std::string RawSequenceWriter::Finish() {
+  m_queue.Close();
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+  return m_error;
+}
+
+uint64_t RawSequenceWriter::GetDroppedFrameCount() const {
+  return m_dropped.load(std::memory_order_relaxed);
+}
+
+void RawSequenceWriter::Run() {
+  for (;;) {
+    RawSequenceFrame frame;
+    if (!m_queue.Pop(frame, std::chrono::milliseconds(100))) {
+      if (m_queue.IsClosed()) break;
+      continue;
+    }
+    if (m_error.empty() && ((m_fd < 0 && !Open()) || !Write(frame))) {
+      std::cerr << "[DEBUG] " << m_error << std::endl;
+    }
+    std::lock_guard<std::mutex> lock(m_free_mutex);
+    m_free_buffers.push_back(std::move(frame.payload));
+  }
+  if (m_fd >= 0) {
+    if (!WriteTable() && m_error.empty()) {
+      m_error = "Failed to finish " + m_file_path;
+    }
+    std::cout << "[DEBUG] Recorded " << m_table.size() << " raw frames to "
+              << m_file_path << std::endl;
+  }
+  Close();
+}
+
+bool RawSequenceWriter::Open() {
+  const int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+  m_fd = open(m_file_path.c_str(), flags | O_DIRECT, 0644);
+  m_direct = m_fd >= 0;
+  if (m_fd < 0 && errno == EINVAL) {
+    // tmpfs and some FUSE file systems refuse direct I/O.
+    m_fd = open(m_file_path.c_str(), flags, 0644);
+  }
+  if (m_fd < 0) {
+    m_error = "Failed to create " + m_file_path + ": " + std::strerror(errno);
+    return false;
+  }
+  m_payload_offset =
+      RAW_SEQUENCE_ALIGNMENT +
+      AlignUp(m_max_frames * sizeof(RawSequenceFrameInfo));
+  m_preallocated = 0;
+  m_table.reserve(m_max_frames);
+  std::cout << "[DEBUG] Recording raw frames to " << m_file_path
+            << (m_direct ? " with" : " without") << " direct I/O"
+            << std::endl;
+  return Preallocate(m_payload_offset +
+                     RAW_SEQUENCE_PREALLOCATE_FRAMES * m_slot_size);
+}
+
+bool RawSequenceWriter::Write(RawSequenceFrame& frame) {
+  frame.info.offset = m_payload_offset + m_table.size() * m_slot_size;
+  const uint64_t end = frame.info.offset + m_slot_size;
+  if (end > m_preallocated &&
+      !Preallocate(end + RAW_SEQUENCE_PREALLOCATE_FRAMES * m_slot_size)) {
+    return false;
+  }
+  if (!WriteAt(frame.payload.get(), m_slot_size, frame.info.offset)) {
+    return false;
+  }
+  m_table.push_back(frame.info);
+  return true;
+}
+
+bool RawSequenceWriter::WriteAt(const uint8_t* data, size_t size,
+                                uint64_t offset) {
+  while (size > 0) {
+    const ssize_t written =
+        pwrite(m_fd, data, size, static_cast<off_t>(offset));
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      // Some file systems accept O_DIRECT at open and refuse it here.
+      if (errno == EINVAL && m_direct) {
+        m_direct = false;
+        fcntl(m_fd, F_SETFL, fcntl(m_fd, F_GETFL) & ~O_DIRECT);
+        std::cout << "[DEBUG] Direct I/O refused, writing " << m_file_path
+                  << " through the page cache" << std::endl;
+        continue;
+      }
+      m_error = "Failed to write " + m_file_path + ": " + std::strerror(errno);
+      return false;
+    }
+    data += written;
+    size -= static_cast<size_t>(written);
+    offset += static_cast<uint64_t>(written);
+  }
+  return true;
+}
+
+bool RawSequenceWriter::Preallocate(uint64_t end) {
+  if (end <= m_preallocated) {
+    return true;
+  }
+  const int result =
+      fallocate(m_fd, 0, static_cast<off_t>(m_preallocated),
+                static_cast<off_t>(end - m_preallocated));
+  // Without fallocate support, blocks are allocated as they are written.
+  if (result != 0 && errno != EOPNOTSUPP) {
+    m_error = "Failed to reserve space for " + m_file_path + ": " +
+              std::strerror(errno);
+    return false;
+  }
+  m_preallocated = end;
+  return true;
+}
+
+bool RawSequenceWriter::WriteTable() {
+  // Header and table share one aligned write ahead of the payloads.
+  RawSequenceBuffer buffer = AllocateBuffer(m_payload_offset);
+  std::memset(buffer.get(), 0, m_payload_offset);
+  RawSequenceHeader header = {};
+  std::memcpy(header.magic, RAW_SEQUENCE_MAGIC, sizeof(header.magic));
+  header.version = RAW_SEQUENCE_VERSION;
+  header.headerSize = sizeof(RawSequenceHeader);
+  header.frameInfoSize = sizeof(RawSequenceFrameInfo);
+  header.pixelType = m_format.pixelType;
+  header.width = m_format.width;
+  header.height = m_format.height;
+  header.paddingX = m_format.paddingX;
+  header.frameRate = m_frame_rate;
+  header.frameCapacity = m_max_frames;
+  header.frameCount = m_table.size();
+  header.tableOffset = RAW_SEQUENCE_ALIGNMENT;
+  header.payloadOffset = m_payload_offset;
+  header.slotSize = m_slot_size;
+  std::memcpy(buffer.get(), &header, sizeof(header));
+  std::memcpy(buffer.get() + header.tableOffset, m_table.data(),
+              m_table.size() * sizeof(RawSequenceFrameInfo));
+  if (!WriteAt(buffer.get(), m_payload_offset, 0)) {
+    return false;
+  }
+  // Give back the slots reserved past the last frame.
+  const uint64_t size = m_payload_offset + m_table.size() * m_slot_size;
+  return ftruncate(m_fd, static_cast<off_t>(size)) == 0 &&
+         fdatasync(m_fd) == 0;
+}
+
+void RawSequenceWriter::Close() {
+  if (m_fd >= 0) {
+    close(m_fd);
+    m_fd = -1;
+  }
+}
@@ -0,0 +1,118 @@
+#ifndef RAW_SEQUENCE_WRITER_H_
+#define RAW_SEQUENCE_WRITER_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "frame_queue.h"
+#include "raw_sequence.h"
+
+// Frames waiting for the disk; later ones are dropped
+#define RAW_SEQUENCE_QUEUE_CAPACITY 8
+// Frames the table has room for when no limit is given (4 MiB of table)
+#define RAW_SEQUENCE_DEFAULT_MAX_FRAMES 65536
+// Payload slots reserved on disk ahead of the frames written
+#define RAW_SEQUENCE_PREALLOCATE_FRAMES 64
+
+// Format shared by every frame of a sequence
+struct RawSequenceFormat {
+  uint32_t pixelType = 0;
+  uint32_t width = 0;
+  uint32_t height = 0;
+  uint32_t paddingX = 0;
+};
+
+struct RawSequenceBufferFree {
+  void operator()(uint8_t* buffer) const { std::free(buffer); }
+};
+
+// Buffer aligned for O_DIRECT transfers
+using RawSequenceBuffer = std::unique_ptr<uint8_t, RawSequenceBufferFree>;
+
+// A frame waiting for the disk, padded to a payload slot.
+struct RawSequenceFrame {
+  RawSequenceBuffer payload;
+  RawSequenceFrameInfo info = {};
+};
+
+// Records raw frames to a raw sequence file (see raw_sequence.h) on its own
+// thread, without compression.
+//
+// Producers copy each frame into an aligned buffer and return at once; the
+// writer thread writes it to its slot with O_DIRECT, keeping recordings out
+// of the page cache, and reserves disk space a few dozen slots ahead so
+// writes never wait on block allocation. The table and header are written
+// by Finish(), which trims the reserved space that was not used.
+class RawSequenceWriter {
+ public:
+  // `maxFrames` sizes the frame table; later frames are dropped.
+  RawSequenceWriter(std::string filePath, double frameRate,
+                    uint64_t maxFrames = RAW_SEQUENCE_DEFAULT_MAX_FRAMES);
+  // Finishes the file if Finish() was not called.
+  ~RawSequenceWriter();
+
+  RawSequenceWriter(const RawSequenceWriter&) = delete;
+  RawSequenceWriter& operator=(const RawSequenceWriter&) = delete;
+
+  const std::string& GetFilePath() const { return m_file_path; }
+
+  // Queues a copy of a `size`-byte frame retrieved at `timestamp`, with the
+  // camera's metadata in `info`. The first frame sets the format; frames of
+  // another are dropped. Returns false when it was dropped, or after
+  // Finish().
+  bool Push(const uint8_t* payload, size_t size,
+            const RawSequenceFormat& format, const RawSequenceFrameInfo& info,
+            std::chrono::steady_clock::time_point timestamp);
+
+  // Writes the queued frames, the table and the header, and closes the
+  // file. Returns the first error, or an empty string.
+  std::string Finish();
+
+  uint64_t GetDroppedFrameCount() const;
+
+ private:
+  const std::string m_file_path;
+  const double m_frame_rate;
+  const uint64_t m_max_frames;
+
+  FrameQueue<RawSequenceFrame> m_queue;
+  std::atomic<uint64_t> m_dropped{0};
+  // Buffers of written frames, reused by Push()
+  std::mutex m_free_mutex;
+  std::vector<RawSequenceBuffer> m_free_buffers;
+  std::thread m_thread;
+
+  // Set by the first Push(), before its frame is queued
+  RawSequenceFormat m_format;
+  uint64_t m_slot_size = 0;
+  // Producer only
+  uint64_t m_pushed = 0;
+  std::chrono::steady_clock::time_point m_first_timestamp;
+
+  // Writer thread only
+  int m_fd = -1;
+  bool m_direct = false;
+  uint64_t m_payload_offset = 0;
+  uint64_t m_preallocated = 0;
+  std::vector<RawSequenceFrameInfo> m_table;
+  // Written by the writer thread, read once it is joined
+  std::string m_error;
+
+  void Run();
+  bool Open();
+  bool Write(RawSequenceFrame& frame);
+  bool WriteAt(const uint8_t* data, size_t size, uint64_t offset);
+  bool Preallocate(uint64_t end);
+  bool WriteTable();
+  void Close();
+};
+
+#endif  // RAW_SEQUENCE_WRITER_H_
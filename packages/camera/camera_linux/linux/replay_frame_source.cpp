@@ -0,0 +1,90 @@
+#include "replay_frame_source.h"
+
+#include <stdexcept>
+#include <thread>
+
+ReplayFrameSource::ReplayFrameSource(const std::string& filePath,
+                                     bool realTime)
+    : m_reader(std::make_shared<RawSequenceReader>(filePath)),
+      m_real_time(realTime) {
+  if (m_reader->GetFrameCount() == 0) {
+    throw std::runtime_error(filePath + " holds no frames");
+  }
+}
+
+void ReplayFrameSource::Start() {
+  m_next_index = 0;
+  m_frame_id = 0;
+  m_loop_start = std::chrono::steady_clock::now();
+  m_grabbing.store(true);
+}
+
+void ReplayFrameSource::Stop() {
+  m_grabbing.store(false);
+}
+
+bool ReplayFrameSource::IsGrabbing() const {
+  return m_grabbing.load();
+}
+
+int ReplayFrameSource::GetWidth() {
+  return static_cast<int>(m_reader->GetHeader().width);
+}
+
+int ReplayFrameSource::GetHeight() {
+  return static_cast<int>(m_reader->GetHeader().height);
+}
+
+size_t ReplayFrameSource::GetPayloadSize() {
+  return static_cast<size_t>(m_reader->GetHeader().slotSize);
+}
+
+double ReplayFrameSource::GetFrameRate() {
+  return m_real_time ? m_reader->GetHeader().frameRate : 0.0;
+}
+
+bool ReplayFrameSource::SetPixelType(Pylon::EPixelType pixelType) {
+  return static_cast<uint32_t>(pixelType) == m_reader->GetHeader().pixelType;
+}
+
+bool ReplayFrameSource::Retrieve(SourceFrame& frame,
+                                 std::chrono::milliseconds timeout) {
+  if (!m_grabbing.load()) {
+    return false;
+  }
+  if (m_next_index >= m_reader->GetFrameCount()) {
+    // The first frame comes back a frame period after the last.
+    const double frameRate = m_reader->GetHeader().frameRate;
+    m_next_index = 0;
+    m_loop_start = std::chrono::steady_clock::now();
+    if (frameRate > 0.0) {
+      m_loop_start += std::chrono::duration_cast<
+          std::chrono::steady_clock::duration>(
+          std::chrono::duration<double>(1.0 / frameRate));
+    }
+  }
+  const RawSequenceFrameInfo& info = m_reader->GetFrameInfo(m_next_index);
+  if (m_real_time) {
+    const auto due = m_loop_start + std::chrono::nanoseconds(info.timestampNs);
+    if (due - std::chrono::steady_clock::now() > timeout) {
+      std::this_thread::sleep_for(timeout);
+      return false;
+    }
+    std::this_thread::sleep_until(due);
+  }
+
+  const RawSequenceHeader& header = m_reader->GetHeader();
+  frame.owner = m_reader;
+  frame.pixels = m_reader->GetPayload(m_next_index);
+  frame.size = static_cast<size_t>(info.size);
+  frame.pixelType = static_cast<Pylon::EPixelType>(header.pixelType);
+  frame.width = static_cast<int>(header.width);
+  frame.height = static_cast<int>(header.height);
+  frame.paddingX = header.paddingX;
+  frame.frameId = m_frame_id++;
+  frame.sequencerSet = info.sequencerSet;
+  frame.exposureUs = info.exposureUs;
+  frame.gainDb = info.gainDb;
+  ++m_next_index;
+  return true;
+}
@@ -0,0 +1,50 @@
+#ifndef REPLAY_FRAME_SOURCE_H_
+#define REPLAY_FRAME_SOURCE_H_
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "frame_source.h"
+#include "raw_sequence_reader.h"
+
+// Frames of a recorded raw sequence (see raw_sequence.h), played in a loop
+// with the exposure, gain and sequencer set they were recorded with, so
+// pipeline changes can be compared on exactly the same input.
+//
+// In real time, frames are delivered at the times they were recorded;
+// otherwise as fast as they are retrieved. Only the recorded pixel format
+// is available. Replaying a bracketed recording needs the bracket it was
+// recorded with. Throws std::runtime_error when the file cannot be read.
+class ReplayFrameSource : public FrameSource {
+ public:
+  ReplayFrameSource(const std::string& filePath, bool realTime);
+
+  void Start() override;
+  void Stop() override;
+  bool IsGrabbing() const override;
+
+  int GetWidth() override;
+  int GetHeight() override;
+  size_t GetPayloadSize() override;
+  double GetFrameRate() override;
+  bool SetPixelType(Pylon::EPixelType pixelType) override;
+
+  bool Retrieve(SourceFrame& frame,
+                std::chrono::milliseconds timeout) override;
+
+ private:
+  // Shared with the frames handed out, so a replay can be stopped and
+  // released while the pipeline still holds some.
+  const std::shared_ptr<const RawSequenceReader> m_reader;
+  const bool m_real_time;
+  std::atomic<bool> m_grabbing{false};
+
+  // Acquisition thread only
+  uint64_t m_next_index = 0;
+  int64_t m_frame_id = 0;
+  // When the current pass through the file started
+  std::chrono::steady_clock::time_point m_loop_start;
+};
+
+#endif  // REPLAY_FRAME_SOURCE_H_
@@ -0,0 +1,205 @@
+#include "still_encoder.h"
+
+#include <glib.h>
+
+#include <algorithm>
+#include <cctype>
+#include <memory>
+
+#include <opencv2/opencv.hpp>
+
+static bool IsJpegPath(const std::string& filePath) {
+  const size_t dot = filePath.find_last_of('.');
+  if (dot == std::string::npos) {
+    return false;
+  }
+  std::string extension = filePath.substr(dot + 1);
+  std::transform(extension.begin(), extension.end(), extension.begin(),
+                 [](unsigned char c) { return std::tolower(c); });
+  return extension == "jpg" || extension == "jpeg";
+}
+
+// Writes 8-bit rows: straight to libjpeg-turbo for JPEGs, through OpenCV
+// for any other format.
+static bool WritePixels(const uint8_t* pixels, int width, int height,
+                        size_t bytesPerRow, JpegPixelFormat format,
+                        const std::string& filePath,
+                        const JpegSettings& settings, size_t stripCount) {
+  if (IsJpegPath(filePath)) {
+    return WriteJpeg(pixels, width, height, bytesPerRow, format, settings,
+                     stripCount, filePath);
+  }
+  const int type = format == JpegPixelFormat::Gray  ? CV_8UC1
+                   : format == JpegPixelFormat::Rgb ? CV_8UC3
+                                                    : CV_8UC4;
+  cv::Mat mat(height, width, type, const_cast<uint8_t*>(pixels), bytesPerRow);
+  if (format == JpegPixelFormat::Gray) {
+    return cv::imwrite(filePath, mat);
+  }
+  cv::Mat bgr;
+  cv::cvtColor(mat, bgr,
+               format == JpegPixelFormat::Rgb ? cv::COLOR_RGB2BGR
+                                              : cv::COLOR_RGBA2BGR);
+  return cv::imwrite(filePath, bgr);
+}
+
+bool WriteImage(const Pylon::IImage& source, const std::string& filePath,
+                const JpegSettings& settings, size_t stripCount) {
+  Pylon::CPylonImage converted;
+  const Pylon::IImage* image = &source;
+  // Stills are written 8-bit: let Pylon convert anything that is not 8-bit
+  // mono, RGB or one of the mosaics demosaiced below.
+  const Pylon::EPixelType sourceType = source.GetPixelType();
+  if (sourceType != Pylon::PixelType_Mono8 &&
+      sourceType != Pylon::PixelType_RGB8packed &&
+      sourceType != Pylon::PixelType_BayerRG8 &&
+      sourceType != Pylon::PixelType_BayerGB8) {
+    if (!Pylon::CImageFormatConverter::IsSupportedInputFormat(sourceType)) {
+      return false;
+    }
+    try {
+      Pylon::CImageFormatConverter converter;
+      converter.OutputPixelFormat = Pylon::IsMonoImage(sourceType)
+                                        ? Pylon::PixelType_Mono8
+                                        : Pylon::PixelType_RGB8packed;
+      converter.Convert(converted, source);
+    } catch (const Pylon::GenericException&) {
+      return false;
+    }
+    image = &converted;
+  }
+  const int width = static_cast<int>(image->GetWidth());
+  const int height = static_cast<int>(image->GetHeight());
+  size_t stride = 0;
+  if (!image->GetStride(stride)) {
+    stride = image->GetImageSize() / height;
+  }
+  const uint8_t* pixels = static_cast<const uint8_t*>(image->GetBuffer());
+
+  // OpenCV names Bayer patterns after the second row: Basler's RG is
+  // OpenCV's BG. Mosaics are the only frames needing a copy.
+  const Pylon::EPixelType pixelType = image->GetPixelType();
+  if (pixelType == Pylon::PixelType_BayerRG8 ||
+      pixelType == Pylon::PixelType_BayerGB8) {
+    cv::Mat mosaic(height, width, CV_8UC1, const_cast<uint8_t*>(pixels),
+                   stride);
+    cv::Mat rgb;
+    cv::cvtColor(mosaic, rgb,
+                 pixelType == Pylon::PixelType_BayerRG8
+                     ? cv::COLOR_BayerBG2RGB
+                     : cv::COLOR_BayerGR2RGB);
+    return WritePixels(rgb.data, width, height, static_cast<size_t>(rgb.step),
+                       JpegPixelFormat::Rgb, filePath, settings, stripCount);
+  }
+  return WritePixels(pixels, width, height, stride,
+                     pixelType == Pylon::PixelType_Mono8
+                         ? JpegPixelFormat::Gray
+                         : JpegPixelFormat::Rgb,
+                     filePath, settings, stripCount);
+}
+
+bool WriteStill(StillFrame& still, const std::string& filePath,
+                const JpegSettings& settings, size_t stripCount) {
+  if (still.raw) {
+    Pylon::CPylonImage image;
+    image.AttachUserBuffer(still.pixels.data(), still.pixels.size(),
+                           still.pixelType, still.width, still.height,
+                           still.paddingX);
+    return WriteImage(image, filePath, settings, stripCount);
+  }
+  return WritePixels(still.pixels.data(), still.width, still.height,
+                     still.bytesPerRow, JpegPixelFormat::Rgba, filePath,
+                     settings, stripCount);
+}
+
+StillEncoder::StillEncoder(size_t threadCount, size_t maxQueuedBytes)
+    : m_max_queued_bytes(maxQueuedBytes),
+      m_strip_count(std::max<size_t>(
+          1, std::thread::hardware_concurrency() / std::max<size_t>(
+                                                     1, threadCount))) {
+  for (size_t i = 0; i < threadCount; ++i) {
+    m_workers.emplace_back(&StillEncoder::Run, this);
+  }
+}
+
+StillEncoder::~StillEncoder() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopping = true;
+  }
+  m_condition.notify_all();
+  for (std::thread& worker : m_workers) {
+    worker.join();
+  }
+}
+
+bool StillEncoder::HasRoomFor(size_t frameBytes) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_queued_bytes == 0 ||
+         m_queued_bytes + frameBytes <= m_max_queued_bytes;
+}
+
+void StillEncoder::Submit(std::future<StillFrame> frame, size_t frameBytes,
+                          std::string filePath,
+                          const JpegSettings& settings,
+                          std::chrono::milliseconds timeout,
+                          StillCallback done) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_jobs.push_back({std::move(frame), frameBytes, std::move(filePath),
+                      settings, timeout, std::move(done)});
+    m_queued_bytes += frameBytes;
+  }
+  m_condition.notify_one();
+}
+
+void StillEncoder::Run() {
+  for (;;) {
+    Job job;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_condition.wait(lock, [this] { return m_stopping || !m_jobs.empty(); });
+      if (m_jobs.empty()) {
+        return;
+      }
+      job = std::move(m_jobs.front());
+      m_jobs.pop_front();
+    }
+
+    std::string error;
+    try {
+      if (job.frame.wait_for(job.timeout) != std::future_status::ready) {
+        error = "Timed out waiting for a frame";
+      } else {
+        StillFrame still = job.frame.get();
+        if (!WriteStill(still, job.filePath, job.settings, m_strip_count)) {
+          error = "Failed to write the picture";
+        }
+      }
+    } catch (const Pylon::GenericException& e) {
+      error = e.GetDescription();
+    } catch (const std::exception& e) {
+      error = e.what();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_queued_bytes -= job.frameBytes;
+    }
+    Complete(std::move(job.done), std::move(error));
+  }
+}
+
+void StillEncoder::Complete(StillCallback done, std::string error) {
+  struct Completion {
+    StillCallback done;
+    std::string error;
+  };
+  g_idle_add(
+      [](gpointer data) -> gboolean {
+        std::unique_ptr<Completion> completion(static_cast<Completion*>(data));
+        completion->done(completion->error);
+        return G_SOURCE_REMOVE;
+      },
+      new Completion{std::move(done), std::move(error)});
+}
@@ -0,0 +1,85 @@
+#ifndef STILL_ENCODER_H_
+#define STILL_ENCODER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "jpeg_encoder.h"
+#include "zsl_ring.h"
+
+#define STILL_ENCODER_THREAD_COUNT 2
+// Frame bytes pictures in flight may hold; one is always accepted
+#define STILL_ENCODER_MAX_QUEUED_BYTES (256 * 1024 * 1024)
+
+// Writes a camera frame as an 8-bit picture, a JPEG encoded in
+// `stripCount` strips for .jpg and .jpeg paths. Returns false when it
+// cannot.
+bool WriteImage(const Pylon::IImage& source, const std::string& filePath,
+                const JpegSettings& settings, size_t stripCount);
+
+// Writes a still from the zero-shutter-lag ring. Returns false when it
+// cannot.
+bool WriteStill(StillFrame& still, const std::string& filePath,
+                const JpegSettings& settings, size_t stripCount);
+
+// Runs on the GLib main loop once a picture is written, with an empty
+// `error` on success.
+using StillCallback = std::function<void(const std::string& error)>;
+
+// Bounded pool of threads writing pictures, so JPEG encodes of large
+// frames never run on the GTK main thread.
+//
+// Each picture waits on its worker for its frame, then is written and
+// reported back on the main loop. The bytes of the frames in flight are
+// capped: callers check HasRoomFor() before submitting. Cores the workers
+// leave idle encode strips of each JPEG in parallel.
+class StillEncoder {
+ public:
+  StillEncoder(size_t threadCount, size_t maxQueuedBytes);
+  // Writes the pictures already submitted, then stops the workers.
+  ~StillEncoder();
+
+  StillEncoder(const StillEncoder&) = delete;
+  StillEncoder& operator=(const StillEncoder&) = delete;
+
+  // Whether a frame of `frameBytes` fits under the cap.
+  bool HasRoomFor(size_t frameBytes) const;
+
+  // Writes `frame` to `filePath` once it is ready, giving up after
+  // `timeout`. `frameBytes` is counted against the cap until then.
+  void Submit(std::future<StillFrame> frame, size_t frameBytes,
+              std::string filePath, const JpegSettings& settings,
+              std::chrono::milliseconds timeout, StillCallback done);
+
+ private:
+  struct Job {
+    std::future<StillFrame> frame;
+    size_t frameBytes = 0;
+    std::string filePath;
+    JpegSettings settings;
+    std::chrono::milliseconds timeout{0};
+    StillCallback done;
+  };
+
+  const size_t m_max_queued_bytes;
+  const size_t m_strip_count;
+  mutable std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::deque<Job> m_jobs;
+  size_t m_queued_bytes = 0;
+  bool m_stopping = false;
+  std::vector<std::thread> m_workers;
+
+  void Run();
+  static void Complete(StillCallback done, std::string error);
+};
+
+#endif  // STILL_ENCODER_H_
@@ -0,0 +1,193 @@
+#include "synthetic_frame_source.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+// Bits per pixel of the formats the scene can be rendered in, 0 for others
+static int GetBitsPerPixel(Pylon::EPixelType pixelType) {
+  switch (pixelType) {
+    case Pylon::PixelType_Mono8:
+    case Pylon::PixelType_BayerRG8:
+    case Pylon::PixelType_BayerGB8:
+      return 8;
+    case Pylon::PixelType_Mono12p:
+    case Pylon::PixelType_BayerRG12p:
+    case Pylon::PixelType_BayerGB12p:
+      return 12;
+    case Pylon::PixelType_RGB8packed:
+      return 24;
+    default:
+      return 0;
+  }
+}
+
+// Colour channel (0 red, 1 green, 2 blue) a Bayer sensor samples at a
+// pixel, or -1 for mono.
+static int GetBayerChannel(Pylon::EPixelType pixelType, int x, int y) {
+  const int cell = ((y & 1) << 1) | (x & 1);
+  switch (pixelType) {
+    case Pylon::PixelType_BayerRG8:
+    case Pylon::PixelType_BayerRG12p: {
+      static const int kRg[4] = {0, 1, 1, 2};
+      return kRg[cell];
+    }
+    case Pylon::PixelType_BayerGB8:
+    case Pylon::PixelType_BayerGB12p: {
+      static const int kGb[4] = {1, 2, 0, 1};
+      return kGb[cell];
+    }
+    default:
+      return -1;
+  }
+}
+
+static size_t GetRowSize(int width, Pylon::EPixelType pixelType) {
+  return (static_cast<size_t>(width) * GetBitsPerPixel(pixelType) + 7) / 8;
+}
+
+SyntheticFrameSource::SyntheticFrameSource(int width, int height,
+                                           double frameRate)
+    : m_width(width), m_height(height), m_frame_rate(frameRate) {}
+
+void SyntheticFrameSource::Start() {
+  m_frame_id = 0;
+  m_cache.clear();
+  m_next_frame_time = std::chrono::steady_clock::now();
+  m_grabbing.store(true);
+}
+
+void SyntheticFrameSource::Stop() {
+  m_grabbing.store(false);
+}
+
+bool SyntheticFrameSource::IsGrabbing() const {
+  return m_grabbing.load();
+}
+
+size_t SyntheticFrameSource::GetPayloadSize() {
+  return GetRowSize(m_width, m_pixel_type) * m_height;
+}
+
+bool SyntheticFrameSource::SetPixelType(Pylon::EPixelType pixelType) {
+  if (GetBitsPerPixel(pixelType) == 0) {
+    return false;
+  }
+  m_pixel_type = pixelType;
+  return true;
+}
+
+void SyntheticFrameSource::Trigger(double exposureUs, double gainDb) {
+  m_exposure_us = exposureUs;
+  if (!std::isnan(gainDb)) {
+    m_gain_db = gainDb;
+  }
+}
+
+bool SyntheticFrameSource::Retrieve(SourceFrame& frame,
+                                    std::chrono::milliseconds timeout) {
+  if (!m_grabbing.load()) {
+    return false;
+  }
+  if (m_frame_rate > 0.0) {
+    const auto now = std::chrono::steady_clock::now();
+    if (m_next_frame_time - now > timeout) {
+      std::this_thread::sleep_for(timeout);
+      return false;
+    }
+    std::this_thread::sleep_until(m_next_frame_time);
+    const auto period = std::chrono::duration_cast<
+        std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(1.0 / m_frame_rate));
+    // A consumer that fell behind gets the next frame a period from now,
+    // not a catch-up burst.
+    m_next_frame_time = std::max(m_next_frame_time + period, now);
+  }
+
+  auto cached = std::find_if(m_cache.begin(), m_cache.end(),
+                             [this](const CachedFrame& entry) {
+                               return entry.exposureUs == m_exposure_us &&
+                                      entry.gainDb == m_gain_db;
+                             });
+  if (cached == m_cache.end()) {
+    if (m_cache.size() >= SYNTHETIC_FRAME_CACHE_SIZE) {
+      m_cache.erase(m_cache.begin());
+    }
+    m_cache.push_back({m_exposure_us, m_gain_db,
+                       Render(m_exposure_us, m_gain_db)});
+    cached = m_cache.end() - 1;
+  }
+
+  frame.owner = cached->pixels;
+  frame.pixels = cached->pixels->data();
+  frame.size = cached->pixels->size();
+  frame.pixelType = m_pixel_type;
+  frame.width = m_width;
+  frame.height = m_height;
+  frame.paddingX = 0;
+  frame.frameId = m_frame_id++;
+  frame.sequencerSet = -1;
+  frame.exposureUs = m_exposure_us;
+  frame.gainDb = m_gain_db;
+  return true;
+}
+
+std::shared_ptr<const std::vector<uint8_t>> SyntheticFrameSource::Render(
+    double exposureUs, double gainDb) const {
+  // Radiance doubles every sixth of the width, from 1/16 to 4 times the
+  // mid-grey that reads half scale at the reference exposure.
+  const double scale = 0.5 * exposureUs / SYNTHETIC_REFERENCE_EXPOSURE_US *
+                       std::pow(10.0, gainDb / 20.0);
+  std::vector<double> columns(m_width);
+  for (int x = 0; x < m_width; ++x) {
+    columns[x] = scale * std::exp2(-4.0 + 6.0 * x / m_width);
+  }
+  static const double kBars[6][3] = {{1.0, 0.1, 0.1}, {0.1, 1.0, 0.1},
+                                     {0.1, 0.1, 1.0}, {0.1, 1.0, 1.0},
+                                     {1.0, 0.1, 1.0}, {1.0, 1.0, 0.1}};
+  const int maxValue = GetBitsPerPixel(m_pixel_type) == 12 ? 4095 : 255;
+  // Sample of channel `c` (-1 for luminance) at a pixel, at full scale
+  auto sample = [&](int x, int y, int c) {
+    double value = columns[x];
+    if (y < m_height / 3) {
+      const double* bar = kBars[x * 6 / m_width];
+      value *= c < 0 ? (bar[0] + bar[1] + bar[2]) / 3.0 : bar[c];
+    } else if (y >= m_height * 2 / 3 && ((x >> 3) + (y >> 3)) % 2 == 0) {
+      value *= 0.25;
+    }
+    return static_cast<int>(
+        std::lround(std::clamp(value, 0.0, 1.0) * maxValue));
+  };
+
+  const size_t rowSize = GetRowSize(m_width, m_pixel_type);
+  auto pixels = std::make_shared<std::vector<uint8_t>>(rowSize * m_height);
+  for (int y = 0; y < m_height; ++y) {
+    uint8_t* row = pixels->data() + y * rowSize;
+    if (m_pixel_type == Pylon::PixelType_RGB8packed) {
+      for (int x = 0; x < m_width; ++x) {
+        for (int c = 0; c < 3; ++c) {
+          row[x * 3 + c] = static_cast<uint8_t>(sample(x, y, c));
+        }
+      }
+    } else if (maxValue == 255) {
+      for (int x = 0; x < m_width; ++x) {
+        row[x] = static_cast<uint8_t>(
+            sample(x, y, GetBayerChannel(m_pixel_type, x, y)));
+      }
+    } else {
+      // Packed LSB first: pixel x occupies bits 12x to 12x + 11.
+      for (int x = 0; x < m_width; ++x) {
+        const int value = sample(x, y, GetBayerChannel(m_pixel_type, x, y));
+        uint8_t* bytes = row + x * 3 / 2;
+        if (x % 2 == 0) {
+          bytes[0] = static_cast<uint8_t>(value);
+          bytes[1] = static_cast<uint8_t>(value >> 8);
+        } else {
+          bytes[0] = static_cast<uint8_t>((bytes[0] & 0x0F) | (value << 4));
+          bytes[1] = static_cast<uint8_t>(value >> 4);
+        }
+      }
+    }
+  }
+  return pixels;
+}
@@ -0,0 +1,68 @@
+#ifndef SYNTHETIC_FRAME_SOURCE_H_
+#define SYNTHETIC_FRAME_SOURCE_H_
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "frame_source.h"
+
+// Exposure at which the scene's mid-grey patch reads half scale
+#define SYNTHETIC_REFERENCE_EXPOSURE_US 10000.0
+// Frames kept rendered: one per exposure of the largest bracket
+#define SYNTHETIC_FRAME_CACHE_SIZE 8
+
+// Generated frames of a fixed test scene, for running the pipeline without
+// a camera.
+//
+// The scene spans six stops left to right, with saturated colour bars
+// above and a fine checkerboard below, so exposure brackets, fusion, tone
+// mapping and demosaicing all have something to work on. Each frame is
+// rendered in the requested raw format at the exposure and gain last
+// triggered; rendered frames are cached, so a running bracket costs no
+// CPU time beyond the pipeline's own.
+class SyntheticFrameSource : public FrameSource {
+ public:
+  // `frameRate` 0 delivers frames as fast as they are retrieved.
+  SyntheticFrameSource(int width, int height, double frameRate);
+
+  void Start() override;
+  void Stop() override;
+  bool IsGrabbing() const override;
+
+  int GetWidth() override { return m_width; }
+  int GetHeight() override { return m_height; }
+  size_t GetPayloadSize() override;
+  double GetFrameRate() override { return m_frame_rate; }
+  // Mono8, Mono12p, RGB8 and the RG/GB Bayer patterns at 8 and 12 bits
+  bool SetPixelType(Pylon::EPixelType pixelType) override;
+
+  void Trigger(double exposureUs, double gainDb) override;
+  bool Retrieve(SourceFrame& frame,
+                std::chrono::milliseconds timeout) override;
+
+ private:
+  struct CachedFrame {
+    double exposureUs = 0.0;
+    double gainDb = 0.0;
+    std::shared_ptr<const std::vector<uint8_t>> pixels;
+  };
+
+  const int m_width;
+  const int m_height;
+  const double m_frame_rate;
+  Pylon::EPixelType m_pixel_type = Pylon::PixelType_BayerRG8;
+  std::atomic<bool> m_grabbing{false};
+
+  // Acquisition thread only
+  double m_exposure_us = SYNTHETIC_REFERENCE_EXPOSURE_US;
+  double m_gain_db = 0.0;
+  int64_t m_frame_id = 0;
+  std::chrono::steady_clock::time_point m_next_frame_time;
+  std::vector<CachedFrame> m_cache;
+
+  std::shared_ptr<const std::vector<uint8_t>> Render(double exposureUs,
+                                                     double gainDb) const;
+};
+
+#endif  // SYNTHETIC_FRAME_SOURCE_H_
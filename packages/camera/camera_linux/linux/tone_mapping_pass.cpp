@@ -0,0 +1,277 @@
+#include "tone_mapping_pass.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+#include "gl_utils.h"
+
+// Log2 luminance is stored normalized to this range, so an R8 fallback works
+// too (at roughly 0.06 EV per step).
+static const char* const kLogLuminanceRange = R"(
+  const float kMinLogLuminance = -14.0;
+  const float kMaxLogLuminance = 2.0;
+
+  // Inputs hold linear sensor values, as uploaded and fused.
+  float luma(vec3 color) {
+    return dot(color, vec3(0.2126, 0.7152, 0.0722));
+  }
+)";
+
+static const char* const kLuminanceFragmentShader = R"(
+  in vec2 TexCoords;
+  out float logLuminance;
+
+  uniform sampler2D image;
+  // A quarter of a luminance texel, in input texture coordinates
+  uniform vec2 tapOffset;
+
+  float logLuma(vec2 uv) {
+    return log2(luma(textureLod(image, uv, 0.0).rgb) + 1e-4);
+  }
+
+  void main() {
+    float sum = logLuma(TexCoords + vec2(-tapOffset.x, -tapOffset.y)) +
+                logLuma(TexCoords + vec2(tapOffset.x, -tapOffset.y)) +
+                logLuma(TexCoords + vec2(-tapOffset.x, tapOffset.y)) +
+                logLuma(TexCoords + vec2(tapOffset.x, tapOffset.y));
+    logLuminance = clamp((0.25 * sum - kMinLogLuminance) /
+                             (kMaxLogLuminance - kMinLogLuminance),
+                         0.0, 1.0);
+  }
+)";
+
+static const char* const kAdaptFragmentShader = R"(
+  out float adapted;
+
+  uniform sampler2D luminance;
+  uniform sampler2D previous;
+  uniform float topLevel;
+  uniform float blend;
+
+  void main() {
+    // The 1x1 mip holds the mean log luminance, i.e. the log-average.
+    float current = textureLod(luminance, vec2(0.5), topLevel).r;
+    adapted = mix(texelFetch(previous, ivec2(0), 0).r, current, blend);
+  }
+)";
+
+static const char* const kToneMappingFragmentShader = R"(
+  in vec2 TexCoords;
+  out vec4 FragColor;
+
+  uniform sampler2D image;
+  uniform sampler2D adapted;
+  uniform int toneOperator;
+  uniform float key;
+  uniform float whitePoint;
+
+  void main() {
+    float logAverage = mix(kMinLogLuminance, kMaxLogLuminance,
+                           texelFetch(adapted, ivec2(0), 0).r);
+    float average = exp2(logAverage);
+
+    // Krawczyk's automatic key, with 1.0 taken as 100 cd/m^2: dark scenes
+    // stay darker than bright ones instead of all landing on middle grey.
+    float sceneKey = key > 0.0
+        ? key
+        : 1.03 - 2.0 / (2.0 + log(100.0 * average + 1.0) / log(10.0));
+
+    vec3 color = max(textureLod(image, TexCoords, 0.0).rgb, 0.0);
+    color *= sceneKey / average;
+
+    // ToneMappingOperator::Reinhard
+    if (toneOperator == 1) {
+      // Extended Reinhard on luminance, preserving the hue.
+      float l = luma(color);
+      float mapped = l * (1.0 + l / (whitePoint * whitePoint)) / (1.0 + l);
+      color *= mapped / max(l, 1e-6);
+    } else {
+      // ACES filmic curve, Narkowicz's fit.
+      color = (color * (2.51 * color + 0.03)) /
+              (color * (2.43 * color + 0.59) + 0.14);
+    }
+    FragColor = vec4(pow(clamp(color, 0.0, 1.0), vec3(1.0 / 2.2)), 1.0);
+  }
+)";
+
+static GLuint CreateToneMappingProgram(const char* fragmentBody) {
+  const std::string fragmentSrc = std::string(
+                                      "#version 300 es\n"
+                                      "precision highp float;\n") +
+                                  kLogLuminanceRange + fragmentBody;
+  return CreateShaderProgram(kFullscreenVertexShader, fragmentSrc.c_str());
+}
+
+static GLuint CreateLuminanceTexture(GLsizei size, GLsizei levels) {
+  GLuint texture = 0;
+  glGenTextures(1, &texture);
+  glBindTexture(GL_TEXTURE_2D, texture);
+  glTexStorage2D(GL_TEXTURE_2D, levels,
+                 CanRenderToHalfFloat() ? GL_R16F : GL_R8, size, size);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                  levels > 1 ? GL_LINEAR_MIPMAP_NEAREST : GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER,
+                  levels > 1 ? GL_LINEAR : GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  glBindTexture(GL_TEXTURE_2D, 0);
+  return texture;
+}
+
+ToneMappingPass::ToneMappingPass() {
+  m_luminance_program = CreateToneMappingProgram(kLuminanceFragmentShader);
+  m_adapt_program = CreateToneMappingProgram(kAdaptFragmentShader);
+  m_tone_mapping_program = CreateToneMappingProgram(kToneMappingFragmentShader);
+  glGenVertexArrays(1, &m_vao);
+  glGenFramebuffers(1, &m_fbo);
+
+  glUseProgram(m_luminance_program);
+  glUniform1i(glGetUniformLocation(m_luminance_program, "image"), 0);
+  glUniform2f(glGetUniformLocation(m_luminance_program, "tapOffset"),
+              0.25f / TONE_MAPPING_LUMINANCE_SIZE,
+              0.25f / TONE_MAPPING_LUMINANCE_SIZE);
+  glUseProgram(m_adapt_program);
+  glUniform1i(glGetUniformLocation(m_adapt_program, "luminance"), 0);
+  glUniform1i(glGetUniformLocation(m_adapt_program, "previous"), 1);
+  glUniform1f(glGetUniformLocation(m_adapt_program, "topLevel"),
+              std::log2(static_cast<float>(TONE_MAPPING_LUMINANCE_SIZE)));
+  glUseProgram(m_tone_mapping_program);
+  glUniform1i(glGetUniformLocation(m_tone_mapping_program, "image"), 0);
+  glUniform1i(glGetUniformLocation(m_tone_mapping_program, "adapted"), 1);
+  glUseProgram(0);
+
+  const GLsizei levels =
+      static_cast<GLsizei>(std::log2(TONE_MAPPING_LUMINANCE_SIZE)) + 1;
+  m_luminance = CreateLuminanceTexture(TONE_MAPPING_LUMINANCE_SIZE, levels);
+  m_adapted[0] = CreateLuminanceTexture(1, 1);
+  m_adapted[1] = CreateLuminanceTexture(1, 1);
+
+  std::cout << "[DEBUG] Created tone mapping programs: " << m_luminance_program
+            << ", " << m_adapt_program << ", " << m_tone_mapping_program
+            << std::endl;
+}
+
+ToneMappingPass::~ToneMappingPass() {
+  GLuint textures[] = {m_input, m_luminance, m_adapted[0], m_adapted[1]};
+  glDeleteTextures(4, textures);
+  glDeleteFramebuffers(1, &m_fbo);
+  glDeleteVertexArrays(1, &m_vao);
+  glDeleteProgram(m_tone_mapping_program);
+  glDeleteProgram(m_adapt_program);
+  glDeleteProgram(m_luminance_program);
+}
+
+void ToneMappingPass::Resize(GLsizei width, GLsizei height) {
+  if (m_input && width == m_width && height == m_height) {
+    return;
+  }
+  m_format = ResolveRenderFormat(m_format);
+  glDeleteTextures(1, &m_input);
+  glGenTextures(1, &m_input);
+  glBindTexture(GL_TEXTURE_2D, m_input);
+  glTexStorage2D(GL_TEXTURE_2D, 1, m_format, width, height);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  m_width = width;
+  m_height = height;
+  m_reset_adaptation = true;
+  std::cout << "[DEBUG] Allocated " << GetFormatName(m_format)
+            << " tone mapping input texture ID: " << m_input << std::endl;
+}
+
+void ToneMappingPass::SetInputFormat(GLenum format) {
+  if (format != m_format) {
+    glDeleteTextures(1, &m_input);
+    m_input = 0;
+    m_format = format;
+  }
+}
+
+void ToneMappingPass::SetOperator(ToneMappingOperator toneOperator) {
+  m_operator = toneOperator;
+}
+
+void ToneMappingPass::SetKey(float key) { m_key = key; }
+
+void ToneMappingPass::SetAdaptationTime(float seconds) {
+  m_adaptation_time = seconds;
+}
+
+void ToneMappingPass::SetWhitePoint(float whitePoint) {
+  m_white_point = whitePoint;
+}
+
+void ToneMappingPass::Render(GLuint outputTexture, float elapsedSeconds,
+                             GpuTimer& timer) {
+  if (!m_input) {
+    return;
+  }
+  glBindVertexArray(m_vao);
+  glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+
+  // 1. Log luminance, averaged down to 1x1 by the mip chain.
+  timer.Begin("tone_luminance");
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                         m_luminance, 0);
+  glViewport(0, 0, TONE_MAPPING_LUMINANCE_SIZE, TONE_MAPPING_LUMINANCE_SIZE);
+  glUseProgram(m_luminance_program);
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, m_input);
+  glDrawArrays(GL_TRIANGLES, 0, 3);
+
+  glBindTexture(GL_TEXTURE_2D, m_luminance);
+  glGenerateMipmap(GL_TEXTURE_2D);
+
+  // 2. Ease the adapted luminance toward the new average.
+  float blend = 1.0f;
+  if (!m_reset_adaptation && m_adaptation_time > 0.0f) {
+    blend = 1.0f - std::exp(-std::max(elapsedSeconds, 0.0f) /
+                            m_adaptation_time);
+  }
+  m_reset_adaptation = false;
+  const int previous = m_adapted_index;
+  m_adapted_index = 1 - m_adapted_index;
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                         m_adapted[m_adapted_index], 0);
+  glViewport(0, 0, 1, 1);
+  glUseProgram(m_adapt_program);
+  glUniform1f(glGetUniformLocation(m_adapt_program, "blend"), blend);
+  glActiveTexture(GL_TEXTURE1);
+  glBindTexture(GL_TEXTURE_2D, m_adapted[previous]);
+  glDrawArrays(GL_TRIANGLES, 0, 3);
+  timer.End();
+
+  // 3. Scale to the key and apply the operator.
+  timer.Begin("tone_mapping");
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                         outputTexture, 0);
+  glViewport(0, 0, m_width, m_height);
+  glUseProgram(m_tone_mapping_program);
+  glUniform1i(glGetUniformLocation(m_tone_mapping_program, "toneOperator"),
+              static_cast<GLint>(m_operator));
+  glUniform1f(glGetUniformLocation(m_tone_mapping_program, "key"), m_key);
+  glUniform1f(glGetUniformLocation(m_tone_mapping_program, "whitePoint"),
+              m_white_point);
+  glBindTexture(GL_TEXTURE_2D, m_adapted[m_adapted_index]);
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, m_input);
+  glDrawArrays(GL_TRIANGLES, 0, 3);
+  timer.End();
+
+  // Cleanup
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0,
+                         0);
+  glActiveTexture(GL_TEXTURE1);
+  glBindTexture(GL_TEXTURE_2D, 0);
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, 0);
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  glBindVertexArray(0);
+  glUseProgram(0);
+}
@@ -0,0 +1,85 @@
+#ifndef TONE_MAPPING_PASS_H_
+#define TONE_MAPPING_PASS_H_
+
+#include <GLES3/gl3.h>
+
+#include "gpu_timer.h"
+
+// Side of the square log-luminance texture reduced by its mip chain.
+#define TONE_MAPPING_LUMINANCE_SIZE 256
+
+enum class ToneMappingOperator {
+  None,
+  Reinhard,
+  AcesFilmic,
+};
+
+// Global tone mapping of the fused image.
+//
+// The scene log-average luminance is reduced entirely on the GPU: a pass
+// writes log luminance into a small texture and glGenerateMipmap averages it
+// down to 1x1. A 1x1 ping-pong pair then eases the adapted luminance toward
+// it with an exponential time constant, so the exposure does not pump between
+// frames, and the tone-mapping pass scales the image to the key before
+// applying the operator.
+//
+// All methods must be called with the rendering GL context current.
+class ToneMappingPass {
+ public:
+  ToneMappingPass();
+  ~ToneMappingPass();
+
+  ToneMappingPass(const ToneMappingPass&) = delete;
+  ToneMappingPass& operator=(const ToneMappingPass&) = delete;
+
+  // (Re)allocates the input texture; no-op when the size did not change.
+  void Resize(GLsizei width, GLsizei height);
+
+  // Linear-filtered input the previous pass renders into.
+  GLuint GetInputTexture() const { return m_input; }
+
+  // Renderable colour format of the input; GL_RGBA16F by default, with a
+  // fallback when the context cannot render to it. Takes effect on the next
+  // Resize().
+  void SetInputFormat(GLenum format);
+
+  // Tone maps the input into `outputTexture`. `elapsedSeconds` is the time
+  // since the previous call and drives the adaptation.
+  void Render(GLuint outputTexture, float elapsedSeconds, GpuTimer& timer);
+
+  // `None` is not handled here: callers skip the pass instead.
+  void SetOperator(ToneMappingOperator toneOperator);
+  // Middle grey the average luminance is mapped to, or 0 to derive it from
+  // the scene brightness.
+  void SetKey(float key);
+  // Time constant of the adaptation; 0 follows the scene instantly.
+  void SetAdaptationTime(float seconds);
+  // Smallest scaled luminance Reinhard maps to pure white.
+  void SetWhitePoint(float whitePoint);
+
+ private:
+  GLuint m_luminance_program = 0;
+  GLuint m_adapt_program = 0;
+  GLuint m_tone_mapping_program = 0;
+  GLuint m_vao = 0;
+  GLuint m_fbo = 0;
+
+  GLuint m_input = 0;
+  GLuint m_luminance = 0;
+  GLuint m_adapted[2] = {0, 0};
+  // Index of the adapted texture written last
+  int m_adapted_index = 0;
+  // Set on (re)allocation so the first frame adapts instantly
+  bool m_reset_adaptation = true;
+
+  GLsizei m_width = 0;
+  GLsizei m_height = 0;
+  GLenum m_format = GL_RGBA16F;
+
+  ToneMappingOperator m_operator = ToneMappingOperator::Reinhard;
+  float m_key = 0.0f;
+  float m_adaptation_time = 0.5f;
+  float m_white_point = 4.0f;
+};
+
+#endif  // TONE_MAPPING_PASS_H_
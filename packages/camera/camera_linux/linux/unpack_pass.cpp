@@ -0,0 +1,114 @@
+#include "unpack_pass.h"
+
+#include <iostream>
+
+#include "gl_utils.h"
+
+static const char* const kUnpackFragmentShader = R"(
+  #version 300 es
+  precision highp float;
+  precision highp int;
+  precision highp usampler2D;
+  out vec4 FragColor;
+
+  uniform usampler2D packedBytes;
+  uniform int bitsPerPixel;
+
+  void main() {
+    ivec2 p = ivec2(gl_FragCoord.xy);
+    // A 10 or 12-bit pixel never spans more than two bytes.
+    int bit = p.x * bitsPerPixel;
+    int byteIndex = bit >> 3;
+    uint low = texelFetch(packedBytes, ivec2(byteIndex, p.y), 0).r;
+    uint high = texelFetch(packedBytes, ivec2(byteIndex + 1, p.y), 0).r;
+    uint mask = (1u << uint(bitsPerPixel)) - 1u;
+    uint value = ((low | (high << 8u)) >> uint(bit & 7)) & mask;
+    FragColor = vec4(float(value) / float(mask), 0.0, 0.0, 1.0);
+  }
+)";
+
+UnpackPass::UnpackPass() {
+  m_program =
+      CreateShaderProgram(kFullscreenVertexShader, kUnpackFragmentShader);
+  glGenVertexArrays(1, &m_vao);
+  glGenFramebuffers(1, &m_fbo);
+
+  glUseProgram(m_program);
+  glUniform1i(glGetUniformLocation(m_program, "packedBytes"), 0);
+  glUseProgram(0);
+
+  std::cout << "[DEBUG] Created unpack program: " << m_program << std::endl;
+}
+
+UnpackPass::~UnpackPass() {
+  glDeleteTextures(1, &m_packed);
+  glDeleteFramebuffers(1, &m_fbo);
+  glDeleteVertexArrays(1, &m_vao);
+  glDeleteProgram(m_program);
+}
+
+size_t UnpackPass::GetRowSize(GLsizei width, int bitsPerPixel) {
+  return (static_cast<size_t>(width) * bitsPerPixel + 7) / 8;
+}
+
+void UnpackPass::Resize(GLsizei width, GLsizei height, int bitsPerPixel) {
+  if (width == m_width && height == m_height &&
+      bitsPerPixel == m_bits_per_pixel) {
+    return;
+  }
+  glDeleteTextures(1, &m_packed);
+
+  // One spare texel: the last pixel of a row may fetch a byte past its end.
+  const GLsizei rowSize =
+      static_cast<GLsizei>(GetRowSize(width, bitsPerPixel)) + 1;
+  GLint maxSize = 0;
+  glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize);
+  if (rowSize > maxSize) {
+    std::cerr << "[ERROR] Packed rows of " << rowSize
+              << " bytes exceed the maximum texture size " << maxSize << "."
+              << std::endl;
+  }
+
+  glGenTextures(1, &m_packed);
+  glBindTexture(GL_TEXTURE_2D, m_packed);
+  glTexStorage2D(GL_TEXTURE_2D, 1, GL_R8UI, rowSize, height);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  m_width = width;
+  m_height = height;
+  m_bits_per_pixel = bitsPerPixel;
+}
+
+void UnpackPass::Render(GLuint texture, GLint layer, GpuTimer& timer) {
+  if (!m_packed) {
+    return;
+  }
+  timer.Begin("unpack");
+  glBindVertexArray(m_vao);
+  glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+  if (layer >= 0) {
+    glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, texture, 0,
+                              layer);
+  } else {
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                           texture, 0);
+  }
+  glViewport(0, 0, m_width, m_height);
+  glUseProgram(m_program);
+  glUniform1i(glGetUniformLocation(m_program, "bitsPerPixel"),
+              m_bits_per_pixel);
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, m_packed);
+  glDrawArrays(GL_TRIANGLES, 0, 3);
+
+  // Cleanup
+  glBindTexture(GL_TEXTURE_2D, 0);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0,
+                         0);
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  glBindVertexArray(0);
+  glUseProgram(0);
+  timer.End();
+}
@@ -0,0 +1,55 @@
+#ifndef UNPACK_PASS_H_
+#define UNPACK_PASS_H_
+
+#include <GLES3/gl3.h>
+
+#include <cstddef>
+
+#include "gpu_timer.h"
+
+// Unpacks GenICam packed pixel formats (Mono10p, Mono12p, Bayer*12p) on the
+// GPU.
+//
+// The raw bytes are uploaded as they come off the wire, 10 or 12 bits per
+// pixel packed LSB first across byte boundaries, into an integer texture
+// one byte per texel wide. A single pass extracts every pixel from the two
+// bytes it spans and writes it normalized to [0, 1] into a single-channel
+// target, half float where the context can render to it, so fusion keeps
+// the sensor's precision for less bandwidth than Mono16.
+//
+// All methods must be called with the rendering GL context current.
+class UnpackPass {
+ public:
+  UnpackPass();
+  ~UnpackPass();
+
+  UnpackPass(const UnpackPass&) = delete;
+  UnpackPass& operator=(const UnpackPass&) = delete;
+
+  // Bytes in one packed row of `width` pixels
+  static size_t GetRowSize(GLsizei width, int bitsPerPixel);
+
+  // (Re)allocates the packed texture; no-op when nothing changed.
+  void Resize(GLsizei width, GLsizei height, int bitsPerPixel);
+
+  // R8UI texture, GetRowSize() texels wide, callers upload the packed frame
+  // into as GL_RED_INTEGER.
+  GLuint GetPackedTexture() const { return m_packed; }
+
+  // Unpacks into `texture`: a layer of it when `layer` is not negative,
+  // otherwise the texture is 2D. The target must be a renderable
+  // single-channel texture of the size given to Resize().
+  void Render(GLuint texture, GLint layer, GpuTimer& timer);
+
+ private:
+  GLuint m_program = 0;
+  GLuint m_vao = 0;
+  GLuint m_fbo = 0;
+  GLuint m_packed = 0;
+
+  GLsizei m_width = 0;
+  GLsizei m_height = 0;
+  int m_bits_per_pixel = 0;
+};
+
+#endif  // UNPACK_PASS_H_
@@ -0,0 +1,362 @@
+#include "video_recorder.h"
+
+#include <cstring>
+#include <iostream>
+
+extern "C" {
+#include <libavcodec/avcodec.h>
+#include <libavformat/avformat.h>
+#include <libavutil/opt.h>
+#include <libswscale/swscale.h>
+}
+
+static AVPixelFormat ToAVPixelFormat(VideoPixelFormat format) {
+  switch (format) {
+    case VideoPixelFormat::Gray8:
+    case VideoPixelFormat::Gray12p:
+      return AV_PIX_FMT_GRAY8;
+    case VideoPixelFormat::Rgb24:
+      return AV_PIX_FMT_RGB24;
+    case VideoPixelFormat::Rgba:
+      return AV_PIX_FMT_RGBA;
+    case VideoPixelFormat::BayerRggb8:
+    case VideoPixelFormat::BayerRggb12p:
+      return AV_PIX_FMT_BAYER_RGGB8;
+    case VideoPixelFormat::BayerGbrg8:
+    case VideoPixelFormat::BayerGbrg12p:
+      return AV_PIX_FMT_BAYER_GBRG8;
+    case VideoPixelFormat::Nv12:
+      return AV_PIX_FMT_NV12;
+  }
+  return AV_PIX_FMT_NONE;
+}
+
+static bool IsPacked12(VideoPixelFormat format) {
+  return format == VideoPixelFormat::Gray12p ||
+         format == VideoPixelFormat::BayerRggb12p ||
+         format == VideoPixelFormat::BayerGbrg12p;
+}
+
+static size_t GetFrameBytes(size_t bytesPerRow, int height,
+                            VideoPixelFormat format) {
+  // NV12's chroma plane is half the luma plane's rows.
+  return format == VideoPixelFormat::Nv12
+             ? bytesPerRow * (height + (height + 1) / 2)
+             : bytesPerRow * height;
+}
+
+// The encoder's preferred 4:2:0 format, or its first one.
+static AVPixelFormat ChooseEncoderFormat(const AVCodec* codec) {
+  const AVPixelFormat* formats = nullptr;
+#if LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(61, 13, 100)
+  avcodec_get_supported_config(nullptr, codec, AV_CODEC_CONFIG_PIX_FORMAT, 0,
+                               reinterpret_cast<const void**>(&formats),
+                               nullptr);
+#else
+  formats = codec->pix_fmts;
+#endif
+  if (!formats) {
+    return AV_PIX_FMT_YUV420P;
+  }
+  for (const AVPixelFormat* format = formats; *format != AV_PIX_FMT_NONE;
+       ++format) {
+    if (*format == AV_PIX_FMT_YUV420P || *format == AV_PIX_FMT_NV12) {
+      return *format;
+    }
+  }
+  return formats[0];
+}
+
+static std::string GetErrorString(int error) {
+  char message[AV_ERROR_MAX_STRING_SIZE] = {};
+  av_strerror(error, message, sizeof(message));
+  return message;
+}
+
+VideoRecorder::VideoRecorder(std::string filePath,
+                             const VideoRecorderSettings& settings)
+    : m_file_path(std::move(filePath)),
+      m_settings(settings),
+      m_queue(VIDEO_RECORDER_QUEUE_CAPACITY,
+              FrameQueueOverflowPolicy::DropNewest) {
+  // Started last: the thread uses every member.
+  m_thread = std::thread(&VideoRecorder::Run, this);
+}
+
+VideoRecorder::~VideoRecorder() {
+  Finish();
+}
+
+bool VideoRecorder::Push(const uint8_t* pixels, int width, int height,
+                         size_t bytesPerRow, VideoPixelFormat format,
+                         std::chrono::steady_clock::time_point timestamp) {
+  if (m_queue.IsClosed()) {
+    return false;
+  }
+  // A full queue would drop the frame anyway: skip the copy.
+  if (m_queue.GetDepth() >= m_queue.GetCapacity()) {
+    m_dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  VideoFrame frame;
+  {
+    std::lock_guard<std::mutex> lock(m_free_mutex);
+    if (!m_free_buffers.empty()) {
+      frame.pixels = std::move(m_free_buffers.back());
+      m_free_buffers.pop_back();
+    }
+  }
+  const size_t size = GetFrameBytes(bytesPerRow, height, format);
+  frame.pixels.resize(size);
+  std::memcpy(frame.pixels.data(), pixels, size);
+  frame.width = width;
+  frame.height = height;
+  frame.bytesPerRow = bytesPerRow;
+  frame.format = format;
+  frame.timestamp = timestamp;
+  if (!m_queue.Push(std::move(frame))) {
+    m_dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  return true;
+}
+
+std::string VideoRecorder::Finish() {
+  m_queue.Close();
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+  return m_error;
+}
+
+uint64_t VideoRecorder::GetDroppedFrameCount() const {
+  return m_dropped.load(std::memory_order_relaxed);
+}
+
+void VideoRecorder::Run() {
+  for (;;) {
+    VideoFrame frame;
+    if (!m_queue.Pop(frame, std::chrono::milliseconds(100))) {
+      if (m_queue.IsClosed()) break;
+      continue;
+    }
+    if (m_error.empty()) {
+      if (!m_codec_context && !Open(frame)) {
+        Close();
+      } else if (!Encode(frame)) {
+        m_error = "Failed to encode a frame of " + m_file_path;
+      }
+      if (!m_error.empty()) {
+        std::cerr << "[DEBUG] " << m_error << std::endl;
+      }
+    }
+    std::lock_guard<std::mutex> lock(m_free_mutex);
+    m_free_buffers.push_back(std::move(frame.pixels));
+  }
+  if (m_codec_context) {
+    // Drain the frames the encoder still holds.
+    if (!Send(nullptr) && m_error.empty()) {
+      m_error = "Failed to flush the encoder of " + m_file_path;
+    }
+    if (av_write_trailer(m_format_context) < 0 && m_error.empty()) {
+      m_error = "Failed to finish " + m_file_path;
+    }
+  }
+  Close();
+}
+
+bool VideoRecorder::Open(const VideoFrame& frame) {
+  const char* container =
+      m_settings.container.empty() ? nullptr : m_settings.container.c_str();
+  int result = avformat_alloc_output_context2(&m_format_context, nullptr,
+                                              container, m_file_path.c_str());
+  if (result < 0 || !m_format_context) {
+    m_error = "Unknown container for " + m_file_path;
+    return false;
+  }
+
+  for (const char* name :
+       {VIDEO_RECORDER_HARDWARE_ENCODER, VIDEO_RECORDER_SOFTWARE_ENCODER}) {
+    const AVCodec* codec = avcodec_find_encoder_by_name(name);
+    if (codec && OpenEncoder(codec, frame)) {
+      break;
+    }
+  }
+  if (!m_codec_context) {
+    const AVCodec* codec = avcodec_find_encoder(AV_CODEC_ID_H264);
+    if (!codec || !OpenEncoder(codec, frame)) {
+      m_error = "No H.264 encoder available";
+      return false;
+    }
+  }
+  std::cout << "[DEBUG] Recording " << m_file_path << " with "
+            << m_codec_context->codec->name << " at "
+            << m_codec_context->bit_rate << " bps" << std::endl;
+
+  m_stream = avformat_new_stream(m_format_context, nullptr);
+  if (!m_stream ||
+      avcodec_parameters_from_context(m_stream->codecpar, m_codec_context) <
+          0) {
+    m_error = "Failed to add a video stream to " + m_file_path;
+    return false;
+  }
+  m_stream->time_base = m_codec_context->time_base;
+  if (!(m_format_context->oformat->flags & AVFMT_NOFILE)) {
+    result = avio_open(&m_format_context->pb, m_file_path.c_str(),
+                       AVIO_FLAG_WRITE);
+    if (result < 0) {
+      m_error = "Failed to open " + m_file_path + ": " + GetErrorString(result);
+      return false;
+    }
+  }
+  result = avformat_write_header(m_format_context, nullptr);
+  if (result < 0) {
+    m_error =
+        "Failed to write the header of " + m_file_path + ": " +
+        GetErrorString(result);
+    return false;
+  }
+
+  // Odd edges are cropped rather than scaled: 4:2:0 needs even sizes.
+  m_sws_context = sws_getContext(
+      m_codec_context->width, m_codec_context->height,
+      ToAVPixelFormat(frame.format), m_codec_context->width,
+      m_codec_context->height, m_codec_context->pix_fmt, SWS_BILINEAR,
+      nullptr, nullptr, nullptr);
+  m_frame = av_frame_alloc();
+  m_packet = av_packet_alloc();
+  if (!m_sws_context || !m_frame || !m_packet) {
+    m_error = "Failed to set up the conversion for " + m_file_path;
+    return false;
+  }
+  m_frame->format = m_codec_context->pix_fmt;
+  m_frame->width = m_codec_context->width;
+  m_frame->height = m_codec_context->height;
+  if (av_frame_get_buffer(m_frame, 0) < 0) {
+    m_error = "Failed to allocate the frames of " + m_file_path;
+    return false;
+  }
+  m_first_timestamp = frame.timestamp;
+  return true;
+}
+
+bool VideoRecorder::OpenEncoder(const AVCodec* codec,
+                                const VideoFrame& frame) {
+  AVCodecContext* context = avcodec_alloc_context3(codec);
+  if (!context) {
+    return false;
+  }
+  context->width = frame.width & ~1;
+  context->height = frame.height & ~1;
+  // Stamped with capture times in microseconds, so frames keep the
+  // spacing they were grabbed at.
+  context->time_base = AVRational{1, 1000000};
+  context->framerate = av_d2q(m_settings.frameRate, 1000);
+  context->gop_size = m_settings.keyFrameInterval;
+  // Hardware encoders do not reorder; keep both encoders alike.
+  context->max_b_frames = 0;
+  context->pix_fmt = ChooseEncoderFormat(codec);
+  context->bit_rate =
+      m_settings.bitrate > 0
+          ? m_settings.bitrate
+          : static_cast<int64_t>(static_cast<double>(context->width) *
+                                 context->height * m_settings.frameRate *
+                                 VIDEO_RECORDER_DEFAULT_BITS_PER_PIXEL);
+  if (m_format_context->oformat->flags & AVFMT_GLOBALHEADER) {
+    context->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
+  }
+  if (std::strcmp(codec->name, VIDEO_RECORDER_SOFTWARE_ENCODER) == 0) {
+    av_opt_set(context->priv_data, "preset", "veryfast", 0);
+  }
+
+  const int result = avcodec_open2(context, codec, nullptr);
+  if (result < 0) {
+    std::cerr << "[DEBUG] Encoder " << codec->name
+              << " unavailable: " << GetErrorString(result) << std::endl;
+    avcodec_free_context(&context);
+    return false;
+  }
+  m_codec_context = context;
+  return true;
+}
+
+bool VideoRecorder::Encode(VideoFrame& frame) {
+  if ((frame.width & ~1) != m_codec_context->width ||
+      (frame.height & ~1) != m_codec_context->height) {
+    return false;
+  }
+  const uint8_t* planes[2] = {frame.pixels.data(), nullptr};
+  int strides[2] = {static_cast<int>(frame.bytesPerRow), 0};
+  if (IsPacked12(frame.format)) {
+    // Keep the high 8 bits of each sample: the low nibble of the middle
+    // byte for the first, the third byte for the second.
+    const size_t width = static_cast<size_t>(frame.width);
+    m_unpacked.resize(width * frame.height);
+    for (int y = 0; y < frame.height; ++y) {
+      const uint8_t* in = frame.pixels.data() + y * frame.bytesPerRow;
+      uint8_t* out = m_unpacked.data() + y * width;
+      for (size_t x = 0; x + 1 < width; x += 2, in += 3) {
+        out[x] = static_cast<uint8_t>((in[0] >> 4) | (in[1] << 4));
+        out[x + 1] = in[2];
+      }
+      if (width & 1) {
+        out[width - 1] = static_cast<uint8_t>((in[0] >> 4) | (in[1] << 4));
+      }
+    }
+    planes[0] = m_unpacked.data();
+    strides[0] = static_cast<int>(width);
+  } else if (frame.format == VideoPixelFormat::Nv12) {
+    planes[1] = planes[0] + frame.bytesPerRow * frame.height;
+    strides[1] = strides[0];
+  }
+
+  if (av_frame_make_writable(m_frame) < 0) {
+    return false;
+  }
+  sws_scale(m_sws_context, planes, strides, 0, m_codec_context->height,
+            m_frame->data, m_frame->linesize);
+
+  int64_t pts = std::chrono::duration_cast<std::chrono::microseconds>(
+                    frame.timestamp - m_first_timestamp)
+                    .count();
+  // Timestamps must increase even when two grabs share a clock tick.
+  if (pts <= m_last_pts) {
+    pts = m_last_pts + 1;
+  }
+  m_last_pts = pts;
+  m_frame->pts = pts;
+  return Send(m_frame);
+}
+
+bool VideoRecorder::Send(AVFrame* frame) {
+  int result = avcodec_send_frame(m_codec_context, frame);
+  if (result < 0) {
+    return false;
+  }
+  while ((result = avcodec_receive_packet(m_codec_context, m_packet)) >= 0) {
+    av_packet_rescale_ts(m_packet, m_codec_context->time_base,
+                         m_stream->time_base);
+    m_packet->stream_index = m_stream->index;
+    // Takes the packet's reference.
+    if (av_interleaved_write_frame(m_format_context, m_packet) < 0) {
+      return false;
+    }
+  }
+  return result == AVERROR(EAGAIN) || result == AVERROR_EOF;
+}
+
+void VideoRecorder::Close() {
+  sws_freeContext(m_sws_context);
+  m_sws_context = nullptr;
+  av_frame_free(&m_frame);
+  av_packet_free(&m_packet);
+  avcodec_free_context(&m_codec_context);
+  if (m_format_context) {
+    if (!(m_format_context->oformat->flags & AVFMT_NOFILE)) {
+      avio_closep(&m_format_context->pb);
+    }
+    avformat_free_context(m_format_context);
+    m_format_context = nullptr;
+  }
+  m_stream = nullptr;
+}
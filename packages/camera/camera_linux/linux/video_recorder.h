@@ -0,0 +1,132 @@
+#ifndef VIDEO_RECORDER_H_
+#define VIDEO_RECORDER_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "frame_queue.h"
+
+// Frames waiting for the encoder; later ones are dropped
+#define VIDEO_RECORDER_QUEUE_CAPACITY 8
+// Tried first, then the software encoder, then any H.264 encoder
+#define VIDEO_RECORDER_HARDWARE_ENCODER "h264_v4l2m2m"
+#define VIDEO_RECORDER_SOFTWARE_ENCODER "libx264"
+// Bitrate derived when none is set, in bits per pixel per frame
+#define VIDEO_RECORDER_DEFAULT_BITS_PER_PIXEL 0.1
+// Frame rate assumed when the camera does not report one
+#define VIDEO_RECORDER_DEFAULT_FRAME_RATE 30.0
+
+struct AVCodec;
+struct AVCodecContext;
+struct AVFormatContext;
+struct AVFrame;
+struct AVPacket;
+struct AVStream;
+struct SwsContext;
+
+enum class VideoPixelFormat {
+  Gray8,
+  Rgb24,
+  Rgba,
+  BayerRggb8,
+  BayerGbrg8,
+  // 12-bit samples packed two to three bytes, recorded at 8 bits
+  Gray12p,
+  BayerRggb12p,
+  BayerGbrg12p,
+  // Luma plane followed by interleaved chroma, same row pitch
+  Nv12,
+};
+
+struct VideoRecorderSettings {
+  // Bits per second, 0 to derive it from the frame size and rate
+  int64_t bitrate = 0;
+  // Frames between key frames
+  int keyFrameInterval = 60;
+  // FFmpeg muxer name, empty to pick it from the file's extension
+  std::string container;
+  // Nominal rate given to the encoder's rate control. Frames are stamped
+  // with their capture time, so the recording plays at the rate it was
+  // captured at whatever this is.
+  double frameRate = VIDEO_RECORDER_DEFAULT_FRAME_RATE;
+};
+
+// A frame waiting for the encoder, in a buffer recycled across frames.
+struct VideoFrame {
+  std::vector<uint8_t> pixels;
+  int width = 0;
+  int height = 0;
+  size_t bytesPerRow = 0;
+  VideoPixelFormat format = VideoPixelFormat::Gray8;
+  std::chrono::steady_clock::time_point timestamp;
+};
+
+// Records frames to a video file with FFmpeg on its own thread.
+//
+// Producers copy each frame into a bounded queue and return at once; the
+// recorder thread converts it to the encoder's format, encodes and muxes
+// it. The encoder is opened on the first frame, preferring the V4L2
+// memory-to-memory hardware encoder and falling back to x264.
+class VideoRecorder {
+ public:
+  VideoRecorder(std::string filePath, const VideoRecorderSettings& settings);
+  // Finishes the file if Finish() was not called.
+  ~VideoRecorder();
+
+  VideoRecorder(const VideoRecorder&) = delete;
+  VideoRecorder& operator=(const VideoRecorder&) = delete;
+
+  const std::string& GetFilePath() const { return m_file_path; }
+
+  // Queues a copy of a frame captured at `timestamp`. Returns false when
+  // it was dropped because the encoder is behind, or after Finish().
+  bool Push(const uint8_t* pixels, int width, int height, size_t bytesPerRow,
+            VideoPixelFormat format,
+            std::chrono::steady_clock::time_point timestamp);
+
+  // Encodes the queued frames, flushes the encoder and closes the file.
+  // Returns the first error, or an empty string.
+  std::string Finish();
+
+  uint64_t GetDroppedFrameCount() const;
+
+ private:
+  const std::string m_file_path;
+  const VideoRecorderSettings m_settings;
+
+  FrameQueue<VideoFrame> m_queue;
+  std::atomic<uint64_t> m_dropped{0};
+  // Buffers of encoded frames, reused by Push()
+  std::mutex m_free_mutex;
+  std::vector<std::vector<uint8_t>> m_free_buffers;
+  std::thread m_thread;
+
+  // Recorder thread only
+  AVFormatContext* m_format_context = nullptr;
+  AVCodecContext* m_codec_context = nullptr;
+  AVStream* m_stream = nullptr;
+  SwsContext* m_sws_context = nullptr;
+  AVFrame* m_frame = nullptr;
+  AVPacket* m_packet = nullptr;
+  std::vector<uint8_t> m_unpacked;
+  std::chrono::steady_clock::time_point m_first_timestamp;
+  int64_t m_last_pts = -1;
+  // Written by the recorder thread, read once it is joined
+  std::string m_error;
+
+  void Run();
+  bool Open(const VideoFrame& frame);
+  bool OpenEncoder(const AVCodec* codec, const VideoFrame& frame);
+  bool Encode(VideoFrame& frame);
+  bool Send(AVFrame* frame);
+  void Close();
+};
+
+#endif  // VIDEO_RECORDER_H_
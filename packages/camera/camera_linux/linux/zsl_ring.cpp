@@ -0,0 +1,146 @@
+#include "zsl_ring.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+ZslRing::ZslRing(size_t depth, bool raw) : m_raw(raw), m_entries(depth) {
+  if (!m_raw) {
+    m_copy_pass = std::make_unique<DownscalePass>("zsl_copy");
+    m_readback = std::make_unique<FrameReadback>(ZSL_READBACK_DEPTH);
+  }
+}
+
+ZslRing::~ZslRing() {
+  for (Entry& entry : m_entries) {
+    glDeleteTextures(1, &entry.texture);
+  }
+}
+
+void ZslRing::PushProcessed(GLuint source, GLsizei width, GLsizei height,
+                            std::chrono::steady_clock::time_point timestamp,
+                            GpuTimer& timer) {
+  if (width != m_texture_width || height != m_texture_height) {
+    // Frames of the previous size are not worth a picture anymore.
+    for (Entry& entry : m_entries) {
+      glDeleteTextures(1, &entry.texture);
+      glGenTextures(1, &entry.texture);
+      glBindTexture(GL_TEXTURE_2D, entry.texture);
+      glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, width, height);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+    m_texture_width = width;
+    m_texture_height = height;
+    m_next = 0;
+    m_count = 0;
+    std::cout << "[DEBUG] Allocated ZSL ring: " << m_entries.size() << " x "
+              << width << "x" << height << std::endl;
+  }
+
+  Entry& entry = m_entries[m_next];
+  // A 1:1 downscale is a plain copy that also converts the display format
+  // to RGBA8, which can always be read back.
+  m_copy_pass->Render(source, width, height, entry.texture, width, height,
+                      timer);
+  entry.width = width;
+  entry.height = height;
+  entry.timestamp = timestamp;
+  m_next = (m_next + 1) % m_entries.size();
+  ++m_count;
+}
+
+void ZslRing::PushRaw(const uint8_t* data, size_t size,
+                      Pylon::EPixelType pixelType, int width, int height,
+                      size_t paddingX,
+                      std::chrono::steady_clock::time_point timestamp) {
+  Entry& entry = m_entries[m_next];
+  if (entry.bytes.size() < size) {
+    entry.bytes.resize(size);
+  }
+  std::memcpy(entry.bytes.data(), data, size);
+  entry.size = size;
+  entry.pixelType = pixelType;
+  entry.width = width;
+  entry.height = height;
+  entry.paddingX = paddingX;
+  entry.timestamp = timestamp;
+  m_next = (m_next + 1) % m_entries.size();
+  ++m_count;
+}
+
+const ZslRing::Entry* ZslRing::FindClosest(
+    std::chrono::steady_clock::time_point time) const {
+  const size_t count = std::min(m_count, m_entries.size());
+  const Entry* closest = nullptr;
+  std::chrono::steady_clock::duration closestDistance{};
+  for (size_t i = 0; i < count; ++i) {
+    const Entry& entry = m_entries[i];
+    const auto distance = entry.timestamp > time ? entry.timestamp - time
+                                                 : time - entry.timestamp;
+    if (!closest || distance < closestDistance) {
+      closest = &entry;
+      closestDistance = distance;
+    }
+  }
+  return closest;
+}
+
+bool ZslRing::Capture(std::chrono::steady_clock::time_point time,
+                      std::promise<StillFrame>& still) {
+  const Entry* entry = FindClosest(time);
+  if (!entry) {
+    return false;
+  }
+
+  if (m_raw) {
+    StillFrame frame;
+    frame.pixels.assign(entry->bytes.begin(),
+                        entry->bytes.begin() + entry->size);
+    frame.width = entry->width;
+    frame.height = entry->height;
+    frame.bytesPerRow = entry->size / entry->height;
+    frame.raw = true;
+    frame.pixelType = entry->pixelType;
+    frame.paddingX = entry->paddingX;
+    frame.timestamp = entry->timestamp;
+    still.set_value(std::move(frame));
+    return true;
+  }
+
+  // Reads are queued on the GL command stream: later frames pushed over
+  // the entry do not affect it.
+  if (!m_readback->Request(entry->texture, entry->width, entry->height)) {
+    return false;
+  }
+  m_pending.push_back({std::move(still), entry->timestamp});
+  return true;
+}
+
+void ZslRing::Poll() {
+  while (!m_pending.empty()) {
+    const size_t inFlight = m_readback->GetInFlightCount();
+    FrameReadback::Frame frame;
+    if (!m_readback->Map(frame)) {
+      if (m_readback->GetInFlightCount() == inFlight) {
+        break;
+      }
+      // The read completed but could not be mapped.
+      m_pending.front().promise.set_exception(std::make_exception_ptr(
+          std::runtime_error("Failed to read back the picture")));
+      m_pending.pop_front();
+      continue;
+    }
+
+    StillFrame still;
+    const size_t size = frame.bytesPerRow * frame.height;
+    still.pixels.assign(frame.pixels, frame.pixels + size);
+    still.width = frame.width;
+    still.height = frame.height;
+    still.bytesPerRow = frame.bytesPerRow;
+    still.timestamp = m_pending.front().timestamp;
+    m_readback->Unmap();
+    m_pending.front().promise.set_value(std::move(still));
+    m_pending.pop_front();
+  }
+}
@@ -0,0 +1,121 @@
+#ifndef ZSL_RING_H_
+#define ZSL_RING_H_
+
+#include <GLES3/gl3.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "downscale_pass.h"
+#include "frame_readback.h"
+#include "gpu_timer.h"
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Woverloaded-virtual"
+#pragma clang diagnostic ignored "-Wunused-variable"
+
+#include <pylon/PylonIncludes.h>
+
+#pragma clang diagnostic pop
+
+// Stills read back from the ring at once; later requests wait a frame
+#define ZSL_READBACK_DEPTH 2
+// Frames the ring may hold, each a full resolution texture or raw copy
+#define ZSL_MAX_FRAME_COUNT 32
+// How long a picture waits for its frame before giving up
+#define ZSL_CAPTURE_TIMEOUT_MS 2000
+
+// A still taken from the zero-shutter-lag ring, in host memory.
+struct StillFrame {
+  std::vector<uint8_t> pixels;
+  int width = 0;
+  int height = 0;
+  size_t bytesPerRow = 0;
+  // Processed frames are RGBA8, texture row 0 first. Raw frames are the
+  // camera's bytes as grabbed, in `pixelType` with `paddingX` bytes after
+  // each row.
+  bool raw = false;
+  Pylon::EPixelType pixelType = Pylon::PixelType_Undefined;
+  size_t paddingX = 0;
+  std::chrono::steady_clock::time_point timestamp;
+};
+
+// Zero-shutter-lag ring: the last few frames, so a picture can be taken
+// from the stream without stopping it.
+//
+// Processed frames (the pipeline's full-resolution output) stay on the GPU
+// as RGBA8 copies and only the one picked for a still is read back. Raw
+// frames are copied from the grab buffers to host memory as they arrive,
+// since the grab buffers go back to the camera right after upload.
+//
+// All methods must be called with the rendering GL context current.
+class ZslRing {
+ public:
+  ZslRing(size_t depth, bool raw);
+  ~ZslRing();
+
+  ZslRing(const ZslRing&) = delete;
+  ZslRing& operator=(const ZslRing&) = delete;
+
+  bool IsRaw() const { return m_raw; }
+
+  // Copies `source`, a `width` x `height` 2D texture rendered at
+  // `timestamp`, over the oldest processed frame.
+  void PushProcessed(GLuint source, GLsizei width, GLsizei height,
+                     std::chrono::steady_clock::time_point timestamp,
+                     GpuTimer& timer);
+
+  // Copies a grabbed frame of `size` bytes over the oldest raw frame.
+  void PushRaw(const uint8_t* data, size_t size, Pylon::EPixelType pixelType,
+               int width, int height, size_t paddingX,
+               std::chrono::steady_clock::time_point timestamp);
+
+  // Takes the frame closest to `time` into `still`: right away for raw
+  // frames, after the readback completes (see Poll()) for processed ones.
+  // Returns false, leaving `still` alone, when the ring is empty or every
+  // readback is in flight.
+  bool Capture(std::chrono::steady_clock::time_point time,
+               std::promise<StillFrame>& still);
+
+  // Completes stills whose readback finished.
+  void Poll();
+
+ private:
+  struct Entry {
+    GLuint texture = 0;
+    std::vector<uint8_t> bytes;
+    size_t size = 0;
+    Pylon::EPixelType pixelType = Pylon::PixelType_Undefined;
+    int width = 0;
+    int height = 0;
+    size_t paddingX = 0;
+    std::chrono::steady_clock::time_point timestamp;
+  };
+
+  const bool m_raw;
+  std::vector<Entry> m_entries;
+  // Next entry written, and number of entries written so far
+  size_t m_next = 0;
+  size_t m_count = 0;
+
+  std::unique_ptr<DownscalePass> m_copy_pass;
+  GLsizei m_texture_width = 0;
+  GLsizei m_texture_height = 0;
+
+  // Stills waiting on their readback, oldest first
+  std::unique_ptr<FrameReadback> m_readback;
+  struct PendingStill {
+    std::promise<StillFrame> promise;
+    std::chrono::steady_clock::time_point timestamp;
+  };
+  std::deque<PendingStill> m_pending;
+
+  const Entry* FindClosest(std::chrono::steady_clock::time_point time) const;
+};
+
+#endif  // ZSL_RING_H_
@@ -52,6 +52,16 @@ enum PlatformFocusMode {
 enum PlatformImageFormatGroup {
   rgb8,
   mono8,
+  /// Raw sensor data, demosaiced on the GPU.
+  bayerRG8,
+  /// Raw sensor data, demosaiced on the GPU.
+  bayerGB8,
+  /// 12-bit samples packed two to three bytes, unpacked on the GPU.
+  mono12p,
+  /// 12-bit samples packed two to three bytes, unpacked on the GPU.
+  bayerRG12p,
+  /// 12-bit samples packed two to three bytes, unpacked on the GPU.
+  bayerGB12p,
 }
 
 enum PlatformResolutionPreset {
@@ -63,6 +73,41 @@ enum PlatformResolutionPreset {
   max, // The highest resolution available.
 }
 
+// What happens to a frame retrieved while the queue to the GPU is full.
+enum PlatformFrameQueuePolicy {
+  dropOldest,
+  dropNewest,
+  block,
+}
+
+// Tone-mapping curve applied after exposure fusion.
+enum PlatformToneMappingOperator {
+  none,
+  reinhard,
+  acesFilmic,
+}
+
+// How Bayer frames are interpolated to RGB.
+enum PlatformDemosaicAlgorithm {
+  bilinear,
+  malvarHeCutler,
+}
+
+// Sized formats of the GPU render targets.
+enum PlatformRenderFormat {
+  rgb8,
+  rgba8,
+  rgb10a2,
+  rgba16f,
+}
+
+// Chroma subsampling of JPEG pictures.
+enum PlatformJpegSubsampling {
+  yuv420,
+  yuv422,
+  yuv444,
+}
+
 // Pigeon version of the data needed for a CameraInitializedEvent.
 class PlatformCameraState {
   PlatformCameraState({
@@ -97,6 +142,18 @@ class PlatformPoint {
   final double y;
 }
 
+/// Pictures written by a burst.
+class PlatformBurstResult {
+  PlatformBurstResult({required this.paths, required this.timestampsUs});
+
+  /// The pictures' paths, in capture order.
+  final List<String> paths;
+
+  /// When each frame was retrieved from the camera, in microseconds after the
+  /// burst was requested.
+  final List<int> timestampsUs;
+}
+
 @HostApi()
 abstract class CameraApi {
   /// Returns the list of available cameras.
@@ -146,6 +203,129 @@ abstract class CameraApi {
   @async
   void setImageFormatGroup(
       int cameraId, PlatformImageFormatGroup imageFormatGroup);
+
+  /// Sets how many buffers the camera grabs into, 0 for the default.
+  @async
+  void setGrabBufferCount(int cameraId, int count);
+
+  /// Sets how many pixel buffer slots frames are uploaded through, 0 for the
+  /// default.
+  @async
+  void setUploadRingDepth(int cameraId, int depth);
+
+  /// Sets what happens to frames retrieved while [capacity] frames (0 for the
+  /// default) already wait for the GPU: evict the oldest, drop the new one, or
+  /// hold the acquisition thread until one is rendered.
+  @async
+  void setFrameQueuePolicy(
+      int cameraId, PlatformFrameQueuePolicy policy, int capacity);
+
+  /// Sets the exposure bracket fused into each output frame, as exposure times
+  /// in microseconds and matching gains in dB (empty keeps the current gain).
+  @async
+  void setExposureBracket(
+      int cameraId, List<double> exposuresUs, List<double> gains);
+
+  /// Selects the tone-mapping operator applied after exposure fusion. [key] is
+  /// the middle grey the scene average maps to, or 0 to derive it from the scene
+  /// brightness; [adaptationSeconds] is the time constant of the adaptation.
+  @async
+  void setToneMapping(
+      int cameraId,
+      PlatformToneMappingOperator toneMappingOperator,
+      double key,
+      double adaptationSeconds);
+
+  /// Enables the bracket auto-exposure loop. [targetBrightness] (0-255) is the
+  /// mid-tone level of the longest exposure; the shortest exposure keeps
+  /// [overblownTargetRatio] of its pixels at or above [overblownThreshold] (0-255).
+  /// [controllerGain] is the proportional gain of both loops.
+  @async
+  void setAutoExposure(
+      int cameraId,
+      bool enabled,
+      double targetBrightness,
+      double overblownThreshold,
+      double overblownTargetRatio,
+      double controllerGain);
+
+  /// Selects how Bayer image format groups are interpolated to RGB on the GPU.
+  @async
+  void setDemosaicAlgorithm(int cameraId, PlatformDemosaicAlgorithm algorithm);
+
+  /// Selects the formats of the HDR chain's intermediate render targets and of
+  /// the preview texture, restarting the stream when it is running.
+  @async
+  void setRenderFormats(int cameraId, PlatformRenderFormat intermediateFormat,
+      PlatformRenderFormat displayFormat);
+
+  /// Starts streaming frames to CameraEventApi.imageStreamFrame, scaled to
+  /// [width] x [height] (0 keeps the frame's size, or its aspect ratio when
+  /// only one is 0) and at most [maxFrameRate] frames per second (0 for every
+  /// frame).
+  @async
+  void startImageStream(
+      int cameraId, int width, int height, double maxFrameRate);
+
+  /// Stops streaming frames to Dart.
+  @async
+  void stopImageStream(int cameraId);
+
+  /// Returns the credit of a streamed frame Dart is done with. Frames rendered
+  /// while every credit is out are dropped rather than queued.
+  @async
+  void receivedImageStreamData(int cameraId);
+
+  /// Sets the size of the preview texture, scaled down on the GPU from the
+  /// full-resolution frame (0 keeps the frame's size, or its aspect ratio when
+  /// only one is 0). Restarts the stream when it is running.
+  @async
+  void setPreviewSize(int cameraId, int width, int height);
+
+  /// Keeps the last [frameCount] frames so takePicture picks the one closest to
+  /// the call without stopping the stream (0 stops it and grabs a new frame
+  /// instead). [rawFrames] keeps the camera's frames rather than the fused and
+  /// tone-mapped ones. Restarts the stream when it is running.
+  @async
+  void setZeroShutterLag(int cameraId, int frameCount, bool rawFrames);
+
+  /// Captures the next [count] frames from the stream at the sensor's rate and
+  /// writes them as pictures in [directory], in parallel once all are in.
+  @async
+  PlatformBurstResult takeBurst(int cameraId, int count, String directory);
+
+  /// Sets how pictures are compressed: [quality] from 1 to 100, the chroma
+  /// [subsampling], and a restart marker every [restartInterval] rows of blocks
+  /// (0 for none, or only between the strips encoded in parallel).
+  @async
+  void setJpegSettings(int cameraId, int quality,
+      PlatformJpegSubsampling subsampling, int restartInterval);
+
+  /// Sets how the next recording is encoded: [bitrate] in bits per second (0 to
+  /// derive it from the frame size and rate), a key frame every
+  /// [keyFrameInterval] frames, and the [container] format name (empty to
+  /// derive it from the file's extension).
+  @async
+  void setVideoRecordingSettings(
+      int cameraId, int bitrate, int keyFrameInterval, String container);
+
+  /// Chooses what the next recording captures: the processed (fused and
+  /// tone-mapped) frames shown in the preview, or the raw sensor frames.
+  /// Processed frames are converted to NV12 on the GPU when [gpuNv12] is set
+  /// and the frame size allows it, reading back 12 bits per pixel instead of
+  /// 32.
+  @async
+  void setVideoRecordingSource(
+      int cameraId, bool processedFrames, bool gpuNv12);
+
+  /// Records the camera's frames as grabbed, uncompressed, to a raw sequence
+  /// file at [filePath] with room for [maxFrames] frames (0 for the default).
+  @async
+  void startRawRecording(int cameraId, String filePath, int maxFrames);
+
+  /// Finishes the raw recording and returns the path of its file.
+  @async
+  String stopRawRecording(int cameraId);
 }
 
 /// Handler for native callbacks that are tied to a specific camera ID.
@@ -158,6 +338,12 @@ abstract class CameraEventApi {
 
   void textureId(int textureId);
 
+  /// Called with each frame streamed after CameraApi.startImageStream, as
+  /// BGRA rows. [droppedFrameCount] counts the frames dropped since the
+  /// stream started because every credit was out.
+  void imageStreamFrame(int width, int height, int bytesPerRow, Uint8List bytes,
+      int droppedFrameCount);
+
   /// Called when an error occurs in the camera.
   ///
   /// This should be used for errors that occur outside of the context of